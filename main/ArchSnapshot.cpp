@@ -0,0 +1,226 @@
+#include "ArchSnapshot.h"
+#include "Architecture.h"
+
+#include <string>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace holodec {
+
+	uint64_t Architecture::getSourceChecksum() {
+		uint64_t checksum = getLayoutChecksum();
+		auto mix = [&checksum] (uint64_t val) {
+			checksum = (checksum ^ val) * 1099511628211ULL;
+		};
+		mix (H_ARCHSNAPSHOT_VERSION);
+		for (Register& reg : registers) {
+			mix ((uint64_t) reg.type);
+			mix (reg.clearParentOnWrite);
+		}
+		for (Stack& stack : stacks) {
+			mix ((uint64_t) stack.type);
+			mix ((uint64_t) stack.policy);
+			mix (stack.count);
+		}
+		for (Memory& memory : memories) {
+			mix (memory.size);
+		}
+		for (CallingConvention& cc : callingconventions) {
+			mix (cc.id);
+			mix (cc.name.hash());
+		}
+		//refIds that are given by name are the result of init and not part of the source
+		visitRefs ([&mix] (StringRef* ref, bool memory) {
+			mix (ref->name ? ref->name.hash() : ref->refId);
+		});
+		for (auto& entry : instrdefs) {
+			mix (entry.first);
+			mix (entry.second.mnemonics.hash());
+			mix ((uint64_t) entry.second.type);
+			mix ((uint64_t) entry.second.type2);
+			for (IRRepresentation& rep : entry.second.irs) {
+				mix (rep.argcount);
+				mix (rep.condstring.hash());
+				mix (rep.irstring.hash());
+			}
+		}
+		return checksum;
+	}
+
+	bool Architecture::loadSnapshot (const char* path) {
+		int fd = open (path, O_RDONLY);
+		if (fd < 0)
+			return false;
+		struct stat filestat;
+		if (fstat (fd, &filestat) != 0 || (size_t) filestat.st_size < sizeof (ArchSnapshotHeader)) {
+			close (fd);
+			return false;
+		}
+		size_t size = filestat.st_size;
+		void* mapping = mmap (nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close (fd);
+		if (mapping == MAP_FAILED)
+			return false;
+
+		const uint8_t* base = (const uint8_t*) mapping;
+		const ArchSnapshotHeader* header = (const ArchSnapshotHeader*) base;
+		auto inBounds = [size] (uint64_t offset, uint64_t count, size_t elementsize) {
+			return offset <= size && count <= (size - offset) / elementsize;
+		};
+		size_t refcount = 0, repcount = 0;
+		visitRefs ([&refcount] (StringRef* ref, bool memory) {
+			refcount++;
+		});
+		for (auto& entry : instrdefs)
+			repcount += entry.second.irs.size();
+
+		if (header->magic != H_ARCHSNAPSHOT_MAGIC || header->version != H_ARCHSNAPSHOT_VERSION || header->headersize != sizeof (ArchSnapshotHeader) || header->filesize != size) {
+			printf ("Snapshot %s has an invalid Format\n", path);
+			munmap (mapping, size);
+			return false;
+		}
+		if (header->checksum != getSourceChecksum() || header->refcount != refcount || header->repcount != repcount) {
+			printf ("Snapshot %s is stale\n", path);
+			munmap (mapping, size);
+			return false;
+		}
+		if (!inBounds (header->refoffset, header->refcount, sizeof (HId)) ||
+		        !inBounds (header->exproffset, header->exprcount, sizeof (ArchSnapshotExpression)) ||
+		        !inBounds (header->argoffset, header->argcount, sizeof (IRTableArgument)) ||
+		        !inBounds (header->repoffset, header->repcount, sizeof (ArchSnapshotRepresentation))) {
+			printf ("Snapshot %s is truncated\n", path);
+			munmap (mapping, size);
+			return false;
+		}
+		const HId* refs = (const HId*) (base + header->refoffset);
+		const ArchSnapshotExpression* exprs = (const ArchSnapshotExpression*) (base + header->exproffset);
+		const IRTableArgument* args = (const IRTableArgument*) (base + header->argoffset);
+		const ArchSnapshotRepresentation* reps = (const ArchSnapshotRepresentation*) (base + header->repoffset);
+
+		for (size_t i = 0; i < header->exprcount; i++) {
+			if (exprs[i].argoffset > header->argcount || exprs[i].argcount > header->argcount - exprs[i].argoffset) {
+				printf ("Snapshot %s is corrupt\n", path);
+				munmap (mapping, size);
+				return false;
+			}
+		}
+
+		size_t refindex = 0;
+		visitRefs ([refs, &refindex] (StringRef* ref, bool memory) {
+			ref->refId = refs[refindex++];
+		});
+		instrIds.clear();
+		for (auto& entry : instrdefs) {
+			entry.second.id = entry.first;
+			HId id = entry.first;
+			instrIds.insert (id);
+		}
+		irExpressions.clear();
+		for (size_t i = 0; i < header->exprcount; i++) {
+			IRExpression expr;
+			expr.type = (IRExprType) exprs[i].type;
+			expr.size = exprs[i].size;
+			expr.returntype = (SSAType) exprs[i].returntype;
+			expr.mod.index = exprs[i].mod;
+			for (size_t j = 0; j < exprs[i].argcount; j++) {
+				expr.subExpressions.push_back (toIRArgument (&args[exprs[i].argoffset + j]));
+			}
+			irExpressions.push_back (expr);
+		}
+		size_t repindex = 0;
+		for (auto& entry : instrdefs) {
+			for (IRRepresentation& rep : entry.second.irs) {
+				rep.condExpr = toIRArgument (&reps[repindex].condExpr);
+				rep.rootExpr = toIRArgument (&reps[repindex].rootExpr);
+				repindex++;
+			}
+		}
+		munmap (mapping, size);
+		compileIRConditions();
+		return true;
+	}
+
+	bool Architecture::writeSnapshot (const char* path) {
+		HList<HId> refs;
+		HList<ArchSnapshotExpression> exprs;
+		HList<IRTableArgument> args;
+		HList<ArchSnapshotRepresentation> reps;
+
+		visitRefs ([&refs] (StringRef* ref, bool memory) {
+			refs.push_back (ref->refId);
+		});
+		for (IRExpression& expr : irExpressions) {
+			if (expr.id != exprs.size() + 1) {
+				printf ("IR-Expression %d is not at index %zu\n", expr.id, exprs.size());
+				return false;
+			}
+			//the instruction ids are part of the checksum, so #rec can keep its instrId
+			exprs.push_back ({(uint32_t) expr.type, (uint32_t) expr.returntype, expr.size, expr.mod.index, (uint32_t) args.size(), (uint32_t) expr.subExpressions.size()});
+			for (IRArgument& arg : expr.subExpressions)
+				args.push_back (toIRTableArgument (arg));
+		}
+		for (auto& entry : instrdefs) {
+			for (IRRepresentation& rep : entry.second.irs) {
+				reps.push_back ({toIRTableArgument (rep.condExpr), toIRTableArgument (rep.rootExpr)});
+			}
+		}
+
+		ArchSnapshotHeader header = {};
+		header.magic = H_ARCHSNAPSHOT_MAGIC;
+		header.version = H_ARCHSNAPSHOT_VERSION;
+		header.headersize = sizeof (ArchSnapshotHeader);
+		header.checksum = getSourceChecksum();
+		//8 byte aligned sections so the mapping can be read in place
+		auto align = [] (uint64_t offset) {
+			return (offset + 7) & ~ (uint64_t) 7;
+		};
+		header.refoffset = sizeof (ArchSnapshotHeader);
+		header.refcount = refs.size();
+		header.exproffset = align (header.refoffset + refs.size() * sizeof (HId));
+		header.exprcount = exprs.size();
+		header.argoffset = align (header.exproffset + exprs.size() * sizeof (ArchSnapshotExpression));
+		header.argcount = args.size();
+		header.repoffset = align (header.argoffset + args.size() * sizeof (IRTableArgument));
+		header.repcount = reps.size();
+		header.filesize = header.repoffset + reps.size() * sizeof (ArchSnapshotRepresentation);
+
+		HList<uint8_t> buffer (header.filesize, 0);
+		memcpy (buffer.data(), &header, sizeof (ArchSnapshotHeader));
+		memcpy (buffer.data() + header.refoffset, refs.data(), refs.size() * sizeof (HId));
+		memcpy (buffer.data() + header.exproffset, exprs.data(), exprs.size() * sizeof (ArchSnapshotExpression));
+		memcpy (buffer.data() + header.argoffset, args.data(), args.size() * sizeof (IRTableArgument));
+		memcpy (buffer.data() + header.repoffset, reps.data(), reps.size() * sizeof (ArchSnapshotRepresentation));
+
+		//write to a unique temporary file next to it so concurrent workers never map or write over a half written snapshot
+		std::string tmppath = std::string (path) + ".tmp.XXXXXX";
+		int fd = mkstemp (&tmppath[0]);
+		FILE* file = fd >= 0 ? fdopen (fd, "wb") : nullptr;
+		if (!file) {
+			printf ("Could not open File %s\n", tmppath.c_str());
+			if (fd >= 0) {
+				close (fd);
+				remove (tmppath.c_str());
+			}
+			return false;
+		}
+		fchmod (fd, 0644);
+		bool written = fwrite (buffer.data(), 1, buffer.size(), file) == buffer.size();
+		written = fclose (file) == 0 && written;
+		if (!written || rename (tmppath.c_str(), path) != 0) {
+			printf ("Could not write Snapshot %s\n", path);
+			remove (tmppath.c_str());
+			return false;
+		}
+		return true;
+	}
+
+	void Architecture::initFromSnapshot (const char* path) {
+		if (loadSnapshot (path))
+			return;
+		init();
+		writeSnapshot (path);
+	}
+}
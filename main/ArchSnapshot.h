@@ -0,0 +1,49 @@
+#ifndef H_ARCHSNAPSHOT_H
+#define H_ARCHSNAPSHOT_H
+
+#include "General.h"
+#include "IRTables.h"
+
+//"HOLOARCH"
+#define H_ARCHSNAPSHOT_MAGIC (0x484352414f4c4f48ULL)
+#define H_ARCHSNAPSHOT_VERSION (1)
+
+namespace holodec {
+
+	//binary image of an initialized architecture, all sections are arrays of fixed size records
+	//the registers, stacks, memories, calling conventions and instrdefs themselves come from the source
+	//the snapshot holds everything init computes from them: the resolved references and the parsed ir
+	struct ArchSnapshotHeader {
+		uint64_t magic;
+		uint32_t version;
+		uint32_t headersize;
+		//Architecture::getSourceChecksum at the time of writing
+		uint64_t checksum;
+		uint64_t filesize;
+
+		//refIds of all StringRefs in the order of Architecture::init
+		uint64_t refoffset;
+		uint64_t refcount;
+		uint64_t exproffset;
+		uint64_t exprcount;
+		uint64_t argoffset;
+		uint64_t argcount;
+		//condExpr and rootExpr of every IRRepresentation in the order of instrdefs
+		uint64_t repoffset;
+		uint64_t repcount;
+	};
+	struct ArchSnapshotExpression {
+		uint32_t type;
+		uint32_t returntype;
+		uint64_t size;
+		uint64_t mod;
+		uint32_t argoffset;
+		uint32_t argcount;
+	};
+	struct ArchSnapshotRepresentation {
+		IRTableArgument condExpr;
+		IRTableArgument rootExpr;
+	};
+}
+
+#endif // H_ARCHSNAPSHOT_H
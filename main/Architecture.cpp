@@ -1,33 +1,62 @@
 #include "Architecture.h"
+#include "IRCondition.h"
+
+#include <algorithm>
 
 
 namespace holodec {
 
-	void Architecture::init() {
+	void Architecture::visitRefs (std::function<void (StringRef*, bool) > visitor) {
 		for (Register& reg : registers) {
-			reg.parentRef.refId = getRegister(reg.parentRef)->id;
-			reg.directParentRef.refId = getRegister(reg.directParentRef)->id;
+			visitor (&reg.parentRef, false);
+			visitor (&reg.directParentRef, false);
 		}
 		for (Stack& stack : stacks) {
-			stack.trackingReg.refId = getRegister(stack.trackingReg)->id;
-			stack.backingMem.refId = getMemory(stack.backingMem)->id;
+			visitor (&stack.trackingReg, false);
+			visitor (&stack.backingMem, true);
 			for(StringRef& ref : stack.backingRegs){
-				ref.refId = getRegister(ref)->id;
+				visitor (&ref, false);
 			}
 		}
 		for (CallingConvention& cc : callingconventions) {
-			cc.parameterCount.refId = getRegister(cc.parameterCount)->id;
+			visitor (&cc.parameterCount, false);
 			
 			for(StringRef& ref : cc.nonVolatileReg){
-				ref.refId = getRegister(ref)->id;
+				visitor (&ref, false);
 			}
 			for(CCParameter& para : cc.parameters){
-				para.regref.refId = getRegister(para.regref)->id;
+				visitor (&para.regref, false);
 			}
 			for(CCParameter& para : cc.returns){
-				para.regref.refId = getRegister(para.regref)->id;
+				visitor (&para.regref, false);
 			}
 		}
+	}
+
+	void Architecture::init() {
+		//index the registers by name-hash, getRegister searches linearly
+		HMap<uint64_t, Register*> regsByHash;
+		for (Register& reg : registers) {
+			auto it = regsByHash.find (reg.name.hash());
+			if (it == regsByHash.end())
+				regsByHash.insert (std::make_pair (reg.name.hash(), &reg));
+			else
+				it->second = nullptr;//collision
+		}
+		visitRefs ([this, &regsByHash] (StringRef* ref, bool memory) {
+			if (memory) {
+				ref->refId = getMemory (*ref)->id;
+				return;
+			}
+			if (!ref->refId && ref->name) {
+				auto it = regsByHash.find (ref->name.hash());
+				if (it != regsByHash.end() && it->second && it->second->name == ref->name) {
+					ref->refId = it->second->id;
+					return;
+				}
+			}
+			ref->refId = getRegister (*ref)->id;
+		});
 
 		instrIds.clear();
 
@@ -35,14 +64,104 @@ namespace holodec {
 			entry.second.id = entry.first;
 			HId id = entry.first;
 			instrIds.insert(id);
-			IRParser parser (this);
+		}
+		bool tablesLoaded = irTables && loadIRTables();
+		size_t parsed = 0;
+		IRParser parser (this);
+		for (auto& entry : instrdefs) {
 			for (int i = 0; i < entry.second.irs.size(); i++) {
-				if (entry.second.irs[i]) {
+				if (entry.second.irs[i] && !(tablesLoaded && mapIRTables (&entry.second.irs[i]))) {
 					parser.parse (&entry.second.irs[i]);
+					parsed++;
 				}
 			}
 		}
+		if (tablesLoaded && parsed)
+			printf ("%zu IR-Representations not in the IR-Tables of %s\n", parsed, name.cstr());
+		compileIRConditions();
 	}
-	
+
+	void Architecture::compileIRConditions() {
+		for (auto& entry : instrdefs) {
+			for (IRRepresentation& rep : entry.second.irs) {
+				if (rep && !compileIRCondition (this, rep.condExpr, &rep.condProgram))
+					printf ("Condition %s of %s is interpreted\n", rep.condstring.cstr(), entry.second.mnemonics.cstr());
+			}
+		}
+	}
+
+	uint64_t Architecture::getLayoutChecksum() {
+		uint64_t checksum = 14695981039346656037ULL;
+		auto mix = [&checksum] (uint64_t val) {
+			checksum = (checksum ^ val) * 1099511628211ULL;
+		};
+		mix (bitbase);
+		mix (wordbase);
+		for (Register& reg : registers) {
+			mix (reg.id);
+			mix (reg.name.hash());
+			mix (reg.size);
+			mix (reg.offset);
+		}
+		for (Stack& stack : stacks) {
+			mix (stack.id);
+			mix (stack.name.hash());
+			mix (stack.wordbitsize);
+		}
+		for (Memory& memory : memories) {
+			mix (memory.id);
+			mix (memory.name.hash());
+		}
+		return checksum;
+	}
+	bool Architecture::loadIRTables() {
+		if (irTables->version != H_IRTABLES_VERSION) {
+			printf ("IR-Tables of %s were generated by another version, parsing all IR-Strings\n", name.cstr());
+			return false;
+		}
+		if (irTables->checksum != getLayoutChecksum()) {
+			printf ("IR-Tables of %s do not match the Registers, parsing all IR-Strings\n", name.cstr());
+			return false;
+		}
+		irExpressions.clear();
+		for (size_t i = 0; i < irTables->expressioncount; i++) {
+			const IRTableExpression* tableexpr = &irTables->expressions[i];
+			IRExpression expr;
+			expr.type = tableexpr->type;
+			expr.size = tableexpr->size;
+			expr.returntype = tableexpr->returntype;
+			expr.mod.index = tableexpr->mod;
+			if (tableexpr->type == IR_EXPR_REC) {
+				InstrDefinition* instrdef = getInstrDef (HString (tableexpr->recmnemonic));
+				if (!instrdef) {
+					printf ("Instruction %s of IR-Tables not found, parsing all IR-Strings\n", tableexpr->recmnemonic);
+					irExpressions.clear();
+					return false;
+				}
+				expr.mod.instrId = instrdef->id;
+			}
+			for (size_t j = 0; j < tableexpr->argcount; j++) {
+				expr.subExpressions.push_back (toIRArgument (&irTables->arguments[tableexpr->argoffset + j]));
+			}
+			irExpressions.push_back (expr);
+		}
+		return true;
+	}
+	bool Architecture::mapIRTables (IRRepresentation* rep) {
+		uint64_t key = irTableKey (rep->condstring, rep->irstring);
+		const IRTableEntry* end = irTables->entries + irTables->entrycount;
+		const IRTableEntry* it = std::lower_bound (irTables->entries, end, key, [] (const IRTableEntry& entry, uint64_t key) {
+			return entry.key < key;
+		});
+		for (; it != end && it->key == key; ++it) {
+			if (rep->condstring == HString (it->condstring) && rep->irstring == HString (it->irstring)) {
+				rep->condExpr = toIRArgument (&it->condExpr);
+				rep->rootExpr = toIRArgument (&it->rootExpr);
+				return true;
+			}
+		}
+		return false;
+	}
+
 
 }
@@ -11,6 +11,7 @@
 #include "IRGen.h"
 #include "IR.h"
 #include "Memory.h"
+#include "IRTables.h"
 
 namespace holodec {
 
@@ -35,6 +36,8 @@ namespace holodec {
 		HIdMap<HId, InstrDefinition> instrdefs;
 
 		HSparseIdList<IRExpression> irExpressions;
+		//precompiled ir-expressions, representations not found in the tables are parsed
+		const IRTables* irTables = nullptr;
 
 		Architecture() = default;
 		Architecture (Architecture&) = default;
@@ -42,6 +45,22 @@ namespace holodec {
 		~Architecture() = default;
 
 		void init();
+		//visits all StringRefs that init resolves, the flag marks references to memories
+		void visitRefs (std::function<void (StringRef*, bool) > visitor);
+		//the ids in compiled ir-tables are only valid for the same layout
+		uint64_t getLayoutChecksum();
+		bool loadIRTables();
+		bool mapIRTables (IRRepresentation* rep);
+		//compiles the conditions of all representations, see IRCondition.h
+		void compileIRConditions();
+
+		//snapshot of the initialized state, see ArchSnapshot.h
+		//checksum over everything init reads, changes whenever the architecture definition changes
+		uint64_t getSourceChecksum();
+		bool loadSnapshot (const char* path);
+		bool writeSnapshot (const char* path);
+		//loads the snapshot or initializes and rewrites it if it is missing or stale
+		void initFromSnapshot (const char* path);
 
 		FunctionAnalyzer* createFunctionAnalyzer (Binary* binary) {
 			for (std::function<FunctionAnalyzer* (Binary*) >& fac : functionanalyzerfactories) {
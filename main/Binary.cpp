@@ -9,7 +9,24 @@ holodec::Binary::Binary (Data* data) : data (data) {
 }
 
 
+static void collectSections (holodec::Section* section, holodec::HSet<holodec::Section*>* sections) {
+	sections->insert (section);
+	for (holodec::Section* subsection : section->subsections)
+		collectSections (subsection, sections);
+}
+
+//the data is owned by whoever loaded it
 holodec::Binary::~Binary() {
+	for (Function* function : functions)
+		delete function;
+	for (Symbol* symbol : symbols)
+		delete symbol;
+	//a section can be a subsection of more than one other section
+	HSet<Section*> allSections;
+	for (Section* section : sections)
+		collectSections (section, &allSections);
+	for (Section* section : allSections)
+		delete section;
 }
 
 holodec::HId holodec::Binary::addSection (Section* section) {
@@ -0,0 +1,243 @@
+#include "CallGraph.h"
+
+#include "Binary.h"
+#include "Function.h"
+
+#include <inttypes.h>
+
+namespace holodec {
+
+	CallGraph::CallGraph (Binary* binary) {
+		build (binary);
+	}
+
+	void CallGraph::build (Binary* binary) {
+		this->binary = binary;
+		nodes.clear();
+		addrIndex.clear();
+		pendingCalls.clear();
+		sccs.clear();
+		sccsValid = false;
+
+		for (Function* function : binary->functions) {
+			CallGraphNode& node = nodes[function->id];
+			node.funcId = function->id;
+			node.addr = function->baseaddr;
+			addrIndex[function->baseaddr] = function->id;
+		}
+		for (Function* function : binary->functions) {
+			updateFunction (function);
+		}
+	}
+
+	void CallGraph::addFunction (Function* function) {
+		CallGraphNode& node = nodes[function->id];
+		node.funcId = function->id;
+		node.addr = function->baseaddr;
+		addrIndex[function->baseaddr] = function->id;
+
+		//resolve calls to the function that were added before it
+		auto it = pendingCalls.find (function->baseaddr);
+		if (it != pendingCalls.end()) {
+			for (HId caller : it->second) {
+				nodes[caller].unresolved.erase (function->baseaddr);
+				addEdge (caller, function->id);
+			}
+			pendingCalls.erase (it);
+		}
+		updateFunction (function);
+	}
+
+	void CallGraph::updateFunction (Function* function) {
+		CallGraphNode& node = nodes[function->id];
+		for (HId callee : node.callees)
+			nodes[callee].callers.erase (function->id);
+		node.callees.clear();
+		for (uint64_t addr : node.unresolved) {
+			auto it = pendingCalls.find (addr);
+			if (it != pendingCalls.end())
+				it->second.erase (function->id);
+		}
+		node.unresolved.clear();
+
+		for (uint64_t addr : function->funcsCalled) {
+			auto it = addrIndex.find (addr);
+			if (it != addrIndex.end()) {
+				addEdge (function->id, it->second);
+			} else {
+				node.unresolved.insert (addr);
+				pendingCalls[addr].insert (function->id);
+			}
+		}
+		sccsValid = false;
+	}
+
+	void CallGraph::addEdge (HId caller, HId callee) {
+		nodes[caller].callees.insert (callee);
+		nodes[callee].callers.insert (caller);
+		sccsValid = false;
+	}
+
+	Function* CallGraph::getFunction (uint64_t addr) {
+		auto it = addrIndex.find (addr);
+		if (it == addrIndex.end())
+			return nullptr;
+		return binary->getFunction (it->second);
+	}
+	CallGraphNode* CallGraph::getNode (HId funcId) {
+		auto it = nodes.find (funcId);
+		return it != nodes.end() ? &it->second : nullptr;
+	}
+	bool CallGraph::hasSummary (Function* caller, Function* callee) {
+		if (!callee || !callee->hasRegStates)
+			return false;
+		//the register states of a function of the same component depend on the order the component is transformed in
+		CallGraphNode* calleeNode = sccsValid && caller ? getNode (callee->id) : nullptr;
+		CallGraphNode* node = calleeNode ? getNode (caller->id) : nullptr;
+		return !node || calleeNode->sccIndex != node->sccIndex;
+	}
+
+	void CallGraph::calcSCCs() {
+		sccs.clear();
+
+		//iterative tarjan, components are completed callees first
+		struct Frame {
+			HId funcId;
+			HSet<HId>::iterator next;
+		};
+		HMap<HId, size_t> index;
+		HMap<HId, size_t> lowlink;
+		HSet<HId> onStack;
+		HList<HId> stack;
+		HList<Frame> callStack;
+		size_t counter = 0;
+
+		//roots in address order so the order of independent components does not depend on the order functions were found
+		for (auto& entry : addrIndex) {
+			if (index.find (entry.second) != index.end())
+				continue;
+			index[entry.second] = lowlink[entry.second] = counter++;
+			stack.push_back (entry.second);
+			onStack.insert (entry.second);
+			callStack.push_back ({entry.second, nodes[entry.second].callees.begin()});
+
+			while (!callStack.empty()) {
+				Frame& frame = callStack.back();
+				CallGraphNode& node = nodes[frame.funcId];
+				if (frame.next != node.callees.end()) {
+					HId callee = *frame.next++;
+					if (index.find (callee) == index.end()) {
+						index[callee] = lowlink[callee] = counter++;
+						stack.push_back (callee);
+						onStack.insert (callee);
+						callStack.push_back ({callee, nodes[callee].callees.begin()});
+					} else if (onStack.find (callee) != onStack.end()) {
+						lowlink[frame.funcId] = std::min (lowlink[frame.funcId], index[callee]);
+					}
+					continue;
+				}
+				HId funcId = frame.funcId;
+				callStack.pop_back();
+				if (!callStack.empty())
+					lowlink[callStack.back().funcId] = std::min (lowlink[callStack.back().funcId], lowlink[funcId]);
+				if (lowlink[funcId] != index[funcId])
+					continue;
+
+				CallGraphSCC scc;
+				HId member;
+				do {
+					member = stack.back();
+					stack.pop_back();
+					onStack.erase (member);
+					nodes[member].sccIndex = sccs.size();
+					scc.functions.push_back (member);
+				} while (member != funcId);
+				std::sort (scc.functions.begin(), scc.functions.end(), [this] (HId lhs, HId rhs) {
+					return nodes[lhs].addr < nodes[rhs].addr;
+				});
+				scc.recursive = scc.functions.size() > 1 || node.callees.find (funcId) != node.callees.end();
+				sccs.push_back (scc);
+			}
+		}
+		for (size_t i = 0; i < sccs.size(); i++) {
+			for (HId funcId : sccs[i].functions) {
+				for (HId callee : nodes[funcId].callees) {
+					size_t calleeIndex = nodes[callee].sccIndex;
+					if (calleeIndex != i) {
+						sccs[i].callees.insert (calleeIndex);
+						sccs[calleeIndex].callers.insert (i);
+					}
+				}
+			}
+		}
+		sccsValid = true;
+	}
+
+	void CallGraph::print (int indent) {
+		printIndent (indent);
+		printf ("Call Graph %zu Functions %zu Components\n", nodes.size(), sccs.size());
+		for (size_t i = 0; i < sccs.size(); i++) {
+			printIndent (indent + 1);
+			printf ("Component %zu%s:", i, sccs[i].recursive ? " Recursive" : "");
+			for (HId funcId : sccs[i].functions)
+				printf (" 0x%" PRIx64, nodes[funcId].addr);
+			printf ("\n");
+		}
+	}
+
+	void CallGraphScheduler::run (std::function<void (Function*, JobContext) > func, std::function<void (size_t) > finished) {
+		if (!graph->sccsValid)
+			graph->calcSCCs();
+		this->func = func;
+		this->finished = finished;
+
+		HList<size_t> ready;
+		{
+			std::unique_lock<std::mutex> lock (mutex);
+			pending.clear();
+			remaining = graph->sccs.size();
+			for (size_t i = 0; i < graph->sccs.size(); i++) {
+				pending.push_back (graph->sccs[i].callees.size());
+				if (!pending.back())
+					ready.push_back (i);
+			}
+		}
+		for (size_t sccIndex : ready)
+			queueSCC (sccIndex);
+
+		std::unique_lock<std::mutex> lock (mutex);
+		cond.wait (lock, [this]() {
+			return remaining == 0;
+		});
+	}
+
+	void CallGraphScheduler::queueSCC (size_t sccIndex) {
+		jc->queue_job ({[this, sccIndex] (JobContext context) {
+				for (HId funcId : graph->sccs[sccIndex].functions)
+					func (graph->binary->getFunction (funcId), context);
+				if (finished)
+					finished (sccIndex);
+				finishSCC (sccIndex);
+			}
+		});
+	}
+
+	void CallGraphScheduler::finishSCC (size_t sccIndex) {
+		HList<size_t> ready;
+		std::unique_lock<std::mutex> lock (mutex);
+		for (size_t caller : graph->sccs[sccIndex].callers) {
+			if (!--pending[caller])
+				ready.push_back (caller);
+		}
+		//notified with the lock held, run returns and destroys the scheduler as soon as it can take the lock
+		if (!--remaining) {
+			cond.notify_all();
+			return;
+		}
+		lock.unlock();
+
+		for (size_t caller : ready)
+			queueSCC (caller);
+	}
+
+}
@@ -0,0 +1,98 @@
+#ifndef CALLGRAPH_H
+#define CALLGRAPH_H
+
+#include "General.h"
+#include "JobController.h"
+
+#include <mutex>
+#include <condition_variable>
+
+namespace holodec {
+
+	struct Binary;
+	struct Function;
+
+	struct CallGraphNode {
+		HId funcId;
+		uint64_t addr;
+		HSet<HId> callees;
+		HSet<HId> callers;
+		//call targets that have no function yet
+		HSet<uint64_t> unresolved;
+		size_t sccIndex = 0;
+	};
+
+	//strongly connected component of the call graph, mutually recursive functions share one
+	struct CallGraphSCC {
+		//ordered by address so the functions of a component are always processed in the same order
+		HList<HId> functions;
+		HSet<size_t> callees;
+		HSet<size_t> callers;
+		bool recursive = false;
+	};
+
+	//functions of a binary and the calls between them
+	//edges are updated whenever a function is added or reanalyzed, the components are recalculated on demand
+	class CallGraph {
+	public:
+		Binary* binary = nullptr;
+
+		HMap<HId, CallGraphNode> nodes;
+		HMap<uint64_t, HId> addrIndex;
+		//call target -> functions that call it before it was added
+		HMap<uint64_t, HSet<HId>> pendingCalls;
+
+		//in bottom-up order, every component comes after all components it calls
+		HList<CallGraphSCC> sccs;
+		bool sccsValid = false;
+
+		CallGraph() = default;
+		CallGraph (Binary* binary);
+
+		void build (Binary* binary);
+		void addFunction (Function* function);
+		//rereads the called addresses of the function
+		void updateFunction (Function* function);
+
+		Function* getFunction (uint64_t addr);
+		CallGraphNode* getNode (HId funcId);
+		//if the inferred register states of the callee can be used when analyzing the caller
+		bool hasSummary (Function* caller, Function* callee);
+
+		void calcSCCs();
+
+		void print (int indent = 0);
+
+	private:
+		void addEdge (HId caller, HId callee);
+	};
+
+	//runs a job for every function in bottom-up order
+	//components without dependencies on each other run in parallel, a component is only queued when all components it calls are finished
+	class CallGraphScheduler {
+	public:
+		CallGraph* graph;
+		JobController* jc;
+
+		CallGraphScheduler (CallGraph* graph, JobController* jc) : graph (graph), jc (jc) {}
+
+		//blocks until the job has been run for every function
+		//finished is called with the index of a component after the job ran for all of its functions
+		void run (std::function<void (Function*, JobContext) > func, std::function<void (size_t) > finished = nullptr);
+
+	private:
+		std::function<void (Function*, JobContext) > func;
+		std::function<void (size_t) > finished;
+		HList<size_t> pending;
+		size_t remaining = 0;
+
+		std::mutex mutex;
+		std::condition_variable cond;
+
+		void queueSCC (size_t sccIndex);
+		void finishSCC (size_t sccIndex);
+	};
+
+}
+
+#endif // CALLGRAPH_H
@@ -0,0 +1,258 @@
+#include "DependencyTracker.h"
+
+#include "Binary.h"
+#include "Function.h"
+#include "CallGraph.h"
+
+#include <inttypes.h>
+#include <atomic>
+#include <chrono>
+
+namespace holodec {
+
+	size_t AnalysisPipeline::getFirstPass (uint32_t inputs) {
+		for (size_t i = 0; i < passInputs.size(); i++) {
+			if (passInputs[i] & inputs)
+				return i;
+		}
+		return 0;
+	}
+
+	void DependencyTracker::recordGenerated (Function* function) {
+		FunctionDependencies& deps = functions[function->id];
+		deps.generated = function->ssaRep;
+		deps.generatedFresh = true;
+		deps.ranges.clear();
+		for (DisAsmBasicBlock& bb : function->basicblocks)
+			deps.ranges.push_back (std::make_pair (bb.addr, bb.addr + bb.size));
+		deps.archVersion = archVersion;
+		deps.dirty = AnalysisLevel::eTransform;
+		deps.dirtyInputs = eInputGenerated;
+		deps.checkpoint.release();
+		deps.hasCheckpoint = false;
+		deps.released = false;
+	}
+
+	void DependencyTracker::functionAdded (Function* function) {
+		callgraph->addFunction (function);
+		markDirty (function->id, AnalysisLevel::eDisassembly);
+		//calls to the address were unknown before
+		CallGraphNode* node = callgraph->getNode (function->id);
+		for (HId caller : node->callers)
+			markDirty (caller, AnalysisLevel::eTransform, eInputCalleeSummaries);
+		//a function that starts in the code of another one ends it
+		for (auto& entry : functions) {
+			if (entry.first == function->id)
+				continue;
+			for (std::pair<uint64_t, uint64_t>& range : entry.second.ranges) {
+				if (range.first < function->baseaddr && function->baseaddr < range.second) {
+					markDirty (entry.first, AnalysisLevel::eDisassembly);
+					break;
+				}
+			}
+		}
+	}
+	void DependencyTracker::bytesChanged (uint64_t addr, uint64_t size) {
+		for (auto& entry : functions) {
+			for (std::pair<uint64_t, uint64_t>& range : entry.second.ranges) {
+				if (range.first < addr + size && addr < range.second) {
+					markDirty (entry.first, AnalysisLevel::eDisassembly);
+					break;
+				}
+			}
+		}
+	}
+	void DependencyTracker::symbolRenamed (HId symbolId) {
+		for (auto& entry : functions) {
+			if (entry.second.symbols.find (symbolId) != entry.second.symbols.end())
+				markDirty (entry.first, AnalysisLevel::eOutput);
+		}
+	}
+	void DependencyTracker::callingConventionChanged (Function* function) {
+		markDirty (function->id, AnalysisLevel::eTransform, eInputCallingConvention);
+	}
+	void DependencyTracker::jumpTableChanged (Function* function) {
+		markDirty (function->id, AnalysisLevel::eDisassembly);
+	}
+	void DependencyTracker::architectureChanged() {
+		archVersion++;
+		for (auto& entry : functions)
+			markDirty (entry.first, AnalysisLevel::eDisassembly);
+	}
+
+	void DependencyTracker::markDirty (HId funcId, AnalysisLevel level, uint32_t inputs) {
+		std::unique_lock<std::mutex> lock (mutex);
+		FunctionDependencies& deps = functions[funcId];
+		//a released function has nothing left to start from
+		if (deps.released && level != AnalysisLevel::eNone)
+			level = AnalysisLevel::eDisassembly;
+		if (level == AnalysisLevel::eTransform)
+			deps.dirtyInputs |= inputs;
+		if (deps.dirty < level)
+			deps.dirty = level;
+	}
+
+	void DependencyTracker::resetFunction (Function* function) {
+		function->basicblocks.clear();
+		function->jumptables.clear();
+		function->instructions.clear();
+		function->blockIndex.clear();
+		function->ssaRep.clear();
+		function->funcsCalled.clear();
+		function->addrToAnalyze.clear();
+		function->addrToAnalyze.push_back (function->baseaddr);
+	}
+	void DependencyTracker::recordOutput (Function* function, FunctionDependencies* deps) {
+		deps->symbols.clear();
+		deps->symbols.insert (function->symbolref);
+		CallGraphNode* node = callgraph->getNode (function->id);
+		for (HId callee : node ? node->callees : HSet<HId>())
+			deps->symbols.insert (binary->getFunction (callee)->symbolref);
+	}
+	void DependencyTracker::releaseFunction (Function* function, FunctionDependencies* deps) {
+		function->release();
+		std::unique_lock<std::mutex> lock (mutex);
+		deps->generated.release();
+		deps->generatedFresh = false;
+		deps->checkpoint.release();
+		deps->hasCheckpoint = false;
+		deps->released = true;
+		if (deps->dirty == AnalysisLevel::eOutput)
+			deps->dirty = AnalysisLevel::eNone;
+		//changed by another function of the same scc after it was transformed
+		else if (deps->dirty != AnalysisLevel::eNone)
+			deps->dirty = AnalysisLevel::eDisassembly;
+	}
+
+	size_t DependencyTracker::update (AnalysisPipeline* pipeline, JobController* jc) {
+		auto start = std::chrono::steady_clock::now();
+		HMap<HId, AnalysisLevel> recomputed;
+
+		//functions added for new call targets are disassembled in the same update
+		size_t disassembled = 0;
+		bool found;
+		do {
+			found = false;
+			for (size_t i = 0; i < binary->functions.size(); i++) {
+				Function* function = binary->functions.list[i];
+				FunctionDependencies& deps = functions[function->id];
+				if (deps.archVersion != archVersion)
+					deps.dirty = AnalysisLevel::eDisassembly;
+				if (deps.dirty != AnalysisLevel::eDisassembly)
+					continue;
+				resetFunction (function);
+				pipeline->disassemble (function);
+				recordGenerated (function);
+				callgraph->updateFunction (function);
+				recomputed[function->id] = AnalysisLevel::eDisassembly;
+				disassembled++;
+				found = true;
+			}
+		} while (found);
+
+		//the passes before the first one that reads something else than the generated ssa are only run again if that changes
+		checkpointPass = pipeline->getFirstPass (~ (uint32_t) eInputGenerated);
+		pipeline->beforePass = [this] (Function * function, size_t pass) {
+			if (pass != checkpointPass || !checkpointPass)
+				return;
+			std::unique_lock<std::mutex> lock (mutex);
+			FunctionDependencies& deps = functions[function->id];
+			deps.checkpoint = function->ssaRep;
+			deps.hasCheckpoint = true;
+		};
+
+		std::atomic<size_t> transformed (0);
+		std::atomic<size_t> printed (0);
+		if (!callgraph->sccsValid)
+			callgraph->calcSCCs();
+		CallGraphScheduler scheduler (callgraph, jc);
+		scheduler.run ([this, pipeline, &transformed, &printed, &recomputed] (Function * function, JobContext context) {
+			FunctionDependencies* deps;
+			{
+				std::unique_lock<std::mutex> lock (mutex);
+				auto it = functions.find (function->id);
+				//a function released in this update is disassembled again by the next one
+				if (it == functions.end() || it->second.dirty < AnalysisLevel::eTransform || it->second.released)
+					return;
+				deps = &it->second;
+			}
+			//only the passes that read a changed input and the ones after them run again
+			size_t firstPass = 0;
+			if (!deps->generatedFresh && ! (deps->dirtyInputs & eInputGenerated) && deps->hasCheckpoint && pipeline->getFirstPass (deps->dirtyInputs) >= checkpointPass) {
+				function->ssaRep = deps->checkpoint;
+				firstPass = checkpointPass;
+			} else if (!deps->generatedFresh) {
+				function->ssaRep = deps->generated;
+			}
+			deps->generatedFresh = false;
+			deps->dirtyInputs = 0;
+			pipeline->transform (function, context, firstPass);
+			transformed++;
+
+			//callers depend on the summary, they are scheduled after this function
+			uint64_t hash = function->calcSummaryHash();
+			HSet<HId> callers;
+			CallGraphNode* node = callgraph->getNode (function->id);
+			if (node && hash != deps->summaryHash)
+				callers = node->callers;
+			{
+				std::unique_lock<std::mutex> lock (mutex);
+				deps->summaryHash = hash;
+				deps->dirty = AnalysisLevel::eOutput;
+				if (recomputed.find (function->id) == recomputed.end())
+					recomputed[function->id] = AnalysisLevel::eTransform;
+			}
+			for (HId caller : callers) {
+				if (caller != function->id)
+					markDirty (caller, AnalysisLevel::eTransform, eInputCalleeSummaries);
+			}
+		}, [this, pipeline, &printed, &recomputed] (size_t sccIndex) {
+			if (!streaming)
+				return;
+			//the callers only need the summary, so the results are final once the functions of the same component that can still change them are done
+			//functions that were changed by a later one of the component stay for the output at the end
+			for (HId funcId : callgraph->sccs[sccIndex].functions) {
+				FunctionDependencies* deps;
+				{
+					std::unique_lock<std::mutex> lock (mutex);
+					auto it = functions.find (funcId);
+					if (it == functions.end() || it->second.dirty != AnalysisLevel::eOutput || it->second.released)
+						continue;
+					deps = &it->second;
+					if (recomputed.find (funcId) == recomputed.end())
+						recomputed[funcId] = AnalysisLevel::eOutput;
+				}
+				Function* function = binary->getFunction (funcId);
+				pipeline->output (function);
+				recordOutput (function, deps);
+				releaseFunction (function, deps);
+				printed++;
+			}
+		});
+
+		for (Function* function : binary->functions) {
+			FunctionDependencies& deps = functions[function->id];
+			if (deps.dirty < AnalysisLevel::eOutput || deps.released)
+				continue;
+			pipeline->output (function);
+			recordOutput (function, &deps);
+			if (recomputed.find (function->id) == recomputed.end())
+				recomputed[function->id] = AnalysisLevel::eOutput;
+			deps.dirty = AnalysisLevel::eNone;
+			if (streaming)
+				releaseFunction (function, &deps);
+			printed++;
+		}
+
+		if (!verbose)
+			return recomputed.size();
+		double ms = std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now() - start).count();
+		printf ("Recomputed %zu of %zu Functions, %zu disassembled, %zu transformed, %zu printed in %.3f ms\n", recomputed.size(), binary->functions.size(), disassembled, transformed.load(), printed.load(), ms);
+		for (auto& entry : recomputed) {
+			const char* level = entry.second == AnalysisLevel::eDisassembly ? "Disassembly" : entry.second == AnalysisLevel::eTransform ? "Transform" : "Output";
+			printf ("\tFunction at Address 0x%" PRIx64 " from %s\n", binary->getFunction (entry.first)->baseaddr, level);
+		}
+		return recomputed.size();
+	}
+
+}
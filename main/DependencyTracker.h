@@ -0,0 +1,117 @@
+#ifndef DEPENDENCYTRACKER_H
+#define DEPENDENCYTRACKER_H
+
+#include "General.h"
+#include "SSA.h"
+#include "JobController.h"
+
+#include <mutex>
+
+namespace holodec {
+
+	struct Binary;
+	struct Function;
+	class CallGraph;
+
+	//how much of the analysis of a function has to be redone, every level includes the ones below
+	enum class AnalysisLevel {
+		eNone = 0,
+		//symbol names changed
+		eOutput,
+		//an input of the passes changed, the generated ssa is still valid
+		eTransform,
+		//the code of the function changed
+		eDisassembly
+	};
+
+	//what the passes of the transform read besides the output of the pass before them
+	enum AnalysisInput : uint32_t {
+		//the generated ssa, only read by the first pass
+		eInputGenerated = 0x1,
+		eInputCalleeSummaries = 0x2,
+		eInputCallingConvention = 0x4,
+	};
+
+	//the steps of the analysis of one function
+	struct AnalysisPipeline {
+		//fills the function from addrToAnalyze and adds functions for new call targets
+		std::function<void (Function*) > disassemble;
+		//runs the ssa transformers starting with the pass firstPass, callees are always transformed before their callers
+		std::function<void (Function*, JobContext, size_t) > transform;
+		std::function<void (Function*) > output;
+		//the AnalysisInputs every pass reads, transform calls beforePass with the index of every pass it runs
+		HList<uint32_t> passInputs;
+		std::function<void (Function*, size_t) > beforePass;
+
+		//the first pass that reads one of the inputs
+		size_t getFirstPass (uint32_t inputs);
+	};
+
+	//what the results of a function were computed from
+	struct FunctionDependencies {
+		AnalysisLevel dirty = AnalysisLevel::eNone;
+		//the ssa as it was generated, the transformers start from it if the function was not disassembled again
+		SSARepresentation generated;
+		bool generatedFresh = false;
+		//the AnalysisInputs that changed since the last transform
+		uint32_t dirtyInputs = 0;
+		//the ssa before the first pass that reads anything but the generated ssa
+		//a change that only affects the passes from there on runs them again from it
+		SSARepresentation checkpoint;
+		bool hasCheckpoint = false;
+		//address ranges of the disassembled code
+		HList<std::pair<uint64_t, uint64_t>> ranges;
+		//symbols whose names are part of the output
+		HSet<HId> symbols;
+		uint64_t archVersion = 0;
+		//hash of the inferred calling convention and stack usage callers depend on
+		uint64_t summaryHash = 0;
+		//only the summary of the function is left, any change disassembles it again
+		bool released = false;
+	};
+
+	//records what the results of every function depend on and recomputes only the functions and steps a change invalidates
+	//changes of a summary are passed on to the callers while the functions are transformed callees first
+	class DependencyTracker {
+	public:
+		Binary* binary;
+		CallGraph* callgraph;
+		uint64_t archVersion = 0;
+		HMap<HId, FunctionDependencies> functions;
+		//prints which functions were recomputed
+		bool verbose = true;
+		//outputs every function as soon as it is transformed and releases its disassembly and ssa
+		//so the memory does not grow with the number of functions
+		bool streaming = false;
+
+		DependencyTracker (Binary* binary, CallGraph* callgraph) : binary (binary), callgraph (callgraph) {}
+
+		//called by the pipeline after a function was disassembled
+		void recordGenerated (Function* function);
+
+		void functionAdded (Function* function);
+		void bytesChanged (uint64_t addr, uint64_t size);
+		void symbolRenamed (HId symbolId);
+		void callingConventionChanged (Function* function);
+		void jumpTableChanged (Function* function);
+		void architectureChanged();
+
+		//inputs are the AnalysisInputs that changed for eTransform
+		void markDirty (HId funcId, AnalysisLevel level, uint32_t inputs = eInputGenerated);
+
+		//recomputes every dirty function, returns the number of recomputed functions
+		size_t update (AnalysisPipeline* pipeline, JobController* jc);
+
+	private:
+		std::mutex mutex;
+		//the pass the checkpoint is taken before
+		size_t checkpointPass = 0;
+
+		void resetFunction (Function* function);
+		void releaseFunction (Function* function, FunctionDependencies* deps);
+		void recordOutput (Function* function, FunctionDependencies* deps);
+	};
+
+}
+
+#endif // DEPENDENCYTRACKER_H
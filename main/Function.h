@@ -7,6 +7,9 @@
 
 #include "Argument.h"
 
+#include <algorithm>
+#include <inttypes.h>
+
 
 
 #define HINSTRUCTION_MAX_OPERANDS (4)
@@ -26,6 +29,126 @@ namespace holodec {
 
 		void print (Architecture* arch, int indent = 0);
 	};
+	//jump or call target of the instruction at index in the list
+	struct InstructionDest {
+		uint32_t index;
+		uint64_t addr;
+	};
+	enum InstructionListFlags : uint8_t {
+		eInstructionFallthrough = 0x1,
+		eInstructionJump = 0x2,
+		eInstructionCall = 0x4,
+	};
+	//the instructions of a function with one array per field, the operands of all instructions share one pool
+	//the fall through is always the end of the instruction and only flagged, jump and call targets are only stored for the instructions that have one
+	//an Instruction is only put together where a whole instruction is needed
+	struct InstructionList {
+		HList<uint64_t> addrs;
+		HList<uint8_t> sizes;
+		HList<uint8_t> operandCounts;
+		HList<uint32_t> operandOffsets;
+		HList<InstrDefinition*> instrdefs;
+		HList<uint8_t> flags;
+		//sorted by index
+		HList<InstructionDest> jumpdests;
+		HList<InstructionDest> calldests;
+		HList<IRArgument> operands;
+
+		size_t size() {
+			return addrs.size();
+		}
+		bool empty() {
+			return addrs.empty();
+		}
+		void reserve (size_t count) {
+			addrs.reserve (count);
+			sizes.reserve (count);
+			operandCounts.reserve (count);
+			operandOffsets.reserve (count);
+			instrdefs.reserve (count);
+			flags.reserve (count);
+		}
+		void push_back (Instruction* instruction) {
+			addrs.push_back (instruction->addr);
+			sizes.push_back (instruction->size);
+			operandCounts.push_back (instruction->operands.size());
+			operandOffsets.push_back (operands.size());
+			instrdefs.push_back (instruction->instrdef);
+			pushDests (instruction->nojumpdest, instruction->jumpdest, instruction->calldest);
+			for (size_t i = 0; i < instruction->operands.size(); i++)
+				operands.push_back (instruction->operands[i]);
+		}
+		//adds the flags and targets of the last instruction, the other arrays have to be filled already
+		void pushDests (uint64_t nojumpdest, uint64_t jumpdest, uint64_t calldest) {
+			uint32_t index = flags.size();
+			flags.push_back ( (nojumpdest ? eInstructionFallthrough : 0) | (jumpdest ? eInstructionJump : 0) | (calldest ? eInstructionCall : 0));
+			if (jumpdest)
+				jumpdests.push_back ({index, jumpdest});
+			if (calldest)
+				calldests.push_back ({index, calldest});
+		}
+		void get (size_t index, Instruction* instruction) {
+			instruction->addr = addrs[index];
+			instruction->size = sizes[index];
+			instruction->instrdef = instrdefs[index];
+			instruction->nojumpdest = getFallthrough (index);
+			instruction->jumpdest = getJumpDest (index);
+			instruction->calldest = getCallDest (index);
+			instruction->operands = HLocalBackedList<IRArgument, HINSTRUCTION_MAX_OPERANDS>();
+			for (size_t i = 0; i < operandCounts[index]; i++)
+				instruction->operands.push_back (operands[operandOffsets[index] + i]);
+		}
+		IRArgument* getOperands (size_t index) {
+			return operands.data() + operandOffsets[index];
+		}
+		uint64_t getEnd (size_t index) {
+			return addrs[index] + sizes[index];
+		}
+		uint64_t getFallthrough (size_t index) {
+			return flags[index] & eInstructionFallthrough ? getEnd (index) : 0;
+		}
+		uint64_t getJumpDest (size_t index) {
+			return flags[index] & eInstructionJump ? findDest (jumpdests, index) : 0;
+		}
+		uint64_t getCallDest (size_t index) {
+			return flags[index] & eInstructionCall ? findDest (calldests, index) : 0;
+		}
+		//memory of the arrays for the statistics
+		size_t getByteSize() {
+			return addrs.capacity() * sizeof (uint64_t) + sizes.capacity() + operandCounts.capacity() + operandOffsets.capacity() * sizeof (uint32_t) +
+			       instrdefs.capacity() * sizeof (InstrDefinition*) + flags.capacity() + (jumpdests.capacity() + calldests.capacity()) * sizeof (InstructionDest) +
+			       operands.capacity() * sizeof (IRArgument);
+		}
+		void clear() {
+			addrs.clear();
+			sizes.clear();
+			operandCounts.clear();
+			operandOffsets.clear();
+			instrdefs.clear();
+			flags.clear();
+			jumpdests.clear();
+			calldests.clear();
+			operands.clear();
+		}
+		void release() {
+			HList<uint64_t>().swap (addrs);
+			HList<uint8_t>().swap (sizes);
+			HList<uint8_t>().swap (operandCounts);
+			HList<uint32_t>().swap (operandOffsets);
+			HList<InstrDefinition*>().swap (instrdefs);
+			HList<uint8_t>().swap (flags);
+			HList<InstructionDest>().swap (jumpdests);
+			HList<InstructionDest>().swap (calldests);
+			HList<IRArgument>().swap (operands);
+		}
+	private:
+		static uint64_t findDest (HList<InstructionDest>& dests, size_t index) {
+			auto it = std::lower_bound (dests.begin(), dests.end(), index, [] (const InstructionDest & dest, size_t index) {
+				return dest.index < index;
+			});
+			return it != dests.end() && it->index == index ? it->addr : 0;
+		}
+	};
 	struct JumpTable {
 		struct HEntry {
 			uint64_t addr;//where the entry is in memory
@@ -39,16 +162,18 @@ namespace holodec {
 
 		void print (int indent = 0) {
 			printIndent (indent);
-			printf ("JumpTable \n");
+			printf ("JumpTable 0x%" PRIx64 "\n", addr);
 			for (HEntry& entry : entries) {
 				printIndent (indent + 1);
-				printf ("0x%X", entry.addr);
+				printf ("0x%" PRIx64 " -> 0x%" PRIx64 "\n", entry.addr, entry.targetaddr);
 			}
 		}
 	};
 	struct DisAsmBasicBlock {
 		HId id;
-		HList<Instruction> instructions;
+		//range of the instructions of this block in Function::instructions
+		size_t instrOffset;
+		size_t instrCount;
 		HId nextblock;
 		HId nextcondblock;
 
@@ -57,10 +182,13 @@ namespace holodec {
 		uint64_t addr;
 		uint64_t size;
 
-		void print (Architecture* arch, int indent = 0) {
+		void print (Architecture* arch, InstructionList& instructions, int indent = 0) {
+			size_t last = instrOffset + instrCount - 1;
 			printIndent (indent);
-			printf ("BB 0x%x-0x%x t:0x%x f:0x%x\n", addr, addr + size, instructions.back().jumpdest, instructions.back().nojumpdest);
-			for (Instruction& instruction : instructions) {
+			printf ("BB 0x%" PRIx64 "-0x%" PRIx64 " t:0x%" PRIx64 " f:0x%" PRIx64 "\n", addr, addr + size, instructions.getJumpDest (last), instructions.getFallthrough (last));
+			Instruction instruction;
+			for (size_t i = instrOffset; i < instrOffset + instrCount; i++) {
+				instructions.get (i, &instruction);
 				instruction.print (arch, indent + 1);
 			}
 		}
@@ -68,8 +196,11 @@ namespace holodec {
 	// Unknown -> FunctionRead
 	enum class RegisterUsedFlag{
 		eNone	= 0x0,
+		//changed when the function returns
 		eWrite	= 0x1,
+		//value at entry is used, the register is a parameter
 		eRead	= 0x2,
+		//changed and returned to the caller
 		eFuncWrite	= 0x4,
 		eFuncRead	= 0x8,
 	};
@@ -84,7 +215,15 @@ namespace holodec {
 		HId callingconvention;
 		uint64_t baseaddr;
 		
+		//filled by the calling convention inference, callers use them instead of the calling convention
 		HList<RegisterState> regStates;
+		bool hasRegStates = false;
+		//change of the stackpointer from entry to return, only valid if it is the same for every return
+		int64_t stackAdjust = 0;
+		bool stackAdjustKnown = false;
+		//end of the memory above the stackpointer at entry that the function and its callees read
+		int64_t stackReadEnd = 0;
+		bool stackReadEndKnown = false;
 		HList<uint64_t> funcsCalled;
 		HList<uint64_t> funcsCall;
 		
@@ -93,40 +232,101 @@ namespace holodec {
 		SSARepresentation ssaRep;
 
 		HList<uint64_t> addrToAnalyze;
-		
+
+		//instructions of all blocks, each block owns a contiguous range ordered by address
+		InstructionList instructions;
+		//start address -> block id, blocks are assumed not to overlap
+		HMap<uint64_t, HId> blockIndex;
+
+		RegisterState* getRegisterState (HId regId) {
+			for (RegisterState& state : regStates) {
+				if (state.regId == regId)
+					return &state;
+			}
+			return nullptr;
+		}
+		//hash of the inferred calling convention and stack usage callers depend on
+		uint64_t calcSummaryHash() {
+			uint64_t hash = 0xcbf29ce484222325ULL;
+			auto mix = [&hash] (uint64_t val) {
+				hash = (hash ^ val) * 0x100000001b3ULL;
+			};
+			mix (callingconvention);
+			mix (hasRegStates);
+			for (RegisterState& state : regStates) {
+				mix (state.regId);
+				mix ((uint64_t) state.flags);
+			}
+			mix (stackAdjustKnown ? stackAdjust : INT64_MIN);
+			mix (stackReadEndKnown ? stackReadEnd : INT64_MIN);
+			return hash;
+		}
 		DisAsmBasicBlock* findBasicBlock (size_t addr) {
 			if (addr) {
-				for (DisAsmBasicBlock& bb : basicblocks) {
-					if (bb.addr == addr)
-						return &bb;
-				}
+				auto it = blockIndex.find (addr);
+				if (it != blockIndex.end())
+					return basicblocks.get (it->second);
 			}
 			return nullptr;
 		}
-		DisAsmBasicBlock* findBasicBlockDeep (size_t addr) {
+		DisAsmBasicBlock* findBasicBlockContaining (size_t addr) {
 			if (addr) {
-				for (DisAsmBasicBlock& bb : basicblocks) {
-					if (bb.addr == addr)
-						return &bb;
-					if (bb.addr <= addr && addr < (bb.addr + bb.size)) {
-						for (Instruction& instr : bb.instructions) {
-							if (instr.addr == addr)
-								return &bb;
-						}
-					}
+				auto it = blockIndex.upper_bound (addr);
+				if (it != blockIndex.begin()) {
+					DisAsmBasicBlock* bb = basicblocks.get ( (--it)->second);
+					if (addr < bb->addr + bb->size)
+						return bb;
 				}
 			}
 			return nullptr;
 		}
+		//index of the instruction at the address in the block
+		bool findInstruction (DisAsmBasicBlock* bb, size_t addr, size_t* index) {
+			auto begin = instructions.addrs.begin() + bb->instrOffset;
+			auto end = begin + bb->instrCount;
+			auto it = std::lower_bound (begin, end, addr);
+			if (it == end || *it != addr)
+				return false;
+			*index = it - instructions.addrs.begin();
+			return true;
+		}
+		DisAsmBasicBlock* findBasicBlockDeep (size_t addr) {
+			DisAsmBasicBlock* bb = findBasicBlockContaining (addr);
+			size_t index;
+			if (bb && findInstruction (bb, addr, &index))
+				return bb;
+			return nullptr;
+		}
 
 		HId addBasicBlock (DisAsmBasicBlock basicblock) {
-			return basicblocks.push_back (basicblock);
+			HId id = basicblocks.push_back (basicblock);
+			blockIndex[basicblock.addr] = id;
+			return id;
 		}
 		void clear() {
 			id = 0;
 			symbolref = 0;
 			basicblocks.clear();
+			jumptables.clear();
+			instructions.clear();
+			blockIndex.clear();
 			ssaRep.clear();
+			regStates.clear();
+			hasRegStates = false;
+			stackAdjust = 0;
+			stackAdjustKnown = false;
+			stackReadEnd = 0;
+			stackReadEndKnown = false;
+		}
+		//frees the disassembly and the ssa after the function was written out
+		//the summary and the called functions stay for the callers
+		void release() {
+			basicblocks.release();
+			jumptables.release();
+			instructions.release();
+			HMap<uint64_t, HId>().swap (blockIndex);
+			ssaRep.release();
+			HList<uint64_t>().swap (addrToAnalyze);
 		}
 
 		void print (Architecture* arch, int indent = 0) {
@@ -139,7 +339,10 @@ namespace holodec {
 			}
 			printf ("\n");
 			for (DisAsmBasicBlock& bb : basicblocks) {
-				bb.print (arch, indent + 1);
+				bb.print (arch, instructions, indent + 1);
+			}
+			for (JumpTable& table : jumptables) {
+				table.print (indent + 1);
 			}
 			
 			ssaRep.print(arch, indent + 1);
@@ -1,8 +1,12 @@
 #include "FunctionAnalyzer.h"
 #include "Binary.h"
+#include "Architecture.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include <inttypes.h>
 #include <assert.h>
 
-holodec::FunctionAnalyzer::FunctionAnalyzer (Architecture* arch) : binary (0), arch (arch), ssaGen (arch) {
+holodec::FunctionAnalyzer::FunctionAnalyzer (Architecture* arch) : binary (0), arch (arch), ssaGen (arch), jumpTableResolver (arch) {
 }
 
 holodec::FunctionAnalyzer::~FunctionAnalyzer() {
@@ -21,13 +25,16 @@ void holodec::FunctionAnalyzer::prepareBuffer (uint64_t addr) {
 bool holodec::FunctionAnalyzer::postInstruction (Instruction* instruction) {
 	/*if (state.function->findBasicBlockDeep (instruction->addr + instruction->size))
 		return false;*/
-	state.instructions.push_back (*instruction);
+	state.function->instructions.push_back (instruction);
+	H_PROFILE_COUNT (eProfileInstructions, 1);
 	if (analyzeWithIR && ssaGen.parseInstruction(instruction)) {
 		if (ssaGen.endOfBlock) {
 			if (instruction->jumpdest)
 				addAddressToAnalyze (instruction->jumpdest);
 			if (instruction->nojumpdest)
 				addAddressToAnalyze (instruction->nojumpdest);
+			if (!instruction->jumpdest && instruction->instrdef->type == InstructionType::eJmp)
+				resolveJumpTable (instruction);
 			return false;
 		}
 		return instruction->nojumpdest ? !trySplitBasicBlock(instruction->nojumpdest) : true;
@@ -52,66 +59,79 @@ bool holodec::FunctionAnalyzer::changedBasicBlock (DisAsmBasicBlock* basicblock)
 
 }
 bool holodec::FunctionAnalyzer::splitBasicBlock (DisAsmBasicBlock* basicblock, uint64_t splitaddr) {
-	for (auto instrit = basicblock->instructions.begin(); instrit != basicblock->instructions.end(); instrit++) {
-		Instruction& instruction = *instrit;
-		if (splitaddr != instruction.addr)
-			continue;
-		
-		DisAsmBasicBlock newbb = {
-			0,
-			HList<Instruction> (instrit, basicblock->instructions.end()),
-			basicblock->nextblock,
-			basicblock->nextcondblock,
-			basicblock->jumptable,
-			instruction.addr,
-			(basicblock->addr + basicblock->size) - instruction.addr
-		};
-		basicblock->size = basicblock->size - newbb.size;
-		basicblock->nextblock = 0;
-		basicblock->nextcondblock = 0;
-		basicblock->jumptable = 0;
-		basicblock->instructions.erase (instrit, basicblock->instructions.end());
-		changedBasicBlock (basicblock);
-		this->postBasicBlock(&newbb);
-
-		if (analyzeWithIR)
-			assert (ssaGen.splitBasicBlock (splitaddr));
-		return true;
-	}
-	return false;
+	size_t instrIndex;
+	if (!state.function->findInstruction (basicblock, splitaddr, &instrIndex))
+		return false;
+	//the new block takes over the tail of the instruction range, nothing is copied
+	DisAsmBasicBlock newbb = {
+		0,
+		instrIndex,
+		basicblock->instrOffset + basicblock->instrCount - instrIndex,
+		basicblock->nextblock,
+		basicblock->nextcondblock,
+		basicblock->jumptable,
+		splitaddr,
+		(basicblock->addr + basicblock->size) - splitaddr
+	};
+	basicblock->size = basicblock->size - newbb.size;
+	basicblock->instrCount = basicblock->instrCount - newbb.instrCount;
+	basicblock->nextblock = 0;
+	basicblock->nextcondblock = 0;
+	basicblock->jumptable = 0;
+	changedBasicBlock (basicblock);
+	this->postBasicBlock (&newbb);
+
+	if (analyzeWithIR)
+		assert (ssaGen.splitBasicBlock (splitaddr));
+	return true;
 }
 bool holodec::FunctionAnalyzer::trySplitBasicBlock (uint64_t splitaddr) {
-	for (DisAsmBasicBlock& basicblock : state.function->basicblocks) {
-		if (basicblock.addr == splitaddr)
-			return true;
-		if (basicblock.addr <= splitaddr && splitaddr < (basicblock.addr + basicblock.size)){
-			if (splitBasicBlock (&basicblock, splitaddr)) {
-				return true;
-			}
-		}
-	}
-	return false;
+	if (state.function->findBasicBlock (splitaddr))
+		return true;
+	DisAsmBasicBlock* basicblock = state.function->findBasicBlockContaining (splitaddr);
+	return basicblock && splitBasicBlock (basicblock, splitaddr);
 }
 void holodec::FunctionAnalyzer::addAddressToAnalyze (uint64_t addr) {
 	if (std::find (state.function->addrToAnalyze.begin(), state.function->addrToAnalyze.end(), addr) == state.function->addrToAnalyze.end()) {
-		printf ("Add Address for Analyze 0x%x\n", addr);
+		H_LOG_TRACE (eLogAnalysis, "Add Address for Analyze 0x%" PRIx64 "\n", addr);
 		state.function->addrToAnalyze.push_back (addr);
 	}
 }
 
+bool holodec::FunctionAnalyzer::resolveJumpTable (Instruction* instruction) {
+	SSABB* block = ssaGen.getActiveBlock();
+	JumpTable* table = jumpTableResolver.resolve (binary, state.function, block, instruction->addr);
+	if (!table)
+		return false;
+	H_LOG_DEBUG (eLogAnalysis, "Resolved Jump-Table at 0x%" PRIx64 " with %zu Entries\n", table->addr, table->entries.size());
+	state.jumptable = state.function->jumptables.push_back (*table);
+
+	//the jump becomes a branch to all targets of the table, the computed address selects the target
+	SSAExpression* jmpExpr = state.function->ssaRep.expressions.get (block->exprIds.back());
+	jmpExpr->type = SSAExprType::eMultiBranch;
+	for (JumpTable::HEntry& entry : table->entries) {
+		jmpExpr->subExpressions.push_back (SSAArgument::createVal (entry.targetaddr, arch->bitbase));
+		addAddressToAnalyze (entry.targetaddr);
+	}
+	return true;
+}
+
 void holodec::FunctionAnalyzer::preAnalysis() {
-	printf ("Pre Analysis\n");
+	H_LOG_DEBUG (eLogAnalysis, "Pre Analysis\n");
 }
 void holodec::FunctionAnalyzer::postAnalysis() {
-	printf ("Post Analysis\n");
+	H_LOG_DEBUG (eLogAnalysis, "Post Analysis\n");
+	H_LOG_INFO (eLogAnalysis, "Jump-Tables: %zu Slices %zu Cache-Hits\n", jumpTableResolver.slices, jumpTableResolver.hits);
+	size_t templateLookups = ssaGen.templateHits + ssaGen.templateMisses + ssaGen.templateUncacheable;
+	H_LOG_INFO (eLogAnalysis, "SSA-Templates: %zu Templates %zu Hits %zu Misses %zu Uncacheable (%.1f%% Hit-Rate)\n", ssaGen.templates.size(), ssaGen.templateHits, ssaGen.templateMisses, ssaGen.templateUncacheable,
+	        templateLookups ? 100.0 * ssaGen.templateHits / templateLookups : 0.0);
 }
 
 bool holodec::FunctionAnalyzer::analyzeFunction (Function* function) {
 	state.reset();
 	state.function = function;
 	Symbol* functionsymbol = binary->getSymbol (function->symbolref);
-	printf ("Analyzing Function %s\n", functionsymbol->name.cstr());
-	printf ("At Address 0x%x\n", functionsymbol->vaddr);
+	H_LOG_DEBUG (eLogAnalysis, "Analyzing Function %s at Address 0x%" PRIx64 "\n", functionsymbol->name.cstr(), functionsymbol->vaddr);
 
 	preAnalysis();
 
@@ -124,19 +144,27 @@ bool holodec::FunctionAnalyzer::analyzeFunction (Function* function) {
 			continue;
 		
 		ssaGen.activateBlock (ssaGen.createNewBlock());
+		state.jumptable = 0;
 		
+		size_t instrOffset = state.function->instructions.size();
 		if(!analyzeInsts (addr)){
 			return false;
 		}
 		
-		if (state.instructions.empty())
+		size_t instrCount = state.function->instructions.size() - instrOffset;
+		if (!instrCount)
 			continue;
 			
-		Instruction* firstI = &state.instructions.front();
-		Instruction* lastI = &state.instructions.back();
-		DisAsmBasicBlock basicblock = {0, state.instructions, 0, 0, 0, firstI->addr, (lastI->addr + lastI->size) - firstI->addr};
+		InstructionList& instructions = state.function->instructions;
+		uint64_t startaddr = instructions.addrs[instrOffset];
+		DisAsmBasicBlock basicblock = {0, instrOffset, instrCount, 0, 0, state.jumptable, startaddr, instructions.getEnd (instructions.size() - 1) - startaddr};
 		postBasicBlock (&basicblock);
-		state.instructions.clear();
+	}
+	for (JumpTable& table : state.function->jumptables) {
+		for (JumpTable::HEntry& entry : table.entries) {
+			DisAsmBasicBlock* bb = state.function->findBasicBlock (entry.targetaddr);
+			entry.bb_id = bb ? bb->id : 0;
+		}
 	}
 	postAnalysis();
 	return true;
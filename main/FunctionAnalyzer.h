@@ -6,6 +6,7 @@
 #include "General.h"
 #include <algorithm>
 #include "SSAGen.h"
+#include "JumpTableResolver.h"
 
 namespace holodec {
 
@@ -17,6 +18,7 @@ namespace holodec {
 		Architecture* arch;
 		Binary* binary;
 		SSAGen ssaGen;
+		JumpTableResolver jumpTableResolver;
 		
 		bool analyzeWithIR = true;
 
@@ -24,14 +26,15 @@ namespace holodec {
 			uint8_t dataBuffer[H_FUNC_ANAL_BUFFERSIZE];
 			size_t bufferSize;
 			size_t maxInstr;
-			HList<Instruction> instructions;
 			Function* function;
+			//jump table of the block that is analyzed
+			HId jumptable;
 
 			void reset() {
 				bufferSize = 0;
 				maxInstr = 0;
-				instructions.clear();
 				function = nullptr;
+				jumptable = 0;
 			}
 		} state;
 
@@ -44,6 +47,8 @@ namespace holodec {
 		virtual bool terminate() = 0;
 
 		virtual HList<Function*> analyzeFunctions (HList<Symbol*>* functionsymbols);
+		//finds entry points of functions that are not covered by symbols
+		virtual void scanFunctionStarts (HSet<uint64_t>* addresses) {}
 
 
 		void prepareBuffer (uint64_t addr);
@@ -55,6 +60,7 @@ namespace holodec {
 		bool splitBasicBlock (DisAsmBasicBlock* basicblock, uint64_t splitaddr);
 		bool trySplitBasicBlock (uint64_t splitaddr);
 		void addAddressToAnalyze(uint64_t addr);
+		bool resolveJumpTable (Instruction* instruction);
 
 		virtual void preAnalysis();
 
@@ -0,0 +1,726 @@
+#include "FunctionCache.h"
+#include "Binary.h"
+#include "Architecture.h"
+#include "CallGraph.h"
+#include "Profiler.h"
+
+#include <inttypes.h>
+#include <algorithm>
+#include <functional>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <utime.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace holodec {
+
+	static const size_t cacheElementSizes[eCacheColumnCount] = {
+		sizeof (FunctionCacheRange),
+		sizeof (FunctionCacheSpan),
+		sizeof (FunctionCacheReloc),
+		sizeof (ProjectDBRegState),
+		sizeof (ProjectDBBlock),
+		sizeof (ProjectDBInstruction),
+		sizeof (IRTableArgument),
+		sizeof (ProjectDBSSABlock),
+		sizeof (HId),
+		sizeof (ProjectDBSSAExpression),
+		sizeof (ProjectDBSSAArgument),
+	};
+
+	static uint64_t hashCombine (uint64_t hash, uint64_t value) {
+		return (hash ^ value) * 0x100000001b3ULL;
+	}
+	static bool isEntryName (const char* name) {
+		return strlen (name) == 16 && strspn (name, "0123456789abcdef") == 16;
+	}
+	//unique per call, several caches in one process may write the same entry
+	static FILE* openTempFile (const std::string& path, std::string* tmppath) {
+		*tmppath = path + ".tmp.XXXXXX";
+		int fd = mkstemp (&(*tmppath)[0]);
+		if (fd < 0)
+			return nullptr;
+		fchmod (fd, 0644);
+		FILE* file = fdopen (fd, "wb");
+		if (!file) {
+			close (fd);
+			remove (tmppath->c_str());
+		}
+		return file;
+	}
+	//the constants are relocated with the instruction they are computed by
+	static void relocateSSA (SSARepresentation* ssaRep, std::function<uint64_t (uint64_t) > move, std::function<uint64_t (uint64_t, uint64_t) > relocate) {
+		for (SSAExpression& expr : ssaRep->expressions) {
+			for (SSAArgument& arg : expr.subExpressions) {
+				if (arg.type == SSAArgType::eUInt || arg.type == SSAArgType::eSInt)
+					arg.uval = relocate (expr.instrAddr, arg.uval);
+			}
+			expr.instrAddr = move (expr.instrAddr);
+		}
+		for (SSABB& bb : ssaRep->bbs) {
+			bb.startaddr = move (bb.startaddr);
+			bb.endaddr = move (bb.endaddr);
+		}
+	}
+
+	std::string FunctionCacheStore::getEntryPath (uint64_t key) {
+		char name[20];
+		snprintf (name, sizeof (name), "%016" PRIx64, key);
+		return path + "/" + name;
+	}
+
+	int FunctionCacheStore::lockIndex (int operation) {
+		int fd = ::open ( (path + "/lock").c_str(), O_RDWR | O_CREAT, 0644);
+		if (fd >= 0)
+			flock (fd, operation);
+		return fd;
+	}
+	void FunctionCacheStore::unlockIndex (int fd) {
+		if (fd < 0)
+			return;
+		flock (fd, LOCK_UN);
+		close (fd);
+	}
+
+	bool FunctionCacheStore::open (const char* path, uint64_t maxsize) {
+		if (mkdir (path, 0755) != 0 && errno != EEXIST) {
+			printf ("Could not create Function-Cache %s\n", path);
+			return false;
+		}
+		this->path = path;
+		this->maxsize = maxsize;
+		archchecksum = arch->getSourceChecksum();
+
+		HSet<uint64_t> keys;
+		totalsize = 0;
+		DIR* dir = opendir (path);
+		if (!dir) {
+			printf ("Could not open Function-Cache %s\n", path);
+			this->path.clear();
+			return false;
+		}
+		while (struct dirent* entry = readdir (dir)) {
+			struct stat filestat;
+			if (isEntryName (entry->d_name) && stat ( (this->path + "/" + entry->d_name).c_str(), &filestat) == 0) {
+				keys.insert (strtoull (entry->d_name, nullptr, 16));
+				totalsize += filestat.st_size;
+			}
+		}
+		closedir (dir);
+
+		//the index is only appended to, entries that were removed are dropped here
+		std::string indexpath = this->path + "/index";
+		int lockfd = lockIndex (LOCK_EX);
+		HList<FunctionCacheIndexEntry> entries;
+		size_t stale = 0;
+		if (FILE* file = fopen (indexpath.c_str(), "rb")) {
+			FunctionCacheIndexEntry entry;
+			HSet<uint64_t> found;
+			while (fread (&entry, sizeof (entry), 1, file) == 1) {
+				if (keys.find (entry.key) == keys.end() || found.find (entry.key) != found.end()) {
+					stale++;
+					continue;
+				}
+				found.insert (entry.key);
+				entries.push_back (entry);
+				index[entry.prefixhash].push_back (entry.key);
+			}
+			fclose (file);
+		}
+		if (stale) {
+			std::string tmppath;
+			FILE* file = openTempFile (indexpath, &tmppath);
+			if (file) {
+				bool written = fwrite (entries.data(), sizeof (FunctionCacheIndexEntry), entries.size(), file) == entries.size();
+				written = fclose (file) == 0 && written;
+				if (!written || rename (tmppath.c_str(), indexpath.c_str()) != 0)
+					remove (tmppath.c_str());
+			}
+		}
+		unlockIndex (lockfd);
+		printf ("Function-Cache %s with %zu Entries, %.1f MB\n", path, entries.size(), totalsize / (1024.0 * 1024.0));
+		if (totalsize > maxsize)
+			evict();
+		return true;
+	}
+
+	HList<uint64_t> FunctionCacheStore::getKeys (uint64_t prefixhash) {
+		std::unique_lock<std::mutex> lock (mutex);
+		auto it = index.find (prefixhash);
+		return it != index.end() ? it->second : HList<uint64_t>();
+	}
+	void FunctionCacheStore::addEntry (uint64_t prefixhash, uint64_t key, uint64_t filesize) {
+		std::unique_lock<std::mutex> lock (mutex);
+		totalsize += filesize;
+		HList<uint64_t>& keys = index[prefixhash];
+		if (std::find (keys.begin(), keys.end(), key) == keys.end()) {
+			keys.push_back (key);
+			FunctionCacheIndexEntry entry = {prefixhash, key};
+			int lockfd = lockIndex (LOCK_SH);
+			if (FILE* indexfile = fopen ( (path + "/index").c_str(), "ab")) {
+				fwrite (&entry, sizeof (entry), 1, indexfile);
+				fclose (indexfile);
+			}
+			unlockIndex (lockfd);
+		}
+		if (totalsize > maxsize)
+			evict();
+	}
+	uint64_t FunctionCacheStore::getTotalSize() {
+		std::unique_lock<std::mutex> lock (mutex);
+		return totalsize;
+	}
+
+	bool FunctionCache::calcLayout (Function* function, Layout* layout) {
+		//the entries of jump tables are addresses outside of the code
+		if (function->jumptables.size())
+			return false;
+		uint64_t baseaddr = function->baseaddr;
+
+		HList<DisAsmBasicBlock*> blocks;
+		for (DisAsmBasicBlock& bb : function->basicblocks)
+			blocks.push_back (&bb);
+		std::sort (blocks.begin(), blocks.end(), [] (DisAsmBasicBlock * lhs, DisAsmBasicBlock * rhs) {
+			return lhs->addr < rhs->addr;
+		});
+		for (DisAsmBasicBlock* bb : blocks) {
+			int64_t offset = bb->addr - baseaddr;
+			if (!layout->ranges.empty() && layout->ranges.back().offset + (int64_t) layout->ranges.back().size == offset)
+				layout->ranges.back().size += bb->size;
+			else
+				layout->ranges.push_back ({offset, bb->size});
+		}
+		if (layout->ranges.empty())
+			return false;
+		layout->start = layout->ranges.front().offset;
+		layout->end = layout->ranges.back().offset + layout->ranges.back().size;
+
+		InstructionList& instructions = function->instructions;
+		//operands with the offset of their span, the index of the span is known after sorting
+		HList<std::pair<FunctionCacheReloc, int64_t>> relocs;
+		for (size_t index = 0; index < instructions.size(); index++) {
+			uint64_t instrAddr = instructions.addrs[index];
+			uint64_t instrSize = instructions.sizes[index];
+			IRArgument* operands = instructions.getOperands (index);
+			const uint8_t* code = binary->getVDataPtr (instrAddr);
+			if (!code || binary->getVDataSize (instrAddr) < instrSize)
+				return false;
+			int64_t instrEnd = instrAddr + instrSize - baseaddr;
+			for (size_t i = 0; i < instructions.operandCounts[index]; i++) {
+				IRArgument& operand = operands[i];
+				uint64_t value;
+				if (operand.type == IR_ARGTYPE_UINT || operand.type == IR_ARGTYPE_SINT)
+					value = operand.uval;
+				else if (operand.type == IR_ARGTYPE_MEMOP && !operand.mem.base && !operand.mem.index)
+					value = operand.mem.disp;
+				else
+					continue;
+				bool isAddress = value && (value == instructions.getJumpDest (index) || value == instructions.getCallDest (index) || binary->getVDataPtr (value) ||
+				                           std::find (function->funcsCalled.begin(), function->funcsCalled.end(), value) != function->funcsCalled.end());
+				if (!isAddress)
+					continue;
+
+				//find where the address is encoded, relative to the next instruction or absolute
+				FunctionCacheSpan span = {0, 0, 0, instrEnd, value};
+				int64_t rel = value - (instrAddr + instrSize);
+				for (int64_t pos = (int64_t) instrSize - 4; !span.size && pos >= 0 && rel == (int32_t) rel; pos--) {
+					int32_t encoded;
+					memcpy (&encoded, code + pos, sizeof (encoded));
+					if (encoded == rel)
+						span = {instrEnd - (int64_t) instrSize + pos, 4, 1, instrEnd, value};
+				}
+				if (!span.size && instrSize && rel == (int8_t) rel && (int8_t) code[instrSize - 1] == rel)
+					span = {instrEnd - 1, 1, 1, instrEnd, value};
+				for (int64_t pos = (int64_t) instrSize - 8; !span.size && pos >= 0; pos--) {
+					uint64_t encoded;
+					memcpy (&encoded, code + pos, sizeof (encoded));
+					if (encoded == value)
+						span = {instrEnd - (int64_t) instrSize + pos, 8, 0, instrEnd, value};
+				}
+				for (int64_t pos = (int64_t) instrSize - 4; !span.size && pos >= 0 && value <= UINT32_MAX; pos--) {
+					uint32_t encoded;
+					memcpy (&encoded, code + pos, sizeof (encoded));
+					if (encoded == value)
+						span = {instrEnd - (int64_t) instrSize + pos, 4, 0, instrEnd, value};
+				}
+				if (!span.size)
+					return false;
+				relocs.push_back (std::make_pair (FunctionCacheReloc {(uint32_t) index, (uint32_t) i, 0, 0}, span.offset));
+				bool known = false;
+				for (FunctionCacheSpan& other : layout->spans)
+					known = known || other.offset == span.offset;
+				if (!known)
+					layout->spans.push_back (span);
+			}
+		}
+		std::sort (layout->spans.begin(), layout->spans.end(), [] (const FunctionCacheSpan & lhs, const FunctionCacheSpan & rhs) {
+			return lhs.offset < rhs.offset;
+		});
+		for (size_t i = 1; i < layout->spans.size(); i++) {
+			if (layout->spans[i - 1].offset + layout->spans[i - 1].size > layout->spans[i].offset)
+				return false;
+		}
+		for (auto& entry : relocs) {
+			size_t spanIndex = 0;
+			while (layout->spans[spanIndex].offset != entry.second)
+				spanIndex++;
+			entry.first.span = spanIndex;
+			layout->relocs.push_back (entry.first);
+		}
+
+		//the prefix ends at the first encoded address
+		int64_t prefixend = -1;
+		for (FunctionCacheRange& range : layout->ranges) {
+			if (range.offset <= 0 && 0 < range.offset + (int64_t) range.size)
+				prefixend = std::min<int64_t> (H_FUNCTIONCACHE_PREFIX_MAX, range.offset + range.size);
+		}
+		if (prefixend < 0)
+			return false;
+		for (FunctionCacheSpan& span : layout->spans) {
+			if (span.offset + span.size > 0 && span.offset < prefixend)
+				prefixend = std::max<int64_t> (0, span.offset);
+		}
+		layout->prefixsize = prefixend;
+		return true;
+	}
+
+	bool FunctionCache::readSpan (uint64_t baseaddr, const FunctionCacheSpan& span, uint64_t* target) {
+		const uint8_t* code = binary->getVDataPtr (baseaddr + span.offset);
+		if (!code || binary->getVDataSize (baseaddr + span.offset) < span.size)
+			return false;
+		uint64_t value;
+		if (span.size == 1) {
+			value = (int64_t) (int8_t) code[0];
+		} else if (span.size == 4) {
+			int32_t encoded;
+			memcpy (&encoded, code, sizeof (encoded));
+			value = span.relative ? (uint64_t) (int64_t) encoded : (uint64_t) (uint32_t) encoded;
+		} else if (span.size == 8) {
+			memcpy (&value, code, sizeof (value));
+		} else {
+			return false;
+		}
+		*target = span.relative ? baseaddr + span.instrEnd + value : value;
+		return true;
+	}
+
+	bool FunctionCache::calcKey (uint64_t baseaddr, Layout* layout, uint64_t* key) {
+		uint64_t hash = 0xcbf29ce484222325ULL;
+		hash = hashCombine (hash, fileStore->archchecksum);
+		hash = hashCombine (hash, H_FUNCTIONCACHE_PIPELINE_VERSION);
+		hash = hashCombine (hash, layout->ranges.size());
+		size_t spanIndex = 0;
+		for (FunctionCacheRange& range : layout->ranges) {
+			hash = hashCombine (hash, range.offset);
+			hash = hashCombine (hash, range.size);
+			const uint8_t* code = binary->getVDataPtr (baseaddr + range.offset);
+			if (!code || binary->getVDataSize (baseaddr + range.offset) < range.size)
+				return false;
+			for (uint64_t i = 0; i < range.size; i++) {
+				int64_t offset = range.offset + i;
+				while (spanIndex < layout->spans.size() && layout->spans[spanIndex].offset + layout->spans[spanIndex].size <= offset)
+					spanIndex++;
+				if (spanIndex < layout->spans.size() && layout->spans[spanIndex].offset <= offset)
+					continue;
+				hash = hashCombine (hash, code[i]);
+			}
+		}
+		//only the targets inside of the function are the same for every copy of it
+		for (FunctionCacheSpan& span : layout->spans) {
+			uint64_t target;
+			if (!readSpan (baseaddr, span, &target))
+				return false;
+			hash = hashCombine (hash, span.offset);
+			if (baseaddr + layout->start <= target && target < baseaddr + layout->end)
+				hash = hashCombine (hashCombine (hash, 1), target - baseaddr);
+			else
+				hash = hashCombine (hash, 2);
+		}
+		*key = hash;
+		return true;
+	}
+
+	bool FunctionCache::calcPrefixHash (uint64_t baseaddr, size_t prefixsize, uint64_t* hash) {
+		const uint8_t* code = binary->getVDataPtr (baseaddr);
+		if (!code || binary->getVDataSize (baseaddr) < prefixsize)
+			return false;
+		*hash = hashCombine (0xcbf29ce484222325ULL, prefixsize);
+		for (size_t i = 0; i < prefixsize; i++)
+			*hash = hashCombine (*hash, code[i]);
+		return true;
+	}
+
+	uint64_t FunctionCache::calcCalleeHash (Function* function) {
+		uint64_t hash = 0xcbf29ce484222325ULL;
+		for (uint64_t addr : function->funcsCalled) {
+			Function* callee = callgraph->getFunction (addr);
+			hash = hashCombine (hash, callee ? callee->calcSummaryHash() : 0);
+		}
+		return hash;
+	}
+
+	bool FunctionCache::lookup (Function* function) {
+		if (!isOpen())
+			return false;
+		for (size_t prefixsize = 0; prefixsize <= H_FUNCTIONCACHE_PREFIX_MAX; prefixsize++) {
+			uint64_t prefixhash;
+			if (!calcPrefixHash (function->baseaddr, prefixsize, &prefixhash))
+				break;
+			for (uint64_t key : fileStore->getKeys (prefixhash)) {
+				if (load (key, function)) {
+					std::unique_lock<std::mutex> lock (mutex);
+					hits++;
+					H_PROFILE_COUNT (eProfileCacheHits, 1);
+					return true;
+				}
+			}
+		}
+		std::unique_lock<std::mutex> lock (mutex);
+		misses++;
+		return false;
+	}
+
+	bool FunctionCache::load (uint64_t key, Function* function) {
+		std::string entrypath = fileStore->getEntryPath (key);
+		int fd = ::open (entrypath.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+		struct stat filestat;
+		if (fstat (fd, &filestat) != 0 || (size_t) filestat.st_size < sizeof (FunctionCacheHeader)) {
+			close (fd);
+			return false;
+		}
+		size_t size = filestat.st_size;
+		void* mapping = mmap (nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		close (fd);
+		if (mapping == MAP_FAILED)
+			return false;
+		const uint8_t* base = (const uint8_t*) mapping;
+		const FunctionCacheHeader* header = (const FunctionCacheHeader*) base;
+		bool valid = header->magic == H_FUNCTIONCACHE_MAGIC && header->version == H_FUNCTIONCACHE_VERSION && header->headersize == sizeof (FunctionCacheHeader) &&
+		             header->filesize == size && header->key == key && header->archchecksum == fileStore->archchecksum && header->pipelineversion == H_FUNCTIONCACHE_PIPELINE_VERSION;
+		for (size_t i = 0; valid && i < eCacheColumnCount; i++) {
+			const ProjectDBColumn& column = header->columns[i];
+			valid = column.offset % 8 == 0 && column.offset <= size && column.count <= (size - column.offset) / cacheElementSizes[i];
+		}
+		auto inColumn = [header] (FunctionCacheColumnType type, const ProjectDBColumn& range) {
+			return range.offset <= header->columns[type].count && range.count <= header->columns[type].count - range.offset;
+		};
+		valid = valid && header->columns[eCacheRanges].count && inColumn (eCacheSSABlocks, header->generatedblocks) && inColumn (eCacheSSABlocks, header->resultblocks) &&
+		        inColumn (eCacheSSAExpressions, header->generatedexpressions) && inColumn (eCacheSSAExpressions, header->resultexpressions);
+		if (!valid) {
+			munmap (mapping, size);
+			return false;
+		}
+		auto column = [base, header] (FunctionCacheColumnType type) {
+			return base + header->columns[type].offset;
+		};
+
+		//the key only matches if the code at the address has the same layout
+		Layout layout;
+		const FunctionCacheRange* ranges = (const FunctionCacheRange*) column (eCacheRanges);
+		const FunctionCacheSpan* spans = (const FunctionCacheSpan*) column (eCacheSpans);
+		layout.ranges.assign (ranges, ranges + header->columns[eCacheRanges].count);
+		layout.spans.assign (spans, spans + header->columns[eCacheSpans].count);
+		const FunctionCacheReloc* relocs = (const FunctionCacheReloc*) column (eCacheRelocs);
+		layout.relocs.assign (relocs, relocs + header->columns[eCacheRelocs].count);
+		layout.prefixsize = header->prefixsize;
+		layout.start = layout.ranges.front().offset;
+		layout.end = layout.ranges.back().offset + layout.ranges.back().size;
+		uint64_t foundkey;
+		if (!calcKey (function->baseaddr, &layout, &foundkey) || foundkey != key) {
+			munmap (mapping, size);
+			return false;
+		}
+
+		//the targets are read from the code, the same target in the stored function can be different ones here
+		HList<uint64_t> targets (layout.spans.size());
+		for (size_t i = 0; i < layout.spans.size(); i++)
+			readSpan (function->baseaddr, layout.spans[i], &targets[i]);
+		//old target -> new target, if it is the same for all spans
+		HMap<uint64_t, uint64_t> uniqueTargets;
+		HSet<uint64_t> ambiguousTargets;
+		for (size_t i = 0; i < layout.spans.size(); i++) {
+			auto it = uniqueTargets.insert (std::make_pair (layout.spans[i].target, targets[i])).first;
+			if (it->second != targets[i])
+				ambiguousTargets.insert (it->first);
+		}
+		for (uint64_t target : ambiguousTargets)
+			uniqueTargets.erase (target);
+		uint64_t delta = function->baseaddr - header->baseaddr;
+		//positions in the code, end addresses of blocks are one after it
+		uint64_t oldstart = header->baseaddr + layout.start, oldend = header->baseaddr + layout.end;
+		auto move = [oldstart, oldend, delta] (uint64_t addr) {
+			return oldstart <= addr && addr <= oldend ? addr + delta : addr;
+		};
+
+		Result result;
+		const ProjectDBSSABlock* ssablocks = (const ProjectDBSSABlock*) column (eCacheSSABlocks);
+		const HId* ssaids = (const HId*) column (eCacheSSAIds);
+		const ProjectDBSSAExpression* exprs = (const ProjectDBSSAExpression*) column (eCacheSSAExpressions);
+		const ProjectDBSSAArgument* args = (const ProjectDBSSAArgument*) column (eCacheSSAArguments);
+		valid = readInstructions (arch, &function->instructions, (const ProjectDBInstruction*) column (eCacheInstructions), header->columns[eCacheInstructions].count,
+		                          (const IRTableArgument*) column (eCacheOperands), header->columns[eCacheOperands].count) &&
+		        readBlocks (function, (const ProjectDBBlock*) column (eCacheBlocks), header->columns[eCacheBlocks].count) &&
+		        readSSARepresentation (&function->ssaRep, ssablocks + header->generatedblocks.offset, header->generatedblocks.count, ssaids, header->columns[eCacheSSAIds].count,
+		                               exprs + header->generatedexpressions.offset, header->generatedexpressions.count, args, header->columns[eCacheSSAArguments].count) &&
+		        readSSARepresentation (&result.ssaRep, ssablocks + header->resultblocks.offset, header->resultblocks.count, ssaids, header->columns[eCacheSSAIds].count,
+		                               exprs + header->resultexpressions.offset, header->resultexpressions.count, args, header->columns[eCacheSSAArguments].count);
+		if (!valid) {
+			function->instructions.clear();
+			function->basicblocks.clear();
+			function->blockIndex.clear();
+			function->ssaRep.clear();
+			munmap (mapping, size);
+			return false;
+		}
+
+		InstructionList& instructions = function->instructions;
+		//stored address -> end and the targets of the encoded addresses of the instruction
+		struct InstructionRelocs {
+			uint64_t end;
+			HList<std::pair<uint64_t, uint64_t>> targets;
+		};
+		HMap<uint64_t, InstructionRelocs> instructionRelocs;
+		for (size_t i = 0; i < instructions.size(); i++)
+			instructionRelocs[instructions.addrs[i]].end = instructions.addrs[i] + instructions.sizes[i];
+		for (FunctionCacheReloc& reloc : layout.relocs) {
+			if (reloc.instruction >= instructions.size() || reloc.operand >= instructions.operandCounts[reloc.instruction] || reloc.span >= layout.spans.size())
+				valid = false;
+		}
+		if (!valid) {
+			function->instructions.clear();
+			function->basicblocks.clear();
+			function->blockIndex.clear();
+			function->ssaRep.clear();
+			munmap (mapping, size);
+			return false;
+		}
+		//only the recorded operands are addresses, every other value stays
+		for (FunctionCacheReloc& reloc : layout.relocs) {
+			IRArgument& operand = instructions.getOperands (reloc.instruction)[reloc.operand];
+			uint64_t target = targets[reloc.span];
+			instructionRelocs[instructions.addrs[reloc.instruction]].targets.push_back (std::make_pair (layout.spans[reloc.span].target, target));
+			if (operand.type == IR_ARGTYPE_MEMOP)
+				operand.mem.disp = target;
+			else
+				operand.uval = target;
+		}
+		//a value computed by an instruction is one of its targets or its own address, values moved to other instructions are only known if unique
+		auto relocate = [&instructionRelocs, &uniqueTargets, delta] (uint64_t instrAddr, uint64_t value) {
+			auto it = instructionRelocs.find (instrAddr);
+			if (it != instructionRelocs.end()) {
+				for (std::pair<uint64_t, uint64_t>& target : it->second.targets) {
+					if (target.first == value)
+						return target.second;
+				}
+			}
+			auto targetIt = uniqueTargets.find (value);
+			if (targetIt != uniqueTargets.end())
+				return targetIt->second;
+			if (it != instructionRelocs.end() && instrAddr <= value && value <= it->second.end)
+				return value + delta;
+			return value;
+		};
+		//the fall through follows the address of the instruction
+		for (InstructionDest& dest : instructions.jumpdests)
+			dest.addr = relocate (instructions.addrs[dest.index], dest.addr);
+		for (InstructionDest& dest : instructions.calldests)
+			dest.addr = relocate (instructions.addrs[dest.index], dest.addr);
+		for (size_t i = 0; i < instructions.size(); i++)
+			instructions.addrs[i] += delta;
+		function->blockIndex.clear();
+		for (DisAsmBasicBlock& bb : function->basicblocks) {
+			bb.addr += delta;
+			function->blockIndex[bb.addr] = bb.id;
+		}
+		relocateSSA (&function->ssaRep, move, relocate);
+		relocateSSA (&result.ssaRep, move, relocate);
+		//in the order the generation adds them
+		for (SSAExpression& expr : function->ssaRep.expressions) {
+			if (expr.id && expr.type == SSAExprType::eCall && !expr.subExpressions.empty() && expr.subExpressions[0].type == SSAArgType::eUInt)
+				function->funcsCalled.push_back (expr.subExpressions[0].uval);
+		}
+
+		const ProjectDBRegState* regstates = (const ProjectDBRegState*) column (eCacheRegStates);
+		for (size_t i = 0; i < header->columns[eCacheRegStates].count; i++) {
+			RegisterState state;
+			state.regId = regstates[i].regId;
+			state.flags.mask = regstates[i].flags;
+			result.regStates.push_back (state);
+		}
+		result.flags = header->flags;
+		result.callingconvention = header->callingconvention;
+		result.stackAdjust = header->stackAdjust;
+		result.stackReadEnd = header->stackReadEnd;
+		result.calleehash = header->calleehash;
+		munmap (mapping, size);
+
+		//used entries are the last ones to be evicted
+		utime (entrypath.c_str(), nullptr);
+		std::unique_lock<std::mutex> lock (mutex);
+		results[function->id] = result;
+		return true;
+	}
+
+	bool FunctionCache::restoreResult (Function* function) {
+		Result result;
+		{
+			std::unique_lock<std::mutex> lock (mutex);
+			auto it = results.find (function->id);
+			if (it == results.end())
+				return false;
+			result = it->second;
+			results.erase (it);
+		}
+		//the callees were transformed before, their summaries are final
+		if (calcCalleeHash (function) != result.calleehash)
+			return false;
+		function->ssaRep = result.ssaRep;
+		function->callingconvention = result.callingconvention;
+		function->regStates = result.regStates;
+		function->hasRegStates = result.flags & H_PROJECTDB_FUNC_REGSTATES;
+		function->stackAdjust = result.stackAdjust;
+		function->stackAdjustKnown = result.flags & H_PROJECTDB_FUNC_STACKADJUST;
+		function->stackReadEnd = result.stackReadEnd;
+		function->stackReadEndKnown = result.flags & H_PROJECTDB_FUNC_STACKREADEND;
+		std::unique_lock<std::mutex> lock (mutex);
+		reused++;
+		return true;
+	}
+
+	void FunctionCache::store (Function* function, SSARepresentation* generated) {
+		if (!isOpen())
+			return;
+		Layout layout;
+		uint64_t key, prefixhash;
+		if (!calcLayout (function, &layout) || !calcKey (function->baseaddr, &layout, &key) || !calcPrefixHash (function->baseaddr, layout.prefixsize, &prefixhash)) {
+			std::unique_lock<std::mutex> lock (mutex);
+			uncacheable++;
+			return;
+		}
+
+		HList<ProjectDBRegState> regstates;
+		HList<ProjectDBBlock> blocks;
+		HList<ProjectDBInstruction> instructions;
+		HList<IRTableArgument> operands;
+		HList<ProjectDBSSABlock> ssablocks;
+		HList<HId> ssaids;
+		HList<ProjectDBSSAExpression> exprs;
+		HList<ProjectDBSSAArgument> args;
+		for (RegisterState& state : function->regStates)
+			regstates.push_back ({state.regId, 0, state.flags.mask});
+		appendBlocks (&function->basicblocks, &blocks);
+		appendInstructions (&function->instructions, &instructions, &operands);
+
+		FunctionCacheHeader header = {};
+		header.generatedblocks = {ssablocks.size(), generated->bbs.size()};
+		header.generatedexpressions = {exprs.size(), generated->expressions.size()};
+		appendSSARepresentation (generated, &ssablocks, &ssaids, &exprs, &args);
+		header.resultblocks = {ssablocks.size(), function->ssaRep.bbs.size()};
+		header.resultexpressions = {exprs.size(), function->ssaRep.expressions.size()};
+		appendSSARepresentation (&function->ssaRep, &ssablocks, &ssaids, &exprs, &args);
+
+		header.magic = H_FUNCTIONCACHE_MAGIC;
+		header.version = H_FUNCTIONCACHE_VERSION;
+		header.headersize = sizeof (FunctionCacheHeader);
+		header.key = key;
+		header.archchecksum = fileStore->archchecksum;
+		header.pipelineversion = H_FUNCTIONCACHE_PIPELINE_VERSION;
+		header.baseaddr = function->baseaddr;
+		header.prefixsize = layout.prefixsize;
+		header.flags = (function->hasRegStates ? H_PROJECTDB_FUNC_REGSTATES : 0) |
+		               (function->stackAdjustKnown ? H_PROJECTDB_FUNC_STACKADJUST : 0) |
+		               (function->stackReadEndKnown ? H_PROJECTDB_FUNC_STACKREADEND : 0);
+		header.callingconvention = function->callingconvention;
+		header.stackAdjust = function->stackAdjust;
+		header.stackReadEnd = function->stackReadEnd;
+		header.calleehash = calcCalleeHash (function);
+
+		const void* columns[eCacheColumnCount] = {
+			layout.ranges.data(), layout.spans.data(), layout.relocs.data(), regstates.data(), blocks.data(), instructions.data(), operands.data(),
+			ssablocks.data(), ssaids.data(), exprs.data(), args.data()
+		};
+		const size_t counts[eCacheColumnCount] = {
+			layout.ranges.size(), layout.spans.size(), layout.relocs.size(), regstates.size(), blocks.size(), instructions.size(), operands.size(),
+			ssablocks.size(), ssaids.size(), exprs.size(), args.size()
+		};
+		uint64_t offset = sizeof (FunctionCacheHeader);
+		for (size_t i = 0; i < eCacheColumnCount; i++) {
+			offset = (offset + 7) & ~ (uint64_t) 7;
+			header.columns[i] = {offset, counts[i]};
+			offset += counts[i] * cacheElementSizes[i];
+		}
+		header.filesize = offset;
+		HList<uint8_t> buffer (header.filesize, 0);
+		memcpy (buffer.data(), &header, sizeof (FunctionCacheHeader));
+		for (size_t i = 0; i < eCacheColumnCount; i++) {
+			if (counts[i])
+				memcpy (buffer.data() + header.columns[i].offset, columns[i], counts[i] * cacheElementSizes[i]);
+		}
+
+		//other processes may look the entry up while it is written
+		std::string entrypath = fileStore->getEntryPath (key);
+		std::string tmppath;
+		FILE* file = openTempFile (entrypath, &tmppath);
+		if (!file)
+			return;
+		bool written = fwrite (buffer.data(), 1, buffer.size(), file) == buffer.size();
+		written = fclose (file) == 0 && written;
+		if (!written || rename (tmppath.c_str(), entrypath.c_str()) != 0) {
+			remove (tmppath.c_str());
+			return;
+		}
+
+		fileStore->addEntry (prefixhash, key, header.filesize);
+	}
+
+	//needs the lock
+	void FunctionCacheStore::evict() {
+		struct Entry {
+			time_t mtime;
+			uint64_t size;
+			std::string path;
+		};
+		HList<Entry> entries;
+		uint64_t size = 0;
+		DIR* dir = opendir (path.c_str());
+		if (!dir)
+			return;
+		while (struct dirent* entry = readdir (dir)) {
+			struct stat filestat;
+			std::string entrypath = path + "/" + entry->d_name;
+			if (isEntryName (entry->d_name) && stat (entrypath.c_str(), &filestat) == 0) {
+				entries.push_back ({filestat.st_mtime, (uint64_t) filestat.st_size, entrypath});
+				size += filestat.st_size;
+			}
+		}
+		closedir (dir);
+		std::sort (entries.begin(), entries.end(), [] (const Entry & lhs, const Entry & rhs) {
+			return lhs.mtime < rhs.mtime;
+		});
+		//evict down to 3/4 of the limit so not every store has to scan the store
+		size_t removed = 0;
+		for (Entry& entry : entries) {
+			if (size <= maxsize - maxsize / 4)
+				break;
+			if (remove (entry.path.c_str()) == 0) {
+				size -= entry.size;
+				removed++;
+			}
+		}
+		totalsize = size;
+		printf ("Function-Cache evicted %zu of %zu Entries\n", removed, entries.size());
+	}
+
+	void FunctionCache::printStats() {
+		if (!isOpen())
+			return;
+		printf ("Function-Cache: %zu Hits, %zu Results reused, %zu Misses, %zu Uncacheable, %.1f MB\n", hits, reused, misses, uncacheable, fileStore->getTotalSize() / (1024.0 * 1024.0));
+	}
+}
@@ -0,0 +1,185 @@
+#ifndef H_FUNCTIONCACHE_H
+#define H_FUNCTIONCACHE_H
+
+#include "General.h"
+#include "ProjectDB.h"
+
+#include <string>
+#include <mutex>
+
+//"HOLOFCAC"
+#define H_FUNCTIONCACHE_MAGIC (0x434143464f4c4f48ULL)
+#define H_FUNCTIONCACHE_VERSION (2)
+//part of every key, has to be changed whenever the disassembly or a transformer produces different results
+#define H_FUNCTIONCACHE_PIPELINE_VERSION (1)
+//bytes at the start of a function that select the entries that may match it
+#define H_FUNCTIONCACHE_PREFIX_MAX (16)
+
+namespace holodec {
+
+	class CallGraph;
+
+	enum FunctionCacheColumnType {
+		eCacheRanges = 0,
+		eCacheSpans,
+		eCacheRelocs,
+		eCacheRegStates,
+		eCacheBlocks,
+		eCacheInstructions,
+		eCacheOperands,
+		eCacheSSABlocks,
+		eCacheSSAIds,
+		eCacheSSAExpressions,
+		eCacheSSAArguments,
+		eCacheColumnCount
+	};
+	//code of the function relative to its base address
+	struct FunctionCacheRange {
+		int64_t offset;
+		uint64_t size;
+	};
+	//an encoded address in the code, its bytes are not part of the key
+	//only whether the target is inside the function and where
+	struct FunctionCacheSpan {
+		int64_t offset;
+		uint32_t size;
+		//relative to the end of the instruction or absolute
+		uint32_t relative;
+		int64_t instrEnd;
+		//the target in the stored function
+		uint64_t target;
+	};
+	//an operand of an instruction that holds the address encoded in a span
+	struct FunctionCacheReloc {
+		uint32_t instruction;
+		uint32_t operand;
+		uint32_t span;
+		uint32_t pad;
+	};
+	struct FunctionCacheHeader {
+		uint64_t magic;
+		uint32_t version;
+		uint32_t headersize;
+		uint64_t key;
+		uint64_t archchecksum;
+		uint64_t pipelineversion;
+		uint64_t filesize;
+
+		//of the stored function, everything in the extent of the ranges is moved with it
+		uint64_t baseaddr;
+		uint32_t prefixsize;
+		//H_PROJECTDB_FUNC_*
+		uint32_t flags;
+		HId callingconvention;
+		uint32_t pad;
+		int64_t stackAdjust;
+		int64_t stackReadEnd;
+		//summaries of the callees the result was computed with
+		uint64_t calleehash;
+
+		//ranges in the ssa columns, the generated ssa is used if the callees changed
+		ProjectDBColumn generatedblocks;
+		ProjectDBColumn generatedexpressions;
+		ProjectDBColumn resultblocks;
+		ProjectDBColumn resultexpressions;
+		ProjectDBColumn columns[eCacheColumnCount];
+	};
+	struct FunctionCacheIndexEntry {
+		uint64_t prefixhash;
+		uint64_t key;
+	};
+
+	//the directory of the entries, opened once and shared by all binaries and threads of a process
+	//the least recently used entries are removed when the store gets larger than its limit
+	class FunctionCacheStore {
+	public:
+		Architecture* arch;
+		uint64_t archchecksum = 0;
+
+		FunctionCacheStore (Architecture* arch) : arch (arch) {}
+
+		bool open (const char* path, uint64_t maxsize);
+		bool isOpen() {
+			return !path.empty();
+		}
+		std::string getEntryPath (uint64_t key);
+		//keys of the entries whose code starts with the prefix
+		HList<uint64_t> getKeys (uint64_t prefixhash);
+		//adds a written entry to the index
+		void addEntry (uint64_t prefixhash, uint64_t key, uint64_t filesize);
+		uint64_t getTotalSize();
+
+	private:
+		std::string path;
+		uint64_t maxsize = 0;
+		uint64_t totalsize = 0;
+		//prefix hash -> keys
+		HMap<uint64_t, HList<uint64_t>> index;
+		std::mutex mutex;
+
+		//the index file is compacted with the lock held exclusively, appends hold it shared
+		//so other processes using the store do not lose entries
+		int lockIndex (int operation);
+		void unlockIndex (int fd);
+		void evict();
+	};
+
+	//analyzed functions of one binary in the store
+	//the key is a hash of the code of a function where the encoded addresses are replaced by whether they point into the function
+	//so the same function in another binary or at another address finds the entry and the stored results are moved to it
+	class FunctionCache {
+	public:
+		Binary* binary;
+		Architecture* arch;
+		CallGraph* callgraph;
+		FunctionCacheStore* fileStore;
+
+		FunctionCache (Binary* binary, Architecture* arch, CallGraph* callgraph, FunctionCacheStore* fileStore) : binary (binary), arch (arch), callgraph (callgraph), fileStore (fileStore) {}
+
+		bool isOpen() {
+			return fileStore && fileStore->isOpen();
+		}
+
+		//fills the disassembly and the generated ssa of the function instead of analyzing it
+		bool lookup (Function* function);
+		//uses the stored result of a found function if its callees still have the same summaries
+		bool restoreResult (Function* function);
+		void store (Function* function, SSARepresentation* generated);
+
+		void printStats();
+
+	private:
+		struct Layout {
+			HList<FunctionCacheRange> ranges;
+			//sorted by offset
+			HList<FunctionCacheSpan> spans;
+			HList<FunctionCacheReloc> relocs;
+			size_t prefixsize;
+			int64_t start;
+			int64_t end;
+		};
+		struct Result {
+			SSARepresentation ssaRep;
+			uint32_t flags;
+			HId callingconvention;
+			HList<RegisterState> regStates;
+			int64_t stackAdjust;
+			int64_t stackReadEnd;
+			uint64_t calleehash;
+		};
+
+		HMap<HId, Result> results;
+		std::mutex mutex;
+
+		size_t hits = 0, reused = 0, misses = 0, uncacheable = 0;
+
+		bool calcLayout (Function* function, Layout* layout);
+		bool readSpan (uint64_t baseaddr, const FunctionCacheSpan& span, uint64_t* target);
+		bool calcKey (uint64_t baseaddr, Layout* layout, uint64_t* key);
+		bool calcPrefixHash (uint64_t baseaddr, size_t prefixsize, uint64_t* hash);
+		uint64_t calcCalleeHash (Function* function);
+		bool load (uint64_t key, Function* function);
+	};
+}
+
+#endif // H_FUNCTIONCACHE_H
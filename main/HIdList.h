@@ -93,6 +93,11 @@ namespace holodec {
 			gen.clear();
 			list.clear();
 		}
+		//clear keeps the memory for reuse, release returns it
+		void release() {
+			gen.clear();
+			HList<T>().swap (list);
+		}
 	};
 	template<typename T>
 	struct HIdPtrList {
@@ -292,6 +297,9 @@ namespace holodec {
 		void clear() {
 			list.clear();
 		}
+		void release() {
+			HList<T>().swap (list);
+		}
 	};
 
 }
@@ -68,7 +68,7 @@ namespace holodec {
 				HId builtinId;
 				HId instrId;
 			};
-		} mod;
+		} mod = {};
 		//HLocalBackedList<SSAArgument, IR_LOCAL_USEID_MAX> subExpressions;
 		HList<IRArgument> subExpressions;
 
@@ -104,6 +104,28 @@ namespace holodec {
 	}
 
 
+	//one step of a compiled condition, the program is evaluated on a value stack in order
+	struct IRCondOp {
+		enum {
+			ePushConst = 0,
+			ePushInvalid,
+			ePushArg,//value of operand index, valid for unsigned operands
+			ePushArgSize,//size of operand index divided by value
+			eEq,
+			eNe,
+			eLower,
+			eLe,
+			eGreater,
+			eGe,
+			eAnd,//count values
+			eOr,
+			eXor,
+			eNot
+		} type;
+		uint32_t index;
+		uint64_t value;
+	};
+
 	struct IRRepresentation {
 		int64_t argcount;
 		HString condstring;
@@ -112,6 +134,9 @@ namespace holodec {
 		IRArgument condExpr = IRArgument::create();
 		IRArgument rootExpr = IRArgument::create();
 
+		//condExpr compiled by compileIRCondition, empty if it can not be compiled
+		HList<IRCondOp> condProgram;
+
 		IRRepresentation() : IRRepresentation (-1, nullptr, "") {}
 		IRRepresentation (HString irstring) :  IRRepresentation (-1, nullptr, irstring) {}
 		IRRepresentation (int64_t argcount, HString irstring) : IRRepresentation (argcount, nullptr, irstring) {}
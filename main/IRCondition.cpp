@@ -0,0 +1,127 @@
+#include "IRCondition.h"
+#include "Architecture.h"
+
+namespace holodec {
+
+	static bool compileIRConditionArg (Architecture* arch, IRArgument arg, HList<IRCondOp>* program, size_t depth, size_t* maxdepth) {
+		if (depth + 1 > *maxdepth)
+			*maxdepth = depth + 1;
+		switch (arg.type) {
+		case IR_ARGTYPE_ARG:
+			if (!arg.ref.refId)
+				return false;
+			program->push_back ({IRCondOp::ePushArg, arg.ref.refId - 1, 0});
+			return true;
+		case IR_ARGTYPE_UINT:
+			program->push_back ({IRCondOp::ePushConst, 0, arg.uval});
+			return true;
+		case IR_ARGTYPE_SINT:
+		case IR_ARGTYPE_FLOAT:
+		case IR_ARGTYPE_REG:
+		case IR_ARGTYPE_STACK:
+		case IR_ARGTYPE_TMP:
+			program->push_back ({IRCondOp::ePushInvalid, 0, 0});
+			return true;
+		case IR_ARGTYPE_IP:
+			return false;
+		case IR_ARGTYPE_ID:
+			break;
+		default:
+			program->push_back ({IRCondOp::ePushConst, 0, 1});
+			return true;
+		}
+		IRExpression* irExpr = arch->getIrExpr (arg.ref.refId);
+		switch (irExpr->type) {
+		case IR_EXPR_SIZE:
+		case IR_EXPR_BSIZE: {
+			if (irExpr->subExpressions.size() != 1)
+				return false;
+			uint64_t divisor = irExpr->type == IR_EXPR_SIZE ? arch->wordbase : 1;
+			IRArgument& subArg = irExpr->subExpressions[0];
+			if (subArg.type == IR_ARGTYPE_ARG && subArg.ref.refId)
+				program->push_back ({IRCondOp::ePushArgSize, subArg.ref.refId - 1, divisor});
+			else if (subArg.isConst())
+				program->push_back ({IRCondOp::ePushConst, 0, subArg.size / divisor});
+			else
+				return false;
+			return true;
+		}
+		case IR_EXPR_OP:
+			break;
+		default:
+			program->push_back ({IRCondOp::ePushInvalid, 0, 0});
+			return true;
+		}
+		size_t count = irExpr->subExpressions.size();
+		switch (irExpr->mod.opType) {
+		case SSAOpType::eAnd:
+		case SSAOpType::eOr:
+		case SSAOpType::eXor:
+			for (size_t i = 0; i < count; i++) {
+				if (!compileIRConditionArg (arch, irExpr->subExpressions[i], program, depth + i, maxdepth))
+					return false;
+			}
+			program->push_back ({irExpr->mod.opType == SSAOpType::eAnd ? IRCondOp::eAnd : (irExpr->mod.opType == SSAOpType::eOr ? IRCondOp::eOr : IRCondOp::eXor), (uint32_t) count, 0});
+			return true;
+		case SSAOpType::eNot:
+			if (!count) {
+				program->push_back ({IRCondOp::ePushConst, 0, 0});
+				return true;
+			}
+			if (!compileIRConditionArg (arch, irExpr->subExpressions[0], program, depth, maxdepth))
+				return false;
+			program->push_back ({IRCondOp::eNot, 0, 0});
+			return true;
+		case SSAOpType::eEq:
+		case SSAOpType::eNe:
+		case SSAOpType::eLower:
+		case SSAOpType::eLe:
+		case SSAOpType::eGreater:
+		case SSAOpType::eGe: {
+			if (count != 2) {
+				program->push_back ({IRCondOp::ePushConst, 0, 0});
+				return true;
+			}
+			if (!compileIRConditionArg (arch, irExpr->subExpressions[0], program, depth, maxdepth) ||
+			        !compileIRConditionArg (arch, irExpr->subExpressions[1], program, depth + 1, maxdepth))
+				return false;
+			decltype (IRCondOp::type) type;
+			switch (irExpr->mod.opType) {
+			case SSAOpType::eEq:
+				type = IRCondOp::eEq;
+				break;
+			case SSAOpType::eNe:
+				type = IRCondOp::eNe;
+				break;
+			case SSAOpType::eLower:
+				type = IRCondOp::eLower;
+				break;
+			case SSAOpType::eLe:
+				type = IRCondOp::eLe;
+				break;
+			case SSAOpType::eGreater:
+				type = IRCondOp::eGreater;
+				break;
+			default:
+				type = IRCondOp::eGe;
+				break;
+			}
+			program->push_back ({type, 0, 0});
+			return true;
+		}
+		default:
+			program->push_back ({IRCondOp::ePushInvalid, 0, 0});
+			return true;
+		}
+	}
+
+	bool compileIRCondition (Architecture* arch, IRArgument condExpr, HList<IRCondOp>* program) {
+		size_t maxdepth = 0;
+		program->clear();
+		if (!compileIRConditionArg (arch, condExpr, program, 0, &maxdepth) || maxdepth > H_IRCONDITION_MAX_STACK) {
+			program->clear();
+			return false;
+		}
+		return true;
+	}
+}
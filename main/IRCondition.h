@@ -0,0 +1,108 @@
+#ifndef H_IRCONDITION_H
+#define H_IRCONDITION_H
+
+#include "General.h"
+#include "IR.h"
+
+//maximum depth of the value stack of a compiled condition
+#define H_IRCONDITION_MAX_STACK (8)
+
+namespace holodec {
+
+	class Architecture;
+
+	//flattens the condition of a representation into a postfix program over the operands
+	//returns false for conditions that need the interpreter, e.g. ones depending on the instruction address
+	bool compileIRCondition (Architecture* arch, IRArgument condExpr, HList<IRCondOp>* program);
+
+	//same result as parseConstExpression on the condition followed by the check for a non-zero unsigned value
+	template<typename ARGLIST>
+	inline bool evaluateIRCondition (HList<IRCondOp>* program, ARGLIST* arglist) {
+		uint64_t values[H_IRCONDITION_MAX_STACK];
+		bool valid[H_IRCONDITION_MAX_STACK];
+		size_t top = 0;
+		for (IRCondOp& op : *program) {
+			switch (op.type) {
+			case IRCondOp::ePushConst:
+				values[top] = op.value;
+				valid[top++] = true;
+				break;
+			case IRCondOp::ePushInvalid:
+				values[top] = 0;
+				valid[top++] = false;
+				break;
+			case IRCondOp::ePushArg:
+				if (op.index < arglist->size() && (*arglist) [op.index].type == IR_ARGTYPE_UINT) {
+					values[top] = (*arglist) [op.index].uval;
+					valid[top++] = true;
+				} else {
+					values[top] = 0;
+					valid[top++] = false;
+				}
+				break;
+			case IRCondOp::ePushArgSize:
+				if (op.index < arglist->size()) {
+					values[top] = (*arglist) [op.index].size / op.value;
+					valid[top++] = true;
+				} else {
+					values[top] = 0;
+					valid[top++] = false;
+				}
+				break;
+			case IRCondOp::eNot:
+				values[top - 1] = !values[top - 1];
+				break;
+			case IRCondOp::eAnd:
+			case IRCondOp::eOr:
+			case IRCondOp::eXor: {
+				uint64_t val = op.type == IRCondOp::eAnd;
+				bool allvalid = true;
+				for (size_t i = top - op.index; i < top; i++) {
+					allvalid = allvalid && valid[i];
+					if (op.type == IRCondOp::eAnd)
+						val = val && values[i];
+					else if (op.type == IRCondOp::eOr)
+						val = val || values[i];
+					else
+						val = !!val ^ !!values[i];
+				}
+				top -= op.index;
+				values[top] = val;
+				valid[top++] = allvalid;
+			}
+			break;
+			default: {
+				top--;
+				uint64_t lhs = values[top - 1], rhs = values[top];
+				valid[top - 1] = valid[top - 1] && valid[top];
+				switch (op.type) {
+				case IRCondOp::eEq:
+					values[top - 1] = lhs == rhs;
+					break;
+				case IRCondOp::eNe:
+					values[top - 1] = lhs != rhs;
+					break;
+				case IRCondOp::eLower:
+					values[top - 1] = lhs < rhs;
+					break;
+				case IRCondOp::eLe:
+					values[top - 1] = lhs <= rhs;
+					break;
+				case IRCondOp::eGreater:
+					values[top - 1] = lhs > rhs;
+					break;
+				case IRCondOp::eGe:
+					values[top - 1] = lhs >= rhs;
+					break;
+				default:
+					break;
+				}
+			}
+			break;
+			}
+		}
+		return top == 1 && valid[0] && values[0];
+	}
+}
+
+#endif // H_IRCONDITION_H
@@ -1,6 +1,7 @@
 
 #include "IRGen.h"
 #include <assert.h>
+#include <inttypes.h>
 
 namespace holodec {
 	
@@ -298,8 +299,8 @@ namespace holodec {
 	bool IRParser::parseNumber (int64_t* num) {
 		size_t current_index = index;
 		skipWhitespaces();
-		int64_t pos;
-		int parsed = sscanf (string.cstr() + index, "%d%n", num, &pos);
+		int pos;
+		int parsed = sscanf (string.cstr() + index, "%" SCNd64 "%n", num, &pos);
 		if (parsed != 1) {
 			return false;
 		} else {
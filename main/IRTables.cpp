@@ -0,0 +1,171 @@
+#include "IRTables.h"
+#include "Architecture.h"
+
+#include <algorithm>
+#include <string.h>
+#include <inttypes.h>
+
+namespace holodec {
+
+	uint64_t irTableKey (HString& condstring, HString& irstring) {
+		return condstring.hash() * 1099511628211ULL ^ irstring.hash();
+	}
+
+	IRArgument toIRArgument (const IRTableArgument* arg) {
+		IRArgument irarg = IRArgument::create();
+		irarg.type = arg->type;
+		irarg.size = arg->size;
+		switch (arg->type) {
+		case IR_ARGTYPE_SINT:
+		case IR_ARGTYPE_UINT:
+		case IR_ARGTYPE_FLOAT:
+			irarg.uval = arg->vals[0];
+			break;
+		case IR_ARGTYPE_MEMOP:
+			irarg.mem.segment = arg->vals[0];
+			irarg.mem.base = arg->vals[1];
+			irarg.mem.index = arg->vals[2];
+			irarg.mem.scale = (ArgSInt) arg->vals[3];
+			irarg.mem.disp = (ArgSInt) arg->vals[4];
+			break;
+		default:
+			irarg.ref.refId = arg->vals[0];
+			irarg.ref.index = arg->vals[1];
+			break;
+		}
+		return irarg;
+	}
+
+	IRTableArgument toIRTableArgument (IRArgument& arg) {
+		IRTableArgument tablearg = {arg.type, arg.size, {0, 0, 0, 0, 0}};
+		switch (arg.type) {
+		case IR_ARGTYPE_SINT:
+		case IR_ARGTYPE_UINT:
+		case IR_ARGTYPE_FLOAT:
+			tablearg.vals[0] = arg.uval;
+			break;
+		case IR_ARGTYPE_MEMOP:
+			tablearg.vals[0] = arg.mem.segment;
+			tablearg.vals[1] = arg.mem.base;
+			tablearg.vals[2] = arg.mem.index;
+			tablearg.vals[3] = (uint64_t) arg.mem.scale;
+			tablearg.vals[4] = (uint64_t) arg.mem.disp;
+			break;
+		default:
+			tablearg.vals[0] = arg.ref.refId;
+			tablearg.vals[1] = arg.ref.index;
+			break;
+		}
+		return tablearg;
+	}
+
+	static void writeIRTableArgument (IRArgument& arg, FILE* file) {
+		IRTableArgument tablearg = toIRTableArgument (arg);
+		fprintf (file, "{(holodec::IRArgTypes) %d, %" PRIu32 ", {", tablearg.type, tablearg.size);
+		for (int i = 0; i < 5; i++)
+			fprintf (file, i ? ", 0x%" PRIx64 : "0x%" PRIx64, tablearg.vals[i]);
+		fprintf (file, "}}");
+	}
+	static void writeIRTableString (HString& string, FILE* file) {
+		if (!string) {
+			fprintf (file, "nullptr");
+			return;
+		}
+		fputc ('"', file);
+		for (const char* ptr = string.cstr(); *ptr; ptr++) {
+			if (*ptr == '"' || *ptr == '\\')
+				fputc ('\\', file);
+			fputc (*ptr, file);
+		}
+		fputc ('"', file);
+	}
+
+	bool writeIRTables (Architecture* arch, const char* ns, const char* name, FILE* file) {
+		struct Entry {
+			uint64_t key;
+			IRRepresentation* rep;
+		};
+		HList<Entry> entries;
+		for (auto& defentry : arch->instrdefs) {
+			for (IRRepresentation& rep : defentry.second.irs) {
+				if (!rep)
+					continue;
+				entries.push_back ({irTableKey (rep.condstring, rep.irstring), &rep});
+			}
+		}
+		std::sort (entries.begin(), entries.end(), [] (const Entry& lhs, const Entry& rhs) {
+			if (lhs.key != rhs.key)
+				return lhs.key < rhs.key;
+			int cmp = strcmp (lhs.rep->condstring.cstr(), rhs.rep->condstring.cstr());
+			return cmp ? cmp < 0 : strcmp (lhs.rep->irstring.cstr(), rhs.rep->irstring.cstr()) < 0;
+		});
+		//the same strings parse to the same expressions
+		entries.erase (std::unique (entries.begin(), entries.end(), [] (const Entry& lhs, const Entry& rhs) {
+			return lhs.key == rhs.key && lhs.rep->condstring == rhs.rep->condstring && lhs.rep->irstring == rhs.rep->irstring;
+		}), entries.end());
+
+		fprintf (file, "//generated with \"holodec --gen-ir-tables\" from the ir-strings of the architecture %s, do not edit\n", arch->name.cstr());
+		fprintf (file, "#include \"IRTables.h\"\n\n");
+		fprintf (file, "namespace %s {\n\n", ns);
+		fprintf (file, "\tstatic const holodec::IRTableArgument arguments[] = {\n");
+		size_t argcount = 0;
+		for (IRExpression& expr : arch->irExpressions) {
+			for (IRArgument& arg : expr.subExpressions) {
+				fprintf (file, "\t\t");
+				writeIRTableArgument (arg, file);
+				fprintf (file, ",\n");
+				argcount++;
+			}
+		}
+		fprintf (file, "\t};\n\n");
+
+		fprintf (file, "\tstatic const holodec::IRTableExpression expressions[] = {\n");
+		size_t exprcount = 0;
+		size_t argoffset = 0;
+		for (IRExpression& expr : arch->irExpressions) {
+			if (expr.id != exprcount + 1) {
+				printf ("IR-Expression %d is not at index %zu\n", expr.id, exprcount);
+				return false;
+			}
+			uint64_t mod = expr.type == IR_EXPR_REC ? 0 : expr.mod.index;
+			fprintf (file, "\t\t{(holodec::IRExprType) %d, %" PRIu64 ", (holodec::SSAType) %d, 0x%" PRIx64 ", ", expr.type, expr.size, (int) expr.returntype, mod);
+			if (expr.type == IR_EXPR_REC) {
+				InstrDefinition* instrdef = arch->getInstrDef (expr.mod.instrId);
+				if (!instrdef)
+					return false;
+				writeIRTableString (instrdef->mnemonics, file);
+			} else {
+				fprintf (file, "nullptr");
+			}
+			fprintf (file, ", %zu, %zu},\n", argoffset, expr.subExpressions.size());
+			argoffset += expr.subExpressions.size();
+			exprcount++;
+		}
+		fprintf (file, "\t};\n\n");
+
+		fprintf (file, "\tstatic const holodec::IRTableEntry entries[] = {\n");
+		for (Entry& entry : entries) {
+			fprintf (file, "\t\t{0x%" PRIx64 ", ", entry.key);
+			writeIRTableString (entry.rep->condstring, file);
+			fprintf (file, ", ");
+			writeIRTableString (entry.rep->irstring, file);
+			fprintf (file, ",\n\t\t\t");
+			writeIRTableArgument (entry.rep->condExpr, file);
+			fprintf (file, ", ");
+			writeIRTableArgument (entry.rep->rootExpr, file);
+			fprintf (file, "},\n");
+		}
+		fprintf (file, "\t};\n\n");
+
+		fprintf (file, "\textern const holodec::IRTables %s;\n", name);
+		fprintf (file, "\tconst holodec::IRTables %s = {\n", name);
+		fprintf (file, "\t\t%d,\n", H_IRTABLES_VERSION);
+		fprintf (file, "\t\t0x%" PRIx64 ",\n", arch->getLayoutChecksum());
+		fprintf (file, "\t\texpressions, %zu,\n", exprcount);
+		fprintf (file, "\t\targuments, %zu,\n", argcount);
+		fprintf (file, "\t\tentries, %zu\n", entries.size());
+		fprintf (file, "\t};\n");
+		fprintf (file, "}\n");
+		return true;
+	}
+}
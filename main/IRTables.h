@@ -0,0 +1,65 @@
+#ifndef H_IRTABLES_H
+#define H_IRTABLES_H
+
+#include <stdio.h>
+#include "General.h"
+#include "IR.h"
+
+//increase when the ir-parser or the format of the tables changes, tables generated with another version are not used
+#define H_IRTABLES_VERSION (1)
+
+namespace holodec {
+
+	class Architecture;
+
+	//flat form of the parsed ir-strings of an architecture that is compiled into the binary
+	//generated with "holodec --gen-ir-tables <file>" and mapped in by Architecture::init instead of parsing all ir-strings again
+
+	//ref-types: {refId, index}, memop: {segment, base, index, scale, disp}, constants: {raw bits}
+	struct IRTableArgument {
+		IRArgTypes type;
+		uint32_t size;
+		uint64_t vals[5];
+	};
+	struct IRTableExpression {
+		IRExprType type;
+		uint64_t size;
+		SSAType returntype;
+		uint64_t mod;
+		//the target of #rec is stored by mnemonic as the instruction ids depend on the disassembler version
+		const char* recmnemonic;
+		uint32_t argoffset;
+		uint32_t argcount;
+	};
+	//representations are found by their strings so a changed ir-string is parsed at startup instead of using a stale table
+	struct IRTableEntry {
+		uint64_t key;
+		const char* condstring;
+		const char* irstring;
+		IRTableArgument condExpr;
+		IRTableArgument rootExpr;
+	};
+	struct IRTables {
+		//H_IRTABLES_VERSION of the generator
+		uint32_t version;
+		//checksum over the registers, stacks and memories the ids in the table refer to
+		uint64_t checksum;
+		//expression i has the id i + 1
+		const IRTableExpression* expressions;
+		size_t expressioncount;
+		const IRTableArgument* arguments;
+		size_t argumentcount;
+		//sorted by key
+		const IRTableEntry* entries;
+		size_t entrycount;
+	};
+
+	uint64_t irTableKey (HString& condstring, HString& irstring);
+	IRArgument toIRArgument (const IRTableArgument* arg);
+	IRTableArgument toIRTableArgument (IRArgument& arg);
+
+	//writes the expressions of an already parsed architecture as a source-file that defines ns::name
+	bool writeIRTables (Architecture* arch, const char* ns, const char* name, FILE* file);
+}
+
+#endif // H_IRTABLES_H
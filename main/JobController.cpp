@@ -1,4 +1,8 @@
 #include "JobController.h"
+#include "Logger.h"
+#include "Profiler.h"
+
+#include <string>
 
 namespace holodec{
 
@@ -44,17 +48,21 @@ namespace holodec{
 	void JobController::start_job_loop(JobContext context){
 		Job nextJob;
 		++executors_running;
+		if (g_profiler.isEnabled())
+			g_profiler.nameThread (("Job-Thread " + std::to_string (context.threadId)).c_str());
 		
 		while(running.load()){
 			
 			nextJob = get_next_job();
 			
 			if(nextJob.func){
-				nextJob.func(context);
+				{
+					H_PROFILE_SCOPE ("Job");
+					nextJob.func(context);
+				}
 				if(!--jobs_to_do)
 					end_cond.notify_all();
-				printf("Jobs ToDo %d\n", jobs_to_do.load());
-				printf("Jobs in Queue %d\n", jobs.size());
+				H_LOG_TRACE (eLogJobs, "Jobs ToDo %d\n", jobs_to_do.load());
 			}
 		}
 		if(!--executors_running)
@@ -69,7 +77,7 @@ namespace holodec{
 		end_on_empty.store(true);
 		std::unique_lock<std::mutex> mlock (end_mutex);
 		end_cond.wait (mlock, [this](){return jobs_to_do == 0;});
-		printf("All Finished\n");
+		H_LOG_DEBUG (eLogJobs, "All Finished\n");
 		fflush(stdout);
 	}
 	void JobController::wait_for_exit(){
@@ -77,6 +85,6 @@ namespace holodec{
 		cond.notify_all();
 		std::unique_lock<std::mutex> mlock (end_mutex);
 		end_cond.wait (mlock, [this](){return executors_running == 0;});
-		printf("All Finished\n");
+		H_LOG_DEBUG (eLogJobs, "All Finished\n");
 	}
 }
\ No newline at end of file
@@ -0,0 +1,338 @@
+#include "JumpTableResolver.h"
+#include "Architecture.h"
+#include "Binary.h"
+#include <string.h>
+
+namespace holodec {
+
+	static JTValue jtAdd (JTValue lhs, JTValue rhs) {
+		if (lhs.kind == JTValue::eConst)
+			std::swap (lhs, rhs);
+		if (lhs.kind == JTValue::eUnknown || rhs.kind != JTValue::eConst)
+			return JTValue();
+		lhs.value += rhs.value;
+		return lhs;
+	}
+	static JTValue jtMul (JTValue value, uint64_t factor) {
+		if (value.kind != JTValue::eConst && value.kind != JTValue::eIndex)
+			return JTValue();
+		value.value *= factor;
+		if (value.kind == JTValue::eIndex)
+			value.scale *= factor;
+		return value;
+	}
+	static bool jtSameLeaf (JTValue* lhs, JTValue* rhs) {
+		return lhs->leafExpr ? lhs->leafExpr == rhs->leafExpr : (!rhs->leafExpr && lhs->leafReg == rhs->leafReg);
+	}
+	static bool isExecutableAddr (Section* section, uint64_t addr) {
+		if (!section->pointsToSection (addr))
+			return false;
+		if (section->subsections.empty())
+			return section->srwx & 0x4;
+		for (Section* subsection : section->subsections) {
+			if (isExecutableAddr (subsection, addr))
+				return true;
+		}
+		return false;
+	}
+
+	JumpTable* JumpTableResolver::resolve (Binary* binary, Function* function, SSABB* block, uint64_t jmpaddr) {
+		auto it = cache.find (jmpaddr);
+		if (it != cache.end()) {
+			hits++;
+			return it->second.entries.empty() ? nullptr : &it->second;
+		}
+		this->binary = binary;
+		this->function = function;
+		slices++;
+
+		JumpTable& table = cache[jmpaddr];
+		table.id = 0;
+		table.addr = 0;
+		if (!slice (block, &table))
+			table.entries.clear();
+		this->function = nullptr;
+		return table.entries.empty() ? nullptr : &table;
+	}
+
+	bool JumpTableResolver::slice (SSABB* block, JumpTable* table) {
+		if (block->exprIds.empty())
+			return false;
+		SSAExpression* jmpExpr = function->ssaRep.expressions.get (block->exprIds.back());
+		if (!jmpExpr || jmpExpr->type != SSAExprType::eJmp || jmpExpr->subExpressions.empty())
+			return false;
+
+		JTValue target = evalArg (jmpExpr->subExpressions[0], {block, block->exprIds.size() - 1, 0});
+		if (target.kind != JTValue::eEntry || !target.table || target.scale != target.entrysize)
+			return false;
+
+		uint64_t count;
+		if (!sliceBound (block, &target, &count))
+			return false;
+		return readEntries (&target, count, table);
+	}
+
+	bool JumpTableResolver::sliceBound (SSABB* block, JTValue* target, uint64_t* count) {
+		//the table is only used if the jump to the default case before it is not taken
+		SSABB* predBlock = getPredecessor (block);
+		if (!predBlock || predBlock->exprIds.empty())
+			return false;
+		SSAExpression* cjmpExpr = function->ssaRep.expressions.get (predBlock->exprIds.back());
+		if (!cjmpExpr || cjmpExpr->type != SSAExprType::eCJmp || cjmpExpr->subExpressions.empty())
+			return false;
+
+		//ja/jae -> #not(#or($cf,$zf))/#not($cf)
+		JTSlicePos condPos;
+		SSAExpression* condExpr = findValueDef (cjmpExpr->subExpressions[0], {predBlock, predBlock->exprIds.size() - 1, 0}, &condPos);
+		if (!condExpr || condExpr->type != SSAExprType::eOp || condExpr->opType != SSAOpType::eNot || condExpr->subExpressions.size() != 1)
+			return false;
+		JTSlicePos innerPos;
+		SSAExpression* innerExpr = findValueDef (condExpr->subExpressions[0], condPos, &innerPos);
+		if (!innerExpr)
+			return false;
+
+		HList<SSAExpression*> flagExprs;
+		JTSlicePos flagPos = innerPos;
+		if (innerExpr->type == SSAExprType::eOp && innerExpr->opType == SSAOpType::eOr) {
+			for (SSAArgument& arg : innerExpr->subExpressions) {
+				SSAExpression* flagExpr = findValueDef (arg, innerPos, &flagPos);
+				if (!flagExpr)
+					return false;
+				flagExprs.push_back (flagExpr);
+			}
+		} else {
+			flagExprs.push_back (innerExpr);
+		}
+		bool carry = false, zero = false;
+		SSAArgument cmpArg;
+		for (SSAExpression* flagExpr : flagExprs) {
+			if (flagExpr->type != SSAExprType::eFlag || flagExpr->subExpressions.size() != 1 || flagExpr->subExpressions[0].type != SSAArgType::eId)
+				return false;
+			if (cmpArg.type == SSAArgType::eId && cmpArg.ssaId != flagExpr->subExpressions[0].ssaId)
+				return false;
+			cmpArg = flagExpr->subExpressions[0];
+			if (flagExpr->flagType == SSAFlagType::eC)
+				carry = true;
+			else if (flagExpr->flagType == SSAFlagType::eZ)
+				zero = true;
+			else
+				return false;
+		}
+		if (!carry)
+			return false;
+
+		//the flags have to come from comparing the index of the table against a constant
+		JTSlicePos cmpPos;
+		SSAExpression* cmpExpr = findValueDef (cmpArg, flagPos, &cmpPos);
+		if (!cmpExpr || cmpExpr->type != SSAExprType::eOp || cmpExpr->opType != SSAOpType::eSub || cmpExpr->subExpressions.size() != 2)
+			return false;
+		JTValue index = evalArg (cmpExpr->subExpressions[0], cmpPos);
+		JTValue bound = evalArg (cmpExpr->subExpressions[1], cmpPos);
+		if (index.kind != JTValue::eIndex || index.scale != 1 || index.value || bound.kind != JTValue::eConst || !jtSameLeaf (&index, target))
+			return false;
+
+		*count = bound.value + (zero ? 1 : 0);
+		return *count && *count <= H_JUMPTABLE_MAX_ENTRIES;
+	}
+
+	bool JumpTableResolver::readEntries (JTValue* target, uint64_t count, JumpTable* table) {
+		for (uint64_t i = 0; i < count; i++) {
+			uint64_t entryaddr = target->table + i * target->scale;
+			uint8_t* ptr = binary->getVDataPtr (entryaddr);
+			if (!ptr || binary->getVDataSize (entryaddr) < target->entrysize)
+				return false;
+			//entries are stored in the byte order of the host
+			uint64_t entry = 0;
+			memcpy (&entry, ptr, target->entrysize);
+			if (target->signext && target->entrysize < 8) {
+				uint64_t signbit = (uint64_t) 1 << (target->entrysize * 8 - 1);
+				entry = (entry ^ signbit) - signbit;
+			}
+			uint64_t targetaddr = target->value + entry;
+			bool executable = false;
+			for (Section* section : binary->sections) {
+				if (isExecutableAddr (section, targetaddr)) {
+					executable = true;
+					break;
+				}
+			}
+			if (!executable)
+				return false;
+			table->entries.push_back ({entryaddr, targetaddr, 0});
+		}
+		table->addr = target->table;
+		return true;
+	}
+
+	SSABB* JumpTableResolver::getPredecessor (SSABB* block) {
+		for (SSABB& bb : function->ssaRep.bbs) {
+			if (bb.id != block->id && bb.endaddr == block->startaddr)
+				return &bb;
+		}
+		return nullptr;
+	}
+
+	SSAExpression* JumpTableResolver::findDef (SSAArgument& arg, JTSlicePos pos, JTSlicePos* defpos) {
+		if (arg.type != SSAArgType::eId)
+			return nullptr;
+		//while analyzing, register reads have no ssa-id yet, so the last write to the register is searched
+		Register* reg = nullptr;
+		if (!arg.ssaId) {
+			if (arg.location != SSAExprLocation::eReg)
+				return nullptr;
+			reg = arch->getRegister (arg.locref.refId);
+			if (!reg || !reg->id)
+				return nullptr;
+		}
+		while (pos.block) {
+			while (pos.index) {
+				pos.index--;
+				SSAExpression* expr = function->ssaRep.expressions.get (pos.block->exprIds[pos.index]);
+				if (!expr)
+					continue;
+				if (!reg) {
+					if (expr->id != arg.ssaId)
+						continue;
+				} else {
+					if (expr->location != SSAExprLocation::eReg)
+						continue;
+					Register* defreg = arch->getRegister (expr->locref.refId);
+					if (defreg->parentRef.refId != reg->parentRef.refId)
+						continue;
+					if (reg->offset + reg->size <= defreg->offset || defreg->offset + defreg->size <= reg->offset)
+						continue;
+					//a write to only a part of the register ends the slice
+					if (reg->offset < defreg->offset || defreg->offset + defreg->size < reg->offset + reg->size)
+						return nullptr;
+					if (expr->type == SSAExprType::eUpdatePart && expr->subExpressions.size() == 3 && expr->subExpressions[2].type == SSAArgType::eUInt) {
+						//the write to the part itself comes right before the update of the parent
+						size_t partOffset = defreg->offset + expr->subExpressions[2].uval;
+						size_t partEnd = partOffset + expr->subExpressions[1].size;
+						if (reg->offset + reg->size <= partOffset || partEnd <= reg->offset || (partOffset <= reg->offset && reg->offset + reg->size <= partEnd))
+							continue;
+						return nullptr;
+					}
+				}
+				*defpos = pos;
+				return expr;
+			}
+			if (++pos.depth > H_JUMPTABLE_SLICE_DEPTH)
+				break;
+			pos.block = getPredecessor (pos.block);
+			if (pos.block)
+				pos.index = pos.block->exprIds.size();
+		}
+		return nullptr;
+	}
+
+	SSAExpression* JumpTableResolver::findValueDef (SSAArgument& arg, JTSlicePos pos, JTSlicePos* defpos) {
+		SSAExpression* expr = findDef (arg, pos, defpos);
+		while (expr && expr->type == SSAExprType::eAssign && expr->subExpressions.size() == 1 && expr->subExpressions[0].type == SSAArgType::eId)
+			expr = findDef (expr->subExpressions[0], *defpos, defpos);
+		return expr;
+	}
+
+	JTValue JumpTableResolver::evalArg (SSAArgument& arg, JTSlicePos pos) {
+		JTValue value;
+		switch (arg.type) {
+		case SSAArgType::eUInt:
+			value.kind = JTValue::eConst;
+			value.value = arg.uval;
+			return value;
+		case SSAArgType::eSInt:
+			value.kind = JTValue::eConst;
+			value.value = (uint64_t) arg.sval;
+			return value;
+		case SSAArgType::eId:
+			break;
+		default:
+			return value;
+		}
+		JTSlicePos defpos;
+		SSAExpression* expr = findDef (arg, pos, &defpos);
+		if (expr)
+			value = evalExpr (expr, defpos);
+		//everything that can not be sliced is a potential index
+		if (value.kind == JTValue::eUnknown && (expr || arg.location == SSAExprLocation::eReg)) {
+			value = JTValue();
+			value.kind = JTValue::eIndex;
+			if (expr)
+				value.leafExpr = expr->id;
+			else
+				value.leafReg = arch->getRegister (arg.locref.refId)->parentRef.refId;
+		}
+		return value;
+	}
+
+	JTValue JumpTableResolver::evalExpr (SSAExpression* expr, JTSlicePos pos) {
+		HList<SSAArgument>& args = expr->subExpressions;
+		switch (expr->type) {
+		case SSAExprType::eAssign:
+			if (args.size() == 1)
+				return evalArg (args[0], pos);
+			break;
+		case SSAExprType::eExtend:
+			if (args.size() == 1) {
+				JTValue value = evalArg (args[0], pos);
+				if (value.kind == JTValue::eEntry && !value.value && expr->returntype == SSAType::eInt)
+					value.signext = true;
+				return value;
+			}
+			break;
+		case SSAExprType::eOp:
+			switch (expr->opType) {
+			case SSAOpType::eAdd: {
+				if (args.empty())
+					break;
+				JTValue value = evalArg (args[0], pos);
+				for (size_t i = 1; i < args.size(); i++)
+					value = jtAdd (value, evalArg (args[i], pos));
+				return value;
+			}
+			case SSAOpType::eMul:
+			case SSAOpType::eShl: {
+				if (args.size() != 2)
+					break;
+				JTValue lhs = evalArg (args[0], pos);
+				JTValue rhs = evalArg (args[1], pos);
+				if (expr->opType == SSAOpType::eMul && lhs.kind == JTValue::eConst)
+					std::swap (lhs, rhs);
+				if (rhs.kind != JTValue::eConst || (expr->opType == SSAOpType::eShl && rhs.value >= 64))
+					break;
+				return jtMul (lhs, expr->opType == SSAOpType::eMul ? rhs.value : (uint64_t) 1 << rhs.value);
+			}
+			default:
+				break;
+			}
+			break;
+		case SSAExprType::eLoadAddr: {
+			//segment::[base + index*scale + disp]
+			if (args.size() != 5)
+				break;
+			JTValue segment = evalArg (args[0], pos);
+			JTValue scale = evalArg (args[3], pos);
+			if (segment.kind != JTValue::eConst || segment.value || scale.kind != JTValue::eConst)
+				break;
+			return jtAdd (jtAdd (evalArg (args[1], pos), jtMul (evalArg (args[2], pos), scale.value)), evalArg (args[4], pos));
+		}
+		case SSAExprType::eLoad: {
+			if (args.size() != 2)
+				break;
+			JTValue addr = evalArg (args[0], pos);
+			uint32_t entrysize = expr->size / 8;
+			if (addr.kind != JTValue::eIndex || (entrysize != 1 && entrysize != 2 && entrysize != 4 && entrysize != 8))
+				break;
+			JTValue value = addr;
+			value.kind = JTValue::eEntry;
+			value.table = addr.value;
+			value.value = 0;
+			value.entrysize = entrysize;
+			return value;
+		}
+		default:
+			break;
+		}
+		return JTValue();
+	}
+
+}
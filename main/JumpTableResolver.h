@@ -0,0 +1,76 @@
+#ifndef H_JUMPTABLERESOLVER_H
+#define H_JUMPTABLERESOLVER_H
+
+#include "General.h"
+#include "Function.h"
+#include "SSA.h"
+
+//upper limit for the number of entries taken from the bounds check
+#define H_JUMPTABLE_MAX_ENTRIES (4096)
+//how many blocks the slice may walk back by address
+#define H_JUMPTABLE_SLICE_DEPTH (4)
+
+namespace holodec {
+
+	class Architecture;
+	struct Binary;
+
+	//symbolic value of an expression in the slice
+	//eIndex: value + leaf * scale
+	//eEntry: value + (signext ? sext : zext) (load (table + leaf * scale, entrysize))
+	struct JTValue {
+		enum {
+			eUnknown = 0,
+			eConst,
+			eIndex,
+			eEntry
+		} kind = eUnknown;
+		uint64_t value = 0;
+		uint64_t scale = 1;
+		uint64_t table = 0;
+		uint32_t entrysize = 0;
+		bool signext = false;
+		//the value that could not be sliced any further
+		//either the id of the defining expression or the register if no definition was found
+		HId leafExpr = 0;
+		HId leafReg = 0;
+	};
+
+	struct JTSlicePos {
+		SSABB* block;
+		size_t index;//the expressions before this index are searched
+		uint32_t depth;
+	};
+
+	//resolves indirect jumps through bounds-checked tables with a backward slice on the ssa of the function that is analyzed
+	struct JumpTableResolver {
+		Architecture* arch;
+		Binary* binary = nullptr;
+		Function* function = nullptr;
+
+		//address of the jump -> table, a table without entries marks a jump that could not be resolved
+		HMap<uint64_t, JumpTable> cache;
+		size_t slices = 0;
+		size_t hits = 0;
+
+		JumpTableResolver (Architecture* arch) : arch (arch) {}
+
+		//block has to end with the eJmp of the instruction at jmpaddr
+		//returns nullptr if the jump does not go through a table
+		JumpTable* resolve (Binary* binary, Function* function, SSABB* block, uint64_t jmpaddr);
+
+		bool slice (SSABB* block, JumpTable* table);
+		bool sliceBound (SSABB* block, JTValue* target, uint64_t* count);
+		bool readEntries (JTValue* target, uint64_t count, JumpTable* table);
+
+		SSABB* getPredecessor (SSABB* block);
+		SSAExpression* findDef (SSAArgument& arg, JTSlicePos pos, JTSlicePos* defpos);
+		//like findDef but looks through copies
+		SSAExpression* findValueDef (SSAArgument& arg, JTSlicePos pos, JTSlicePos* defpos);
+		JTValue evalArg (SSAArgument& arg, JTSlicePos pos);
+		JTValue evalExpr (SSAExpression* expr, JTSlicePos pos);
+	};
+
+}
+
+#endif // H_JUMPTABLERESOLVER_H
@@ -1,10 +1,205 @@
 #include "Logger.h"
 
-Logger::Logger()
-{
-}
+#include <stdarg.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
 
-Logger::~Logger()
-{
-}
+namespace holodec {
+
+	Logger g_logger;
+
+	static const char* categoryNames[eLogCount] = {"general", "binary", "analysis", "ssa", "jobs"};
+	static const char* levelNames[] = {"off", "error", "warn", "info", "debug", "trace"};
+
+	//closes the buffer of a thread when the thread exits
+	struct LogBufferHolder {
+		LogBuffer* buffer = nullptr;
+		~LogBufferHolder() {
+			if (buffer)
+				g_logger.closeBuffer (buffer);
+		}
+	};
+
+	Logger::Logger() {
+		setLevel (H_LOG_LEVEL_INFO);
+	}
+
+	Logger::~Logger() {
+		stop();
+		setLevel (H_LOG_LEVEL_OFF);
+		for (LogBuffer* buffer : buffers)
+			delete buffer;
+		buffers.clear();
+		if (file)
+			fclose (file);
+		file = nullptr;
+	}
 
+	void Logger::log (LogCategory category, int level, const char* format, ...) {
+		char message[H_LOG_MESSAGE_MAX];
+		va_list args;
+		va_start (args, format);
+		int length = vsnprintf (message, sizeof (message), format, args);
+		va_end (args);
+		if (length <= 0)
+			return;
+		size_t size = std::min ((size_t) length, sizeof (message) - 1);
+
+		if (stopped.load()) {
+			std::unique_lock<std::mutex> lock (mutex);
+			fwrite (message, 1, size, file ? file : stderr);
+			return;
+		}
+		LogBuffer* buffer = getBuffer();
+		size_t head = buffer->head.load (std::memory_order_relaxed);
+		while (H_LOG_BUFFER_SIZE - (head - buffer->tail.load (std::memory_order_acquire)) < size) {
+			//the buffer is full, wait for the writer
+			cond.notify_one();
+			std::this_thread::yield();
+		}
+		size_t pos = head & (H_LOG_BUFFER_SIZE - 1);
+		size_t first = std::min (size, (size_t) H_LOG_BUFFER_SIZE - pos);
+		memcpy (buffer->data + pos, message, first);
+		memcpy (buffer->data, message + first, size - first);
+		buffer->head.store (head + size, std::memory_order_release);
+		//problems are written soon, everything else when the writer wakes up on its own
+		if (level <= H_LOG_LEVEL_WARN || head + size - buffer->tail.load (std::memory_order_relaxed) > H_LOG_BUFFER_SIZE / 2)
+			cond.notify_one();
+	}
+
+	void Logger::setLevel (LogCategory category, int level) {
+		levels[category].store (level);
+	}
+	void Logger::setLevel (int level) {
+		for (int i = 0; i < eLogCount; i++)
+			levels[i].store (level);
+	}
+	bool Logger::configure (const char* spec) {
+		const char* it = spec;
+		while (*it) {
+			const char* end = strchr (it, ',');
+			std::string entry (it, end ? end - it : strlen (it));
+			it = end ? end + 1 : it + entry.size();
+
+			size_t split = entry.find ('=');
+			std::string category = split == std::string::npos ? "all" : entry.substr (0, split);
+			std::string levelname = split == std::string::npos ? entry : entry.substr (split + 1);
+			int level = -1;
+			for (int i = 0; i <= H_LOG_LEVEL_TRACE; i++) {
+				if (levelname == levelNames[i])
+					level = i;
+			}
+			if (level < 0) {
+				printf ("Unknown Log-Level %s\n", levelname.c_str());
+				return false;
+			}
+			if (category == "all") {
+				setLevel (level);
+				continue;
+			}
+			bool found = false;
+			for (int i = 0; i < eLogCount; i++) {
+				if (category == categoryNames[i]) {
+					setLevel ((LogCategory) i, level);
+					found = true;
+				}
+			}
+			if (!found) {
+				printf ("Unknown Log-Category %s\n", category.c_str());
+				return false;
+			}
+		}
+		return true;
+	}
+	bool Logger::open (const char* path) {
+		FILE* newfile = fopen (path, "w");
+		if (!newfile) {
+			printf ("Could not open Log-File %s\n", path);
+			return false;
+		}
+		std::unique_lock<std::mutex> lock (mutex);
+		drain();
+		if (file)
+			fclose (file);
+		file = newfile;
+		return true;
+	}
+
+	void Logger::flush() {
+		std::unique_lock<std::mutex> lock (mutex);
+		drain();
+	}
+	void Logger::stop() {
+		{
+			std::unique_lock<std::mutex> lock (mutex);
+			if (stopped.load())
+				return;
+			stopped.store (true);
+			running = false;
+		}
+		cond.notify_all();
+		if (writer) {
+			writer->join();
+			delete writer;
+			writer = nullptr;
+		}
+		std::unique_lock<std::mutex> lock (mutex);
+		drain();
+	}
+
+	LogBuffer* Logger::getBuffer() {
+		thread_local LogBufferHolder holder;
+		if (!holder.buffer) {
+			holder.buffer = new LogBuffer();
+			std::unique_lock<std::mutex> lock (mutex);
+			buffers.push_back (holder.buffer);
+			//started with the first message, so nothing runs if logging is off
+			if (!writer && !stopped.load()) {
+				running = true;
+				writer = new std::thread (&Logger::writeLoop, this);
+			}
+		}
+		return holder.buffer;
+	}
+	void Logger::closeBuffer (LogBuffer* buffer) {
+		std::unique_lock<std::mutex> lock (mutex);
+		buffer->closed.store (true, std::memory_order_release);
+		if (!running)
+			drain();
+	}
+	void Logger::writeLoop() {
+		std::unique_lock<std::mutex> lock (mutex);
+		while (running) {
+			cond.wait_for (lock, std::chrono::milliseconds (10));
+			drain();
+		}
+	}
+	void Logger::drain() {
+		FILE* out = file ? file : stderr;
+		bool written = false;
+		for (auto it = buffers.begin(); it != buffers.end();) {
+			LogBuffer* buffer = *it;
+			//read before head, everything of a closed buffer is visible then
+			bool closed = buffer->closed.load (std::memory_order_acquire);
+			size_t tail = buffer->tail.load (std::memory_order_relaxed);
+			size_t head = buffer->head.load (std::memory_order_acquire);
+			if (head != tail) {
+				size_t pos = tail & (H_LOG_BUFFER_SIZE - 1);
+				size_t first = std::min (head - tail, (size_t) H_LOG_BUFFER_SIZE - pos);
+				fwrite (buffer->data + pos, 1, first, out);
+				fwrite (buffer->data, 1, head - tail - first, out);
+				buffer->tail.store (head, std::memory_order_release);
+				written = true;
+			}
+			if (closed) {
+				delete buffer;
+				it = buffers.erase (it);
+				continue;
+			}
+			++it;
+		}
+		if (written)
+			fflush (out);
+	}
+}
@@ -1,12 +1,111 @@
 #ifndef HLOGGEH_H
 #define HLOGGEH_H
 
-class Logger
-{
-public:
-	Logger();
-	~Logger();
+#include "General.h"
 
-};
+#include <stdio.h>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+//levels as numbers so the preprocessor can compare them
+#define H_LOG_LEVEL_OFF (0)
+#define H_LOG_LEVEL_ERROR (1)
+#define H_LOG_LEVEL_WARN (2)
+#define H_LOG_LEVEL_INFO (3)
+#define H_LOG_LEVEL_DEBUG (4)
+#define H_LOG_LEVEL_TRACE (5)
+
+//calls above this level are removed when compiling, the arguments are not evaluated
+#ifndef H_LOG_MAX_LEVEL
+#define H_LOG_MAX_LEVEL H_LOG_LEVEL_DEBUG
+#endif
+
+//size of the buffer of each thread, has to be a power of 2
+#define H_LOG_BUFFER_SIZE (1 << 16)
+//longer messages are cut
+#define H_LOG_MESSAGE_MAX (1024)
+
+#define H_LOG(category, level, ...) \
+	do { \
+		if ((level) <= H_LOG_MAX_LEVEL && holodec::g_logger.isEnabled (category, level)) \
+			holodec::g_logger.log (category, level, __VA_ARGS__); \
+	} while (0)
+
+#define H_LOG_ERROR(category, ...) H_LOG (category, H_LOG_LEVEL_ERROR, __VA_ARGS__)
+#define H_LOG_WARN(category, ...) H_LOG (category, H_LOG_LEVEL_WARN, __VA_ARGS__)
+#define H_LOG_INFO(category, ...) H_LOG (category, H_LOG_LEVEL_INFO, __VA_ARGS__)
+#define H_LOG_DEBUG(category, ...) H_LOG (category, H_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define H_LOG_TRACE(category, ...) H_LOG (category, H_LOG_LEVEL_TRACE, __VA_ARGS__)
+
+namespace holodec {
+
+	enum LogCategory {
+		eLogGeneral = 0,
+		eLogBinary,
+		eLogAnalysis,
+		eLogSSA,
+		eLogJobs,
+		eLogCount
+	};
+
+	//messages of one thread, written only by that thread and read only by the writer
+	struct LogBuffer {
+		char data[H_LOG_BUFFER_SIZE];
+		std::atomic<size_t> head = {0};
+		std::atomic<size_t> tail = {0};
+		//the thread exited, removed by the writer when it is empty
+		std::atomic<bool> closed = {false};
+	};
+
+	//messages are formatted by the calling thread into its own buffer without locking
+	//a background thread writes the buffers out, so no thread waits for the output unless its buffer is full
+	//the order is kept for the messages of one thread but not between threads
+	class Logger {
+	public:
+		Logger();
+		~Logger();
+
+		bool isEnabled (LogCategory category, int level) {
+			return level <= levels[category].load (std::memory_order_relaxed);
+		}
+		void log (LogCategory category, int level, const char* format, ...) __attribute__ ((format (printf, 4, 5)));
+
+		void setLevel (LogCategory category, int level);
+		void setLevel (int level);
+		//a list like "ssa=debug,jobs=off" or only a level for all categories
+		bool configure (const char* spec);
+		//stderr is used if no file is opened
+		bool open (const char* path);
+
+		//writes everything logged so far
+		void flush();
+		//flushes and stops the writer, messages after this are written directly
+		void stop();
+
+	private:
+		std::atomic<int> levels[eLogCount];
+		FILE* file = nullptr;
+
+		HList<LogBuffer*> buffers;
+		std::mutex mutex;
+		std::condition_variable cond;
+		std::thread* writer = nullptr;
+		bool running = false;
+		std::atomic<bool> stopped = {false};
+
+		LogBuffer* getBuffer();
+		void closeBuffer (LogBuffer* buffer);
+		void writeLoop();
+		//needs the lock
+		void drain();
+
+		friend struct LogBufferHolder;
+	};
+
+	extern Logger g_logger;
+}
 
 #endif // HLOGGEH_H
@@ -2,156 +2,311 @@
 
 
 #include <fstream>
+#include <memory>
 #include <cctype>
+#include <string.h>
 #include "SSAPeepholeOptimizer.h"
+#include "Profiler.h"
+#include "PhRules.h"
 
 namespace holodec {
 
+	static uint64_t rootKey (SSAExprType type, uint64_t subtype) {
+		return ((uint64_t) type << 32) | subtype;
+	}
 
-	typedef std::function<void (Architecture*, SSARepresentation*, MatchContext*) > PhExecutor;
+	void PhAutomaton::compile (PhRuleSet* ruleSet) {
+		states.clear();
+		executors.clear();
+		rootIndex.clear();
+		wildcardRoots.clear();
+		rootLists.clear();
 
-	struct PhRule {
-		HId matchedIndex;
-		HId argIndex;
-		SSAExprType type;
-		SSAOpType opType;
-		SSAFlagType flagType;
-		std::vector<PhRule*> subRules;
-		PhExecutor executor;
+		PhRule* baserule = &ruleSet->baserule;
+		states.push_back ({0, 0, SSAExprType::eInvalid, SSAOpType::eInvalid, SSAFlagType::eUnknown, 0, 0, 0, -1});
+		uint32_t firstRoot = addState (baserule);
+		states[0].firstChild = firstRoot;
+		states[0].childCount = baserule->subRules.size();
 
-		PhRule (HId matchedIndex, HId argIndex, SSAExprType type, SSAOpType opType, SSAFlagType flagType) : matchedIndex(matchedIndex), argIndex (argIndex), type (type), opType(opType), flagType(flagType) {}
+		for (uint32_t i = firstRoot; i < firstRoot + baserule->subRules.size(); i++) {
+			PhState& state = states[i];
+			//the index is only a prefilter, a rule that looks at another expression than the visited one has to be tried for all of them
+			if (state.matchedIndex || state.argIndex || state.type == SSAExprType::eInvalid)
+				wildcardRoots.push_back (i);
+			else if (state.type == SSAExprType::eOp && state.opType != SSAOpType::eInvalid && state.flagType == SSAFlagType::eUnknown)
+				rootIndex[rootKey (state.type, (uint64_t) state.opType)].push_back (i);
+			else if (state.type == SSAExprType::eFlag && state.flagType != SSAFlagType::eUnknown && state.opType == SSAOpType::eInvalid)
+				rootIndex[rootKey (state.type, (uint64_t) state.flagType)].push_back (i);
+			else
+				rootIndex[rootKey (state.type, H_PH_ANY_SUBTYPE)].push_back (i);
+		}
+	}
 
-		bool matchRule (Architecture* arch, SSARepresentation* ssaRep, SSAExpression* expr, MatchContext* context) {
-			bool matched = false;
-			if(matchedIndex && matchedIndex <= context->expressionsMatched.size()){
-				expr = &ssaRep->expressions[context->expressionsMatched[matchedIndex - 1]];
-				matched = true;
-			}
-			if (argIndex && argIndex <= expr->subExpressions.size() && expr->subExpressions[argIndex - 1].type == SSAArgType::eId){
-				expr = &ssaRep->expressions[expr->subExpressions[argIndex - 1].ssaId];
-				matched = true;
+	//adds the children of rule consecutively and returns the index of the first one
+	uint32_t PhAutomaton::addState (PhRule* rule) {
+		uint32_t firstChild = states.size();
+		for (PhRule* subRule : rule->subRules) {
+			int32_t executor = -1;
+			if (subRule->executor) {
+				executor = executors.size();
+				executors.push_back (subRule->executor);
 			}
-			if (type != SSAExprType::eInvalid && type == expr->type)
-				matched = true;
-			else if(type != SSAExprType::eInvalid)
+			states.push_back ({subRule->matchedIndex, subRule->argIndex, subRule->type, subRule->opType, subRule->flagType, subRule->size, 0, (uint32_t) subRule->subRules.size(), executor});
+		}
+		for (size_t i = 0; i < rule->subRules.size(); i++) {
+			uint32_t childIndex = addState (rule->subRules[i]);
+			states[firstChild + i].firstChild = childIndex;
+		}
+		return firstChild;
+	}
+
+	bool PhAutomaton::matchState (uint32_t stateIndex, Architecture* arch, SSARepresentation* ssaRep, SSAExpression* expr, MatchContext* context) {
+		PhState& state = states[stateIndex];
+		bool matched = false;
+		if (state.matchedIndex) {
+			if (state.matchedIndex > context->expressionsMatched.size())
 				return false;
-			if(opType != SSAOpType::eInvalid && opType == expr->opType)
-				matched = true;
-			else if(opType != SSAOpType::eInvalid)
+			expr = &ssaRep->expressions[context->expressionsMatched[state.matchedIndex - 1]];
+			matched = true;
+		}
+		if (state.argIndex) {
+			if (state.argIndex > expr->subExpressions.size() || expr->subExpressions[state.argIndex - 1].type != SSAArgType::eId)
 				return false;
-			if(flagType != SSAFlagType::eUnknown && flagType == expr->flagType)
-				matched = true;
-			else if(flagType != SSAFlagType::eUnknown)
+			expr = &ssaRep->expressions[expr->subExpressions[state.argIndex - 1].ssaId];
+			matched = true;
+		}
+		if (state.type != SSAExprType::eInvalid) {
+			if (state.type != expr->type)
 				return false;
-			if(matched)
-				context->expressionsMatched.push_back (expr->id);
-			for (PhRule* rule : subRules) {
-				rule->matchRule (arch, ssaRep, expr, context);
-			}
-			if (executor)
-				executor (arch, ssaRep, context);
+			matched = true;
 		}
-	};
-
-	struct PhRuleSet {
-		PhRule baserule = PhRule (0, 0, SSAExprType::eInvalid, SSAOpType::eInvalid, SSAFlagType::eUnknown);
-	};
-
-	struct RuleBuilder {
-		PhRuleSet* ruleSet;
-		PhRule* rule;
-
-		RuleBuilder (PhRuleSet& ruleSet) : ruleSet (&ruleSet), rule (&ruleSet.baserule) {}
-
-		RuleBuilder& ssaType (HId matchIndex, HId index, SSAExprType type) {
-			return ssaType(matchIndex, index, type, SSAOpType::eInvalid, SSAFlagType::eUnknown);
+		if (state.opType != SSAOpType::eInvalid) {
+			if (state.opType != expr->opType)
+				return false;
+			matched = true;
 		}
-		RuleBuilder& ssaType (HId matchIndex, HId index, SSAExprType type, SSAFlagType flagType) {
-			return ssaType(matchIndex, index, type, SSAOpType::eInvalid, flagType);
+		if (state.flagType != SSAFlagType::eUnknown) {
+			if (state.flagType != expr->flagType)
+				return false;
+			matched = true;
 		}
-		RuleBuilder& ssaType (HId matchIndex, HId index, SSAExprType type, SSAOpType opType) {
-			return ssaType(matchIndex, index, type, opType, SSAFlagType::eUnknown);
+		if (state.size) {
+			if (state.size != expr->size)
+				return false;
+			matched = true;
 		}
-		RuleBuilder& ssaType (HId matchIndex, HId index, SSAExprType type, SSAOpType opType, SSAFlagType flagType) {
-			for (PhRule* itRule : rule->subRules) {
-				if (itRule->argIndex == index && itRule->type == type && itRule->opType == opType && itRule->flagType == flagType) {
-					rule = itRule;
-					return *this;
-				}
-			}
-			PhRule* newRule = new PhRule (matchIndex, index, type, opType, flagType);
-			rule->subRules.push_back (newRule);
-			rule = newRule;
-			return *this;
+		if (matched)
+			context->expressionsMatched.push_back (expr->id);
+		bool executed = false;
+		for (uint32_t i = state.firstChild; !executed && i < state.firstChild + state.childCount; i++) {
+			executed = matchState (i, arch, ssaRep, expr, context);
+		}
+		if (!executed && state.executor >= 0) {
+			//the executor may add expressions so expr is not valid afterwards
+			context->expressionsChanged.insert (context->expressionsChanged.end(), context->expressionsMatched.begin(), context->expressionsMatched.end());
+			executors[state.executor] (arch, ssaRep, context);
+			executed = true;
 		}
+		//the matched expressions are only valid for the path to this state
+		if (matched)
+			context->expressionsMatched.pop_back();
+		return executed;
+	}
 
-		RuleBuilder& execute (PhExecutor executor) {
-			if (rule)
-				rule->executor = executor;
+	void PhAutomaton::getRoots (SSAExprType type, uint64_t subtype, HList<uint32_t>* roots) {
+		const HList<uint32_t>* candidates[3] = {nullptr, nullptr, &wildcardRoots};
+		if (subtype != H_PH_ANY_SUBTYPE) {
+			auto it = rootIndex.find (rootKey (type, subtype));
+			if (it != rootIndex.end())
+				candidates[0] = &it->second;
+		}
+		auto it = rootIndex.find (rootKey (type, H_PH_ANY_SUBTYPE));
+		if (it != rootIndex.end())
+			candidates[1] = &it->second;
+		roots->clear();
+		for (const HList<uint32_t>* list : candidates) {
+			if (list)
+				roots->insert (roots->end(), list->begin(), list->end());
 		}
+		//the rules are tried in the order they were added
+		std::sort (roots->begin(), roots->end());
+	}
+
+	bool PhAutomaton::match (Architecture* arch, SSARepresentation* ssaRep, SSAExpression* expr, MatchContext* context) {
+		if (states.empty())
+			return false;
+		uint64_t subtype = H_PH_ANY_SUBTYPE;
+		if (expr->type == SSAExprType::eOp)
+			subtype = (uint64_t) expr->opType;
+		else if (expr->type == SSAExprType::eFlag)
+			subtype = (uint64_t) expr->flagType;
 
-		RuleBuilder& build() {
-			rule = &ruleSet->baserule;
+		uint64_t key = rootKey (expr->type, subtype);
+		auto it = rootLists.find (key);
+		if (it == rootLists.end()) {
+			it = rootLists.insert (std::make_pair (key, HList<uint32_t>())).first;
+			getRoots (expr->type, subtype, &it->second);
 		}
+		for (uint32_t index : it->second) {
+			if (matchState (index, arch, ssaRep, expr, context))
+				return true;
+		}
+		return false;
+	}
+
+	void phFlagToCompare (Architecture* arch, SSARepresentation* ssaRep, MatchContext* context, const uint64_t* params, size_t paramcount) {
+		if (paramcount != 1 || context->expressionsMatched.size() < 2)
+			return;
+		HId flagId = context->expressionsMatched[0];
+		HId opId = context->expressionsMatched[1];
+
+		SSAArgument rhs;
+		if (ssaRep->expressions[opId].subExpressions.size() > 2) {
+			SSAExpression& opExpr = ssaRep->expressions[opId];
+			SSAExpression addExpr;
+			addExpr.type = SSAExprType::eOp;
+			addExpr.size = opExpr.size;
+			addExpr.returntype = opExpr.returntype;
+			addExpr.opType = SSAOpType::eAdd;
+			addExpr.subExpressions.insert (addExpr.subExpressions.begin(), opExpr.subExpressions.begin() + 1, opExpr.subExpressions.end());
+			addExpr.instrAddr = opExpr.instrAddr;
+			//addBefore can move the expressions, so references are taken afterwards
+			rhs = SSAArgument::create (ssaRep->addBefore (&addExpr, opId), addExpr.size);
+		} else if (ssaRep->expressions[opId].subExpressions.size() == 2) {
+			rhs = ssaRep->expressions[opId].subExpressions[1];
+		} else {
+			return;
+		}
+		SSAExpression& flagExpr = ssaRep->expressions[flagId];
+		SSAExpression& opExpr = ssaRep->expressions[opId];
+		flagExpr.type = SSAExprType::eOp;
+		flagExpr.opType = (SSAOpType) params[0];
+		flagExpr.subExpressions = {opExpr.subExpressions[0], rhs};
+	}
+
+	static const PhActionDef phActions[] = {
+		{"flagtocompare", "holodec::phFlagToCompare", phFlagToCompare},
 	};
 
-	PeepholeOptimizer* parsePhOptimizer (Architecture* arch, Function* func) {
-
-		PhRuleSet ruleSet;
-
-		RuleBuilder builder (ruleSet);
-
-		builder.ssaType (0, 0, SSAExprType::eFlag, SSAFlagType::eZ).ssaType (0, 1, SSAExprType::eOp, SSAOpType::eSub).execute ([] (Architecture * arch, SSARepresentation * ssaRep, MatchContext * context) {
-			SSAExpression& flagExpr = ssaRep->expressions[context->expressionsMatched[0]];
-			SSAExpression& opExpr = ssaRep->expressions[context->expressionsMatched[1]];
-
-			flagExpr.type = SSAExprType::eOp;
-			flagExpr.opType = SSAOpType::eEq;
-			if (opExpr.subExpressions.size() > 2) {
-				SSAExpression addExpr;
-				addExpr.type = SSAExprType::eOp;
-				addExpr.size = opExpr.size;
-				addExpr.returntype = opExpr.returntype;
-				addExpr.opType = SSAOpType::eAdd;
-				addExpr.subExpressions.insert (addExpr.subExpressions.begin(), opExpr.subExpressions.begin() + 1, opExpr.subExpressions.end());
-				addExpr.instrAddr = opExpr.instrAddr;
-				
-				flagExpr.subExpressions = {opExpr.subExpressions[0], SSAArgument::create(ssaRep->addBefore (&addExpr, opExpr.id), addExpr.size)};
-				
-			} else if (opExpr.subExpressions.size() == 2) {
-				flagExpr.subExpressions = {opExpr.subExpressions[0], opExpr.subExpressions[1]};
+	const PhActionDef* getPhAction (const char* name) {
+		for (const PhActionDef& action : phActions) {
+			if (strcmp (action.name, name) == 0)
+				return &action;
+		}
+		return nullptr;
+	}
+
+	PeepholeOptimizer::PeepholeOptimizer (Architecture* arch) : arch (arch) {}
+
+	void PeepholeOptimizer::compile() {
+		automaton.compile (&ruleSet);
+	}
+
+	bool PeepholeOptimizer::loadRules (const char* path, const PhCompiledRules* generated) {
+		PhRuleSet newRuleSet;
+		if (!parsePhRules (path, &newRuleSet))
+			return false;
+		//PhRule owns its subrules, so they are moved over instead of copying the set
+		for (PhRule* rule : ruleSet.baserule.subRules)
+			delete rule;
+		ruleSet.baserule.subRules = newRuleSet.baserule.subRules;
+		newRuleSet.baserule.subRules.clear();
+		compile();
+
+		compiledRules = nullptr;
+		if (generated && generated->match && generated->checksum == phRuleChecksum (&ruleSet))
+			compiledRules = generated;
+		return true;
+	}
+	void PeepholeOptimizer::useRules (const PhCompiledRules* generated) {
+		compiledRules = generated;
+	}
+
+	void PeepholeOptimizer::optimize (Function* func) {
+		H_PROFILE_SCOPE ("Peephole");
+		SSARepresentation* ssaRep = &func->ssaRep;
+
+		//changed expressions are added again, so the users are a set
+		HMap<HId, HSet<HId>> users;
+		auto addUsers = [ssaRep, &users] (HId id) {
+			for (SSAArgument& arg : ssaRep->expressions[id].subExpressions) {
+				if (arg.type == SSAArgType::eId && arg.ssaId)
+					users[arg.ssaId].insert (id);
 			}
-		});
-		builder.ssaType (0, 0, SSAExprType::eFlag, SSAFlagType::eC).ssaType (0, 1, SSAExprType::eOp, SSAOpType::eSub).execute ([] (Architecture * arch, SSARepresentation * ssaRep, MatchContext * context) {
-			SSAExpression& flagExpr = ssaRep->expressions[context->expressionsMatched[0]];
-			SSAExpression& opExpr = ssaRep->expressions[context->expressionsMatched[1]];
-			flagExpr.type = SSAExprType::eOp;
-			flagExpr.opType = SSAOpType::eLower;
-			
-			if (opExpr.subExpressions.size() > 2) {
-				SSAExpression addExpr;
-				addExpr.type = SSAExprType::eOp;
-				addExpr.size = opExpr.size;
-				addExpr.returntype = opExpr.returntype;
-				addExpr.opType = SSAOpType::eAdd;
-				addExpr.subExpressions.insert (addExpr.subExpressions.begin(), opExpr.subExpressions.begin() + 1, opExpr.subExpressions.end());
-				addExpr.instrAddr = opExpr.instrAddr;
-				
-				flagExpr.subExpressions = {opExpr.subExpressions[0], SSAArgument::create(ssaRep->addBefore (&addExpr, opExpr.id), addExpr.size)};
-				
-			} else if (opExpr.subExpressions.size() == 2) {
-				flagExpr.subExpressions = {opExpr.subExpressions[0], opExpr.subExpressions[1]};
+		};
+
+		//visited in ascending id order, operands mostly come before their users
+		//phis and expressions created by rules can use later ids, the users of a changed expression are queued again for them
+		HList<HId> worklist;
+		HList<bool> queued (ssaRep->expressions.size() + 1, false);
+		size_t head = 0;
+		auto enqueue = [&worklist, &queued] (HId id) {
+			if (id >= queued.size())
+				queued.resize (id + 1, false);
+			if (!queued[id]) {
+				queued[id] = true;
+				worklist.push_back (id);
 			}
-		});
+		};
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (!expr.id)
+				continue;
+			addUsers (expr.id);
+			enqueue (expr.id);
+		}
+
+		while (head < worklist.size()) {
+			HId id = worklist[head++];
+			queued[id] = false;
+			if (id > ssaRep->expressions.size() || !ssaRep->expressions[id].id)
+				continue;
+			visited++;
 
-		for (SSAExpression& expr : func->ssaRep.expressions) {
 			MatchContext context;
-			ruleSet.baserule.matchRule (arch, &func->ssaRep, &expr, &context);
+			size_t lastId = ssaRep->expressions.size();
+			bool matched;
+			if (compiledRules)
+				matched = compiledRules->match (arch, ssaRep, &ssaRep->expressions[id], &context);
+			else
+				matched = automaton.match (arch, ssaRep, &ssaRep->expressions[id], &context);
+			if (!matched)
+				continue;
+			executed++;
+
+			//changed expressions are visited again together with their users
+			for (size_t newId = lastId + 1; newId <= ssaRep->expressions.size(); newId++) {
+				addUsers (newId);
+				enqueue (newId);
+			}
+			for (HId changedId : context.expressionsChanged) {
+				if (!ssaRep->expressions[changedId].id)
+					continue;
+				addUsers (changedId);
+				enqueue (changedId);
+				auto it = users.find (changedId);
+				if (it == users.end())
+					continue;
+				for (HId userId : it->second)
+					enqueue (userId);
+			}
 		}
-		
-		func->ssaRep.recalcRefCounts();
-		
-		return nullptr;
+
+		ssaRep->recalcRefCounts();
+	}
+
+	PeepholeOptimizer* parsePhOptimizer (Architecture* arch, Function* func, const char* rulefile) {
+		//the rules are compiled once per architecture and thread, the optimizer keeps state while optimizing
+		static thread_local HMap<Architecture*, std::unique_ptr<PeepholeOptimizer>> optimizers;
+
+		std::unique_ptr<PeepholeOptimizer>& optimizer = optimizers[arch];
+		if (!optimizer) {
+			optimizer.reset (new PeepholeOptimizer (arch));
+			//rules that differ from the generated ones are interpreted
+			if (!rulefile || !optimizer->loadRules (rulefile, &phstandardrules))
+				optimizer->useRules (&phstandardrules);
+		}
+		optimizer->optimize (func);
+		return optimizer.get();
 	}
 
 }
@@ -3,22 +3,169 @@
 
 #include "HString.h"
 #include "Architecture.h"
+#include "SSAPeepholeOptimizer.h"
 
+//subtype of the root states that test the type of an expression but not the op-/flag-type
+#define H_PH_ANY_SUBTYPE (0xFFFFFFFFULL)
 
 namespace holodec {
 
-	
-	struct PeepholeOptimizer {
-		
-		//std::vector<>
-		
-		
-		PeepholeOptimizer(HString filename, Architecture* arch){
-			
+	typedef std::function<void (Architecture*, SSARepresentation*, MatchContext*) > PhExecutor;
+	typedef void (*PhActionFunc) (Architecture* arch, SSARepresentation* ssaRep, MatchContext* context, const uint64_t* params, size_t paramcount);
+
+	//an action that can be used in the actions-block of a .ph file
+	struct PhActionDef {
+		const char* name;
+		//the function generated matchers call
+		const char* symbol;
+		PhActionFunc func;
+	};
+	struct PhActionCall {
+		const PhActionDef* def;
+		HList<uint64_t> params;
+		//the key every parameter was given with, the generator writes named values as symbols
+		HList<HString> paramKeys;
+	};
+
+	//matcher generated from .ph files with "holodec --gen-ph-rules"
+	struct PhCompiledRules {
+		//checksum of the rules the matcher was generated from
+		uint64_t checksum;
+		bool (*match) (Architecture* arch, SSARepresentation* ssaRep, SSAExpression* expr, MatchContext* context);
+	};
+
+	//a rule as written by the RuleBuilder or read from a .ph file, only used to compile the PhAutomaton
+	struct PhRule {
+		HId matchedIndex;
+		HId argIndex;
+		SSAExprType type;
+		SSAOpType opType;
+		SSAFlagType flagType;
+		uint64_t size = 0;
+		std::vector<PhRule*> subRules;
+		PhExecutor executor;
+		//set for rules read from a .ph file, code can only be generated for these
+		HList<PhActionCall> actions;
+
+		PhRule (HId matchedIndex, HId argIndex, SSAExprType type, SSAOpType opType, SSAFlagType flagType) : matchedIndex(matchedIndex), argIndex (argIndex), type (type), opType(opType), flagType(flagType) {}
+		~PhRule() {
+			for (PhRule* rule : subRules)
+				delete rule;
 		}
 	};
-	
-	PeepholeOptimizer* parsePhOptimizer(Architecture* arch, Function* func);
+
+	struct PhRuleSet {
+		PhRule baserule = PhRule (0, 0, SSAExprType::eInvalid, SSAOpType::eInvalid, SSAFlagType::eUnknown);
+	};
+
+	struct RuleBuilder {
+		PhRuleSet* ruleSet;
+		PhRule* rule;
+
+		RuleBuilder (PhRuleSet& ruleSet) : ruleSet (&ruleSet), rule (&ruleSet.baserule) {}
+
+		RuleBuilder& ssaType (HId matchIndex, HId index, SSAExprType type) {
+			return ssaType(matchIndex, index, type, SSAOpType::eInvalid, SSAFlagType::eUnknown);
+		}
+		RuleBuilder& ssaType (HId matchIndex, HId index, SSAExprType type, SSAFlagType flagType) {
+			return ssaType(matchIndex, index, type, SSAOpType::eInvalid, flagType);
+		}
+		RuleBuilder& ssaType (HId matchIndex, HId index, SSAExprType type, SSAOpType opType) {
+			return ssaType(matchIndex, index, type, opType, SSAFlagType::eUnknown);
+		}
+		RuleBuilder& ssaType (HId matchIndex, HId index, SSAExprType type, SSAOpType opType, SSAFlagType flagType) {
+			for (PhRule* itRule : rule->subRules) {
+				if (itRule->matchedIndex == matchIndex && itRule->argIndex == index && itRule->type == type && itRule->opType == opType && itRule->flagType == flagType) {
+					rule = itRule;
+					return *this;
+				}
+			}
+			PhRule* newRule = new PhRule (matchIndex, index, type, opType, flagType);
+			rule->subRules.push_back (newRule);
+			rule = newRule;
+			return *this;
+		}
+
+		RuleBuilder& execute (PhExecutor executor) {
+			if (rule)
+				rule->executor = executor;
+			return *this;
+		}
+
+		RuleBuilder& build() {
+			rule = &ruleSet->baserule;
+			return *this;
+		}
+	};
+
+	//a rule flattened into the automaton, the children of a state are stored consecutively
+	struct PhState {
+		HId matchedIndex;
+		HId argIndex;
+		SSAExprType type;
+		SSAOpType opType;
+		SSAFlagType flagType;
+		uint64_t size;
+		uint32_t firstChild;
+		uint32_t childCount;
+		int32_t executor;//-1 if no executor
+	};
+
+	//the rule tree compiled into flat states
+	//the root states are indexed by expression type and op-/flag-type so an expression only visits the rules that can match it
+	struct PhAutomaton {
+		HList<PhState> states;
+		HList<PhExecutor> executors;
+		HMap<uint64_t, HList<uint32_t>> rootIndex;
+		//roots that do not test the type of the expression
+		HList<uint32_t> wildcardRoots;
+		//result of getRoots per key of rootIndex
+		HMap<uint64_t, HList<uint32_t>> rootLists;
+
+		void compile (PhRuleSet* ruleSet);
+		//the root states that have to be tried for an expression with this type and op-/flag-type in the order of the rules
+		void getRoots (SSAExprType type, uint64_t subtype, HList<uint32_t>* roots);
+		//returns true if an executor was run, the expressions of the match are added to context->expressionsChanged
+		bool match (Architecture* arch, SSARepresentation* ssaRep, SSAExpression* expr, MatchContext* context);
+
+	private:
+		uint32_t addState (PhRule* rule);
+		bool matchState (uint32_t stateIndex, Architecture* arch, SSARepresentation* ssaRep, SSAExpression* expr, MatchContext* context);
+	};
+
+	struct PeepholeOptimizer {
+		Architecture* arch;
+		PhRuleSet ruleSet;
+		PhAutomaton automaton;
+		//used instead of the automaton if set
+		const PhCompiledRules* compiledRules = nullptr;
+
+		size_t visited = 0;
+		size_t executed = 0;
+
+		PeepholeOptimizer (Architecture* arch);
+
+		//rules are added with the RuleBuilder on ruleSet and compiled afterwards
+		void compile();
+		//reads a .ph file into ruleSet, the generated matcher is used if it was generated from the same rules
+		bool loadRules (const char* path, const PhCompiledRules* generated = nullptr);
+		void useRules (const PhCompiledRules* generated);
+		//runs the automaton over a worklist that starts with all expressions in id order
+		//the expressions of a match and their users are visited again
+		void optimize (Function* func);
+	};
+
+	const PhActionDef* getPhAction (const char* name);
+	//replaces the flag with a compare of the arguments of the sub it is generated from
+	//params: compare op-type
+	void phFlagToCompare (Architecture* arch, SSARepresentation* ssaRep, MatchContext* context, const uint64_t* params, size_t paramcount);
+
+	//the rules of workingdir/standard.ph
+	extern const PhCompiledRules phstandardrules;
+
+	//returns the optimizer of the architecture after running it on the function
+	//without a rulefile the generated standard rules are used
+	PeepholeOptimizer* parsePhOptimizer(Architecture* arch, Function* func, const char* rulefile = nullptr);
 }
 
 #endif // PEEPHOLEOPTIMIZER_H
@@ -0,0 +1,541 @@
+#include "PhRules.h"
+
+#include <fstream>
+#include <sstream>
+#include <inttypes.h>
+#include <string.h>
+
+namespace holodec {
+
+	struct PhName {
+		const char* name;
+		//the name in generated code
+		const char* symbol;
+		uint64_t value;
+	};
+	static const PhName phExprTypes[] = {
+		{"label", "holodec::SSAExprType::eLabel", (uint64_t) SSAExprType::eLabel},
+		{"undef", "holodec::SSAExprType::eUndef", (uint64_t) SSAExprType::eUndef},
+		{"nop", "holodec::SSAExprType::eNop", (uint64_t) SSAExprType::eNop},
+		{"op", "holodec::SSAExprType::eOp", (uint64_t) SSAExprType::eOp},
+		{"loadaddr", "holodec::SSAExprType::eLoadAddr", (uint64_t) SSAExprType::eLoadAddr},
+		{"flag", "holodec::SSAExprType::eFlag", (uint64_t) SSAExprType::eFlag},
+		{"builtin", "holodec::SSAExprType::eBuiltin", (uint64_t) SSAExprType::eBuiltin},
+		{"extend", "holodec::SSAExprType::eExtend", (uint64_t) SSAExprType::eExtend},
+		{"split", "holodec::SSAExprType::eSplit", (uint64_t) SSAExprType::eSplit},
+		{"updatepart", "holodec::SSAExprType::eUpdatePart", (uint64_t) SSAExprType::eUpdatePart},
+		{"append", "holodec::SSAExprType::eAppend", (uint64_t) SSAExprType::eAppend},
+		{"cast", "holodec::SSAExprType::eCast", (uint64_t) SSAExprType::eCast},
+		{"input", "holodec::SSAExprType::eInput", (uint64_t) SSAExprType::eInput},
+		{"output", "holodec::SSAExprType::eOutput", (uint64_t) SSAExprType::eOutput},
+		{"call", "holodec::SSAExprType::eCall", (uint64_t) SSAExprType::eCall},
+		{"return", "holodec::SSAExprType::eReturn", (uint64_t) SSAExprType::eReturn},
+		{"syscall", "holodec::SSAExprType::eSyscall", (uint64_t) SSAExprType::eSyscall},
+		{"trap", "holodec::SSAExprType::eTrap", (uint64_t) SSAExprType::eTrap},
+		{"phi", "holodec::SSAExprType::ePhi", (uint64_t) SSAExprType::ePhi},
+		{"assign", "holodec::SSAExprType::eAssign", (uint64_t) SSAExprType::eAssign},
+		{"jmp", "holodec::SSAExprType::eJmp", (uint64_t) SSAExprType::eJmp},
+		{"cjmp", "holodec::SSAExprType::eCJmp", (uint64_t) SSAExprType::eCJmp},
+		{"multibranch", "holodec::SSAExprType::eMultiBranch", (uint64_t) SSAExprType::eMultiBranch},
+		{"memaccess", "holodec::SSAExprType::eMemAccess", (uint64_t) SSAExprType::eMemAccess},
+		{"push", "holodec::SSAExprType::ePush", (uint64_t) SSAExprType::ePush},
+		{"pop", "holodec::SSAExprType::ePop", (uint64_t) SSAExprType::ePop},
+		{"store", "holodec::SSAExprType::eStore", (uint64_t) SSAExprType::eStore},
+		{"load", "holodec::SSAExprType::eLoad", (uint64_t) SSAExprType::eLoad},
+		{nullptr, nullptr, 0}
+	};
+	static const PhName phOpTypes[] = {
+		{"add", "holodec::SSAOpType::eAdd", (uint64_t) SSAOpType::eAdd},
+		{"sub", "holodec::SSAOpType::eSub", (uint64_t) SSAOpType::eSub},
+		{"mul", "holodec::SSAOpType::eMul", (uint64_t) SSAOpType::eMul},
+		{"div", "holodec::SSAOpType::eDiv", (uint64_t) SSAOpType::eDiv},
+		{"mod", "holodec::SSAOpType::eMod", (uint64_t) SSAOpType::eMod},
+		{"and", "holodec::SSAOpType::eAnd", (uint64_t) SSAOpType::eAnd},
+		{"or", "holodec::SSAOpType::eOr", (uint64_t) SSAOpType::eOr},
+		{"xor", "holodec::SSAOpType::eXor", (uint64_t) SSAOpType::eXor},
+		{"not", "holodec::SSAOpType::eNot", (uint64_t) SSAOpType::eNot},
+		{"eq", "holodec::SSAOpType::eEq", (uint64_t) SSAOpType::eEq},
+		{"ne", "holodec::SSAOpType::eNe", (uint64_t) SSAOpType::eNe},
+		{"lower", "holodec::SSAOpType::eLower", (uint64_t) SSAOpType::eLower},
+		{"le", "holodec::SSAOpType::eLe", (uint64_t) SSAOpType::eLe},
+		{"greater", "holodec::SSAOpType::eGreater", (uint64_t) SSAOpType::eGreater},
+		{"ge", "holodec::SSAOpType::eGe", (uint64_t) SSAOpType::eGe},
+		{"band", "holodec::SSAOpType::eBAnd", (uint64_t) SSAOpType::eBAnd},
+		{"bor", "holodec::SSAOpType::eBOr", (uint64_t) SSAOpType::eBOr},
+		{"bxor", "holodec::SSAOpType::eBXor", (uint64_t) SSAOpType::eBXor},
+		{"bnot", "holodec::SSAOpType::eBNot", (uint64_t) SSAOpType::eBNot},
+		{"shr", "holodec::SSAOpType::eShr", (uint64_t) SSAOpType::eShr},
+		{"shl", "holodec::SSAOpType::eShl", (uint64_t) SSAOpType::eShl},
+		{"sar", "holodec::SSAOpType::eSar", (uint64_t) SSAOpType::eSar},
+		{"sal", "holodec::SSAOpType::eSal", (uint64_t) SSAOpType::eSal},
+		{"ror", "holodec::SSAOpType::eRor", (uint64_t) SSAOpType::eRor},
+		{"rol", "holodec::SSAOpType::eRol", (uint64_t) SSAOpType::eRol},
+		{nullptr, nullptr, 0}
+	};
+	static const PhName phFlagTypes[] = {
+		{"c", "holodec::SSAFlagType::eC", (uint64_t) SSAFlagType::eC},
+		{"a", "holodec::SSAFlagType::eA", (uint64_t) SSAFlagType::eA},
+		{"p", "holodec::SSAFlagType::eP", (uint64_t) SSAFlagType::eP},
+		{"o", "holodec::SSAFlagType::eO", (uint64_t) SSAFlagType::eO},
+		{"u", "holodec::SSAFlagType::eU", (uint64_t) SSAFlagType::eU},
+		{"z", "holodec::SSAFlagType::eZ", (uint64_t) SSAFlagType::eZ},
+		{"s", "holodec::SSAFlagType::eS", (uint64_t) SSAFlagType::eS},
+		{nullptr, nullptr, 0}
+	};
+
+	static const PhName* findPhName (const PhName* names, const char* name) {
+		for (; names->name; names++) {
+			if (strcmp (names->name, name) == 0)
+				return names;
+		}
+		return nullptr;
+	}
+	static const PhName* getPhNames (const char* key) {
+		if (strcmp (key, "expr") == 0)
+			return phExprTypes;
+		else if (strcmp (key, "op") == 0)
+			return phOpTypes;
+		else if (strcmp (key, "flag") == 0)
+			return phFlagTypes;
+		return nullptr;
+	}
+	static const char* getPhSymbol (const PhName* names, uint64_t value) {
+		for (; names->name; names++) {
+			if (names->value == value)
+				return names->symbol;
+		}
+		return nullptr;
+	}
+
+	void PhParser::skipWhitespaces() {
+		while (true) {
+			char c = peek();
+			if (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+				consume();
+			} else if (c == '/' && index + 1 < string.size() && string[index + 1] == '/') {
+				while (peek() && peek() != '\n')
+					consume();
+			} else {
+				return;
+			}
+		}
+	}
+	void PhParser::printParseFailure (const char* expected) {
+		size_t line = 1;
+		for (size_t i = 0; i < index && i < string.size(); i++) {
+			if (string[i] == '\n')
+				line++;
+		}
+		printf ("%s:%zu: Invalid Token expected %s\n", path, line, expected);
+	}
+	bool PhParser::parseIdentifier (char* buffer, size_t buffersize) {
+		skipWhitespaces();
+		for (size_t i = 0; i < buffersize; i++) {
+			char c = peek();
+			if ( ('a' <= c && c <= 'z') || ('0' <= c && c <= '9') || ('A' <= c && c <= 'Z') || c == '_') {
+				buffer[i] = c;
+			} else {
+				buffer[i] = '\0';
+				return i != 0;
+			}
+			consume();
+		}
+		return false;
+	}
+	bool PhParser::parseCharacter (char character) {
+		skipWhitespaces();
+		if (peek() == character) {
+			consume();
+			return true;
+		}
+		return false;
+	}
+	bool PhParser::parseKeyword (const char* keyword) {
+		size_t current_index = index;
+		char buffer[100];
+		if (parseIdentifier (buffer, 100) && strcmp (buffer, keyword) == 0)
+			return true;
+		index = current_index;
+		return false;
+	}
+	bool PhParser::parseNumber (uint64_t* num) {
+		skipWhitespaces();
+		int pos;
+		if (sscanf (string.c_str() + index, "%" SCNi64 "%n", (int64_t*) num, &pos) != 1)
+			return false;
+		consume (pos);
+		return true;
+	}
+	//key=value, the values of expr, op and flag are names
+	bool PhParser::parseParameter (char* key, size_t keysize, uint64_t* value) {
+		if (!parseIdentifier (key, keysize)) {
+			printParseFailure ("parameter");
+			return false;
+		}
+		if (!parseCharacter ('=')) {
+			printParseFailure ("'='");
+			return false;
+		}
+		const PhName* names = getPhNames (key);
+		if (!names) {
+			if (!parseNumber (value)) {
+				printParseFailure ("number");
+				return false;
+			}
+			return true;
+		}
+		char buffer[100];
+		const PhName* name = nullptr;
+		if (!parseIdentifier (buffer, 100) || ! (name = findPhName (names, buffer))) {
+			printParseFailure (key);
+			return false;
+		}
+		*value = name->value;
+		return true;
+	}
+
+	//type(...) or argtype(index=n, ...)
+	bool PhParser::parseRule (PhRule* rule) {
+		bool isArg;
+		if (parseKeyword ("type")) {
+			isArg = false;
+		} else if (parseKeyword ("argtype")) {
+			isArg = true;
+		} else {
+			printParseFailure ("'type', 'argtype'");
+			return false;
+		}
+		if (!parseCharacter ('(')) {
+			printParseFailure ("'('");
+			return false;
+		}
+		if (!parseCharacter (')')) {
+			do {
+				char key[100];
+				uint64_t value;
+				if (!parseParameter (key, 100, &value))
+					return false;
+				if (strcmp (key, "expr") == 0) {
+					rule->type = (SSAExprType) value;
+				} else if (strcmp (key, "op") == 0) {
+					rule->opType = (SSAOpType) value;
+					if (rule->type == SSAExprType::eInvalid)
+						rule->type = SSAExprType::eOp;
+				} else if (strcmp (key, "flag") == 0) {
+					rule->flagType = (SSAFlagType) value;
+					if (rule->type == SSAExprType::eInvalid)
+						rule->type = SSAExprType::eFlag;
+				} else if (strcmp (key, "size") == 0) {
+					rule->size = value;
+				} else if (strcmp (key, "match") == 0) {
+					rule->matchedIndex = value;
+				} else if (strcmp (key, "index") == 0 && isArg) {
+					rule->argIndex = value;
+				} else {
+					printf ("%s: Unknown Parameter %s\n", path, key);
+					return false;
+				}
+			} while (parseCharacter (','));
+			if (!parseCharacter (')')) {
+				printParseFailure ("',', ')'");
+				return false;
+			}
+		}
+		if (isArg && !rule->argIndex) {
+			printf ("%s: argtype needs an index\n", path);
+			return false;
+		}
+		return true;
+	}
+
+	bool PhParser::parseAction (PhActionCall* action) {
+		char buffer[100];
+		if (!parseIdentifier (buffer, 100)) {
+			printParseFailure ("action");
+			return false;
+		}
+		if (! (action->def = getPhAction (buffer))) {
+			printf ("%s: Unknown Action %s\n", path, buffer);
+			return false;
+		}
+		if (!parseCharacter ('(')) {
+			printParseFailure ("'('");
+			return false;
+		}
+		if (parseCharacter (')'))
+			return true;
+		do {
+			char key[100];
+			uint64_t value;
+			if (!parseParameter (key, 100, &value))
+				return false;
+			action->params.push_back (value);
+			action->paramKeys.push_back (key);
+		} while (parseCharacter (','));
+		if (!parseCharacter (')')) {
+			printParseFailure ("',', ')'");
+			return false;
+		}
+		return true;
+	}
+
+	bool PhParser::parseMatcher (PhRule* parent) {
+		if (!parseKeyword ("matcher") || !parseCharacter ('{')) {
+			printParseFailure ("'matcher{'");
+			return false;
+		}
+		if (!parseKeyword ("rules") || !parseCharacter ('{')) {
+			printParseFailure ("'rules{'");
+			return false;
+		}
+		//every rule continues from the previous one, equal prefixes are shared like in the RuleBuilder
+		PhRule* rule = parent;
+		do {
+			PhRule newRule (0, 0, SSAExprType::eInvalid, SSAOpType::eInvalid, SSAFlagType::eUnknown);
+			if (!parseRule (&newRule))
+				return false;
+			PhRule* found = nullptr;
+			for (PhRule* itRule : rule->subRules) {
+				if (itRule->matchedIndex == newRule.matchedIndex && itRule->argIndex == newRule.argIndex && itRule->type == newRule.type &&
+				        itRule->opType == newRule.opType && itRule->flagType == newRule.flagType && itRule->size == newRule.size) {
+					found = itRule;
+					break;
+				}
+			}
+			if (!found) {
+				found = new PhRule (newRule.matchedIndex, newRule.argIndex, newRule.type, newRule.opType, newRule.flagType);
+				found->size = newRule.size;
+				rule->subRules.push_back (found);
+			}
+			rule = found;
+		} while (!parseCharacter ('}'));
+
+		if (parseKeyword ("submatches")) {
+			if (!parseCharacter ('{')) {
+				printParseFailure ("'{'");
+				return false;
+			}
+			while (!parseCharacter ('}')) {
+				if (!parseMatcher (rule))
+					return false;
+			}
+		}
+		if (parseKeyword ("actions")) {
+			if (!parseCharacter ('{')) {
+				printParseFailure ("'{'");
+				return false;
+			}
+			if (!rule->actions.empty()) {
+				printf ("%s: Rule has multiple Action-Blocks\n", path);
+				return false;
+			}
+			while (!parseCharacter ('}')) {
+				PhActionCall action;
+				if (!parseAction (&action))
+					return false;
+				rule->actions.push_back (action);
+			}
+			HList<PhActionCall> actions = rule->actions;
+			rule->executor = [actions] (Architecture * arch, SSARepresentation * ssaRep, MatchContext * context) {
+				for (const PhActionCall& action : actions)
+					action.def->func (arch, ssaRep, context, action.params.data(), action.params.size());
+			};
+		}
+		if (!parseCharacter ('}')) {
+			printParseFailure ("'submatches', 'actions', '}'");
+			return false;
+		}
+		return true;
+	}
+
+	bool PhParser::parse (const char* path, PhRuleSet* ruleSet) {
+		std::ifstream file (path);
+		if (!file) {
+			printf ("Could not open File %s\n", path);
+			return false;
+		}
+		std::stringstream buffer;
+		buffer << file.rdbuf();
+		this->string = buffer.str();
+		this->index = 0;
+		this->path = path;
+		this->ruleSet = ruleSet;
+
+		skipWhitespaces();
+		while (peek()) {
+			if (!parseMatcher (&ruleSet->baserule))
+				return false;
+			skipWhitespaces();
+		}
+		return true;
+	}
+
+	bool parsePhRules (const char* path, PhRuleSet* ruleSet) {
+		PhParser parser;
+		return parser.parse (path, ruleSet);
+	}
+
+	static void phRuleChecksum (PhRule* rule, uint64_t* checksum) {
+		auto mix = [checksum] (uint64_t val) {
+			*checksum = (*checksum ^ val) * 1099511628211ULL;
+		};
+		mix (rule->matchedIndex);
+		mix (rule->argIndex);
+		mix ((uint64_t) rule->type);
+		mix ((uint64_t) rule->opType);
+		mix ((uint64_t) rule->flagType);
+		mix (rule->size);
+		mix (rule->actions.size());
+		for (PhActionCall& action : rule->actions) {
+			for (const char* c = action.def->name; *c; c++)
+				mix (*c);
+			mix (action.params.size());
+			for (uint64_t param : action.params)
+				mix (param);
+		}
+		mix (rule->subRules.size());
+		for (PhRule* subRule : rule->subRules)
+			phRuleChecksum (subRule, checksum);
+	}
+	uint64_t phRuleChecksum (PhRuleSet* ruleSet) {
+		uint64_t checksum = 14695981039346656037ULL;
+		phRuleChecksum (&ruleSet->baserule, &checksum);
+		return checksum;
+	}
+
+	//same order as PhAutomaton::addState
+	static void collectPhRules (PhRule* rule, HList<PhRule*>* rules) {
+		for (PhRule* subRule : rule->subRules)
+			rules->push_back (subRule);
+		for (PhRule* subRule : rule->subRules)
+			collectPhRules (subRule, rules);
+	}
+
+	static void writePhRootCall (PhAutomaton* automaton, SSAExprType type, uint64_t subtype, const char* indent, FILE* file) {
+		HList<uint32_t> roots;
+		automaton->getRoots (type, subtype, &roots);
+		if (roots.empty()) {
+			fprintf (file, "%sreturn false;\n", indent);
+			return;
+		}
+		fprintf (file, "%sreturn ", indent);
+		for (size_t i = 0; i < roots.size(); i++)
+			fprintf (file, "%sstate%" PRIu32 " (arch, ssaRep, expr, context)", i ? " || " : "", roots[i]);
+		fprintf (file, ";\n");
+	}
+
+	bool writePhRules (PhRuleSet* ruleSet, const char* ns, const char* name, FILE* file) {
+		PhAutomaton automaton;
+		automaton.compile (ruleSet);
+		HList<PhRule*> rules;
+		rules.push_back (&ruleSet->baserule);
+		collectPhRules (&ruleSet->baserule, &rules);
+		for (PhRule* rule : rules) {
+			if (rule->executor && rule->actions.empty()) {
+				printf ("Rules with an Executor that is not given by Actions cannot be generated\n");
+				return false;
+			}
+		}
+
+		const char* args = "holodec::Architecture* arch, holodec::SSARepresentation* ssaRep, holodec::SSAExpression* expr, holodec::MatchContext* context";
+		fprintf (file, "//generated with \"holodec --gen-ph-rules\", do not edit\n");
+		fprintf (file, "#include \"PeepholeOptimizer.h\"\n\n");
+		fprintf (file, "namespace %s {\n\n", ns);
+		for (size_t i = 1; i < rules.size(); i++)
+			fprintf (file, "\tstatic bool state%zu (%s);\n", i, args);
+		fprintf (file, "\n");
+
+		for (size_t i = 1; i < rules.size(); i++) {
+			PhRule* rule = rules[i];
+			PhState& state = automaton.states[i];
+			for (size_t j = 0; j < rule->actions.size(); j++) {
+				if (rule->actions[j].params.empty())
+					continue;
+				fprintf (file, "\tstatic const uint64_t state%zuparams%zu[] = {", i, j);
+				for (size_t k = 0; k < rule->actions[j].params.size(); k++) {
+					const PhName* names = getPhNames (rule->actions[j].paramKeys[k].cstr());
+					const char* symbol = names ? getPhSymbol (names, rule->actions[j].params[k]) : nullptr;
+					if (symbol)
+						fprintf (file, "%s(uint64_t) %s", k ? ", " : "", symbol);
+					else
+						fprintf (file, "%s%" PRIu64 "ULL", k ? ", " : "", rule->actions[j].params[k]);
+				}
+				fprintf (file, "};\n");
+			}
+			bool matched = state.matchedIndex || state.argIndex || state.type != SSAExprType::eInvalid || state.opType != SSAOpType::eInvalid ||
+			               state.flagType != SSAFlagType::eUnknown || state.size;
+			fprintf (file, "\tstatic bool state%zu (%s) {\n", i, args);
+			if (state.matchedIndex) {
+				fprintf (file, "\t\tif (context->expressionsMatched.size() < %" PRIu32 ")\n\t\t\treturn false;\n", state.matchedIndex);
+				fprintf (file, "\t\texpr = &ssaRep->expressions[context->expressionsMatched[%" PRIu32 "]];\n", state.matchedIndex - 1);
+			}
+			if (state.argIndex) {
+				fprintf (file, "\t\tif (expr->subExpressions.size() < %" PRIu32 " || expr->subExpressions[%" PRIu32 "].type != holodec::SSAArgType::eId)\n\t\t\treturn false;\n", state.argIndex, state.argIndex - 1);
+				fprintf (file, "\t\texpr = &ssaRep->expressions[expr->subExpressions[%" PRIu32 "].ssaId];\n", state.argIndex - 1);
+			}
+			if (state.type != SSAExprType::eInvalid)
+				fprintf (file, "\t\tif (expr->type != %s)\n\t\t\treturn false;\n", getPhSymbol (phExprTypes, (uint64_t) state.type));
+			if (state.opType != SSAOpType::eInvalid)
+				fprintf (file, "\t\tif (expr->opType != %s)\n\t\t\treturn false;\n", getPhSymbol (phOpTypes, (uint64_t) state.opType));
+			if (state.flagType != SSAFlagType::eUnknown)
+				fprintf (file, "\t\tif (expr->flagType != %s)\n\t\t\treturn false;\n", getPhSymbol (phFlagTypes, (uint64_t) state.flagType));
+			if (state.size)
+				fprintf (file, "\t\tif (expr->size != %" PRIu64 ")\n\t\t\treturn false;\n", state.size);
+			if (matched)
+				fprintf (file, "\t\tcontext->expressionsMatched.push_back (expr->id);\n");
+			fprintf (file, "\t\tbool executed = ");
+			if (!state.childCount)
+				fprintf (file, "false");
+			for (uint32_t j = state.firstChild; j < state.firstChild + state.childCount; j++)
+				fprintf (file, "%sstate%" PRIu32 " (arch, ssaRep, expr, context)", j != state.firstChild ? " || " : "", j);
+			fprintf (file, ";\n");
+			if (!rule->actions.empty()) {
+				fprintf (file, "\t\tif (!executed) {\n");
+				fprintf (file, "\t\t\tcontext->expressionsChanged.insert (context->expressionsChanged.end(), context->expressionsMatched.begin(), context->expressionsMatched.end());\n");
+				for (size_t j = 0; j < rule->actions.size(); j++) {
+					PhActionCall& action = rule->actions[j];
+					if (action.params.empty())
+						fprintf (file, "\t\t\t%s (arch, ssaRep, context, nullptr, 0);\n", action.def->symbol);
+					else
+						fprintf (file, "\t\t\t%s (arch, ssaRep, context, state%zuparams%zu, %zu);\n", action.def->symbol, i, j, action.params.size());
+				}
+				fprintf (file, "\t\t\texecuted = true;\n");
+				fprintf (file, "\t\t}\n");
+			}
+			if (matched)
+				fprintf (file, "\t\tcontext->expressionsMatched.pop_back();\n");
+			fprintf (file, "\t\treturn executed;\n");
+			fprintf (file, "\t}\n\n");
+		}
+
+		//the same root states PhAutomaton::match tries, dispatched by a switch instead of the index
+		HMap<uint64_t, HSet<uint64_t>> subtypes;
+		for (auto& entry : automaton.rootIndex)
+			subtypes[entry.first >> 32].insert (entry.first & 0xFFFFFFFFULL);
+		fprintf (file, "\tstatic bool match (%s) {\n", args);
+		fprintf (file, "\t\tswitch (expr->type) {\n");
+		for (auto& entry : subtypes) {
+			SSAExprType type = (SSAExprType) entry.first;
+			fprintf (file, "\t\tcase %s:\n", getPhSymbol (phExprTypes, entry.first));
+			if (type == SSAExprType::eOp || type == SSAExprType::eFlag) {
+				const PhName* names = type == SSAExprType::eOp ? phOpTypes : phFlagTypes;
+				fprintf (file, "\t\t\tswitch (%s) {\n", type == SSAExprType::eOp ? "expr->opType" : "expr->flagType");
+				for (uint64_t subtype : entry.second) {
+					if (subtype == H_PH_ANY_SUBTYPE)
+						continue;
+					fprintf (file, "\t\t\tcase %s:\n", getPhSymbol (names, subtype));
+					writePhRootCall (&automaton, type, subtype, "\t\t\t\t", file);
+				}
+				fprintf (file, "\t\t\tdefault:\n\t\t\t\tbreak;\n\t\t\t}\n");
+			}
+			writePhRootCall (&automaton, type, H_PH_ANY_SUBTYPE, "\t\t\t", file);
+		}
+		fprintf (file, "\t\tdefault:\n\t\t\tbreak;\n\t\t}\n");
+		writePhRootCall (&automaton, SSAExprType::eInvalid, H_PH_ANY_SUBTYPE, "\t\t", file);
+		fprintf (file, "\t}\n\n");
+
+		fprintf (file, "\textern const holodec::PhCompiledRules %s = {0x%" PRIx64 "ULL, match};\n", name, phRuleChecksum (ruleSet));
+		fprintf (file, "}\n");
+		return true;
+	}
+}
@@ -0,0 +1,62 @@
+#ifndef H_PHRULES_H
+#define H_PHRULES_H
+
+#include <stdio.h>
+#include <string>
+#include "General.h"
+#include "PeepholeOptimizer.h"
+
+namespace holodec {
+
+	//reads the rule language of workingdir/standard.ph
+	//
+	//matcher{
+	//	rules{
+	//		type(type=flag,flag=z)			tests the current expression
+	//		arg(index=1,type=op,op=sub)		follows the argument index of the current or the matched expression given by match=
+	//	}
+	//	submatches{ matcher{...} }			continue after the last rule and are tried in order
+	//	actions{ flagtocompare(op=eq) }		executed if no submatch fired
+	//}
+	struct PhParser {
+		size_t index;
+		std::string string;
+		const char* path;
+
+		PhRuleSet* ruleSet;
+
+		char peek() {
+			return index < string.size() ? string[index] : '\0';
+		}
+		char pop() {
+			return index < string.size() ? string[index++] : '\0';
+		}
+		void consume (size_t count = 1) {
+			index += count;
+		}
+
+		void skipWhitespaces();
+		bool parseIdentifier (char* buffer, size_t buffersize);
+		bool parseCharacter (char character);
+		bool parseKeyword (const char* keyword);
+		bool parseNumber (uint64_t* num);
+		bool parseParameter (char* key, size_t keysize, uint64_t* value);
+
+		bool parseRule (PhRule* rule);
+		bool parseAction (PhActionCall* action);
+		bool parseMatcher (PhRule* parent);
+
+		void printParseFailure (const char* expected);
+
+		bool parse (const char* path, PhRuleSet* ruleSet);
+	};
+
+	bool parsePhRules (const char* path, PhRuleSet* ruleSet);
+	//checksum over the rules and actions, independent of formatting and comments
+	uint64_t phRuleChecksum (PhRuleSet* ruleSet);
+
+	//writes a matcher that behaves like the PhAutomaton of the rules as a source-file that defines ns::name
+	bool writePhRules (PhRuleSet* ruleSet, const char* ns, const char* name, FILE* file);
+}
+
+#endif // H_PHRULES_H
@@ -0,0 +1,92 @@
+//generated with "holodec --gen-ph-rules", do not edit
+#include "PeepholeOptimizer.h"
+
+namespace holodec {
+
+	static bool state1 (holodec::Architecture* arch, holodec::SSARepresentation* ssaRep, holodec::SSAExpression* expr, holodec::MatchContext* context);
+	static bool state2 (holodec::Architecture* arch, holodec::SSARepresentation* ssaRep, holodec::SSAExpression* expr, holodec::MatchContext* context);
+	static bool state3 (holodec::Architecture* arch, holodec::SSARepresentation* ssaRep, holodec::SSAExpression* expr, holodec::MatchContext* context);
+	static bool state4 (holodec::Architecture* arch, holodec::SSARepresentation* ssaRep, holodec::SSAExpression* expr, holodec::MatchContext* context);
+
+	static bool state1 (holodec::Architecture* arch, holodec::SSARepresentation* ssaRep, holodec::SSAExpression* expr, holodec::MatchContext* context) {
+		if (expr->type != holodec::SSAExprType::eFlag)
+			return false;
+		if (expr->flagType != holodec::SSAFlagType::eZ)
+			return false;
+		context->expressionsMatched.push_back (expr->id);
+		bool executed = state3 (arch, ssaRep, expr, context);
+		context->expressionsMatched.pop_back();
+		return executed;
+	}
+
+	static bool state2 (holodec::Architecture* arch, holodec::SSARepresentation* ssaRep, holodec::SSAExpression* expr, holodec::MatchContext* context) {
+		if (expr->type != holodec::SSAExprType::eFlag)
+			return false;
+		if (expr->flagType != holodec::SSAFlagType::eC)
+			return false;
+		context->expressionsMatched.push_back (expr->id);
+		bool executed = state4 (arch, ssaRep, expr, context);
+		context->expressionsMatched.pop_back();
+		return executed;
+	}
+
+	static const uint64_t state3params0[] = {(uint64_t) holodec::SSAOpType::eEq};
+	static bool state3 (holodec::Architecture* arch, holodec::SSARepresentation* ssaRep, holodec::SSAExpression* expr, holodec::MatchContext* context) {
+		if (expr->subExpressions.size() < 1 || expr->subExpressions[0].type != holodec::SSAArgType::eId)
+			return false;
+		expr = &ssaRep->expressions[expr->subExpressions[0].ssaId];
+		if (expr->type != holodec::SSAExprType::eOp)
+			return false;
+		if (expr->opType != holodec::SSAOpType::eSub)
+			return false;
+		context->expressionsMatched.push_back (expr->id);
+		bool executed = false;
+		if (!executed) {
+			context->expressionsChanged.insert (context->expressionsChanged.end(), context->expressionsMatched.begin(), context->expressionsMatched.end());
+			holodec::phFlagToCompare (arch, ssaRep, context, state3params0, 1);
+			executed = true;
+		}
+		context->expressionsMatched.pop_back();
+		return executed;
+	}
+
+	static const uint64_t state4params0[] = {(uint64_t) holodec::SSAOpType::eLower};
+	static bool state4 (holodec::Architecture* arch, holodec::SSARepresentation* ssaRep, holodec::SSAExpression* expr, holodec::MatchContext* context) {
+		if (expr->subExpressions.size() < 1 || expr->subExpressions[0].type != holodec::SSAArgType::eId)
+			return false;
+		expr = &ssaRep->expressions[expr->subExpressions[0].ssaId];
+		if (expr->type != holodec::SSAExprType::eOp)
+			return false;
+		if (expr->opType != holodec::SSAOpType::eSub)
+			return false;
+		context->expressionsMatched.push_back (expr->id);
+		bool executed = false;
+		if (!executed) {
+			context->expressionsChanged.insert (context->expressionsChanged.end(), context->expressionsMatched.begin(), context->expressionsMatched.end());
+			holodec::phFlagToCompare (arch, ssaRep, context, state4params0, 1);
+			executed = true;
+		}
+		context->expressionsMatched.pop_back();
+		return executed;
+	}
+
+	static bool match (holodec::Architecture* arch, holodec::SSARepresentation* ssaRep, holodec::SSAExpression* expr, holodec::MatchContext* context) {
+		switch (expr->type) {
+		case holodec::SSAExprType::eFlag:
+			switch (expr->flagType) {
+			case holodec::SSAFlagType::eC:
+				return state2 (arch, ssaRep, expr, context);
+			case holodec::SSAFlagType::eZ:
+				return state1 (arch, ssaRep, expr, context);
+			default:
+				break;
+			}
+			return false;
+		default:
+			break;
+		}
+		return false;
+	}
+
+	extern const holodec::PhCompiledRules phstandardrules = {0xc80a30e27a895920ULL, match};
+}
@@ -0,0 +1,258 @@
+#include "Profiler.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <algorithm>
+#include <chrono>
+
+namespace holodec {
+
+	Profiler g_profiler;
+
+	static const char* counterNames[eProfileCounterCount] = {"Instructions", "Expressions-Created", "Expressions-Removed", "Phis", "Replace-Rounds", "Template-Hits", "Cache-Hits"};
+
+	Profiler::~Profiler() {
+		for (ProfileThread* thread : threads)
+			delete thread;
+		threads.clear();
+	}
+
+	void Profiler::enable() {
+		startTime = std::chrono::duration_cast<std::chrono::nanoseconds> (std::chrono::steady_clock::now().time_since_epoch()).count();
+		enabled.store (true);
+	}
+	uint64_t Profiler::now() {
+		return std::chrono::duration_cast<std::chrono::nanoseconds> (std::chrono::steady_clock::now().time_since_epoch()).count() - startTime;
+	}
+
+	ProfileThread* Profiler::getThread() {
+		thread_local ProfileThread* thread = nullptr;
+		if (!thread) {
+			thread = new ProfileThread();
+			thread->current = &thread->functions[ProfileFunctionKey (0, 0)];
+			std::unique_lock<std::mutex> lock (mutex);
+			thread->id = threads.size();
+			threads.push_back (thread);
+		}
+		return thread;
+	}
+	void Profiler::nameThread (const char* name) {
+		getThread()->name = name;
+	}
+	uint32_t Profiler::registerBinary (const char* name) {
+		std::unique_lock<std::mutex> lock (mutex);
+		binaries.push_back (name);
+		return binaries.size();
+	}
+	std::string Profiler::getFunctionName (uint32_t binary, uint64_t addr) {
+		char buffer[32];
+		snprintf (buffer, sizeof (buffer), "0x%" PRIx64, addr);
+		if (binary && binary <= binaries.size())
+			return binaries[binary - 1] + ":" + buffer;
+		return buffer;
+	}
+	void Profiler::addPass (ProfileFunction* function, const char* name, uint64_t time, bool functionScope) {
+		for (ProfilePass& pass : function->passes) {
+			if (pass.name == name) {
+				pass.calls++;
+				pass.time += time;
+				pass.maxtime = std::max (pass.maxtime, time);
+				return;
+			}
+		}
+		function->passes.push_back ({name, 1, time, time, functionScope});
+	}
+	void Profiler::addSpan (const char* name, uint64_t start, uint64_t end) {
+		ProfileThread* thread = getThread();
+		ProfileEvent event = {name, start, end - start, thread->current->binary, thread->current->addr, false, {}};
+		thread->events.push_back (event);
+		addPass (thread->current, name, end - start);
+	}
+	void Profiler::addTime (const char* name, uint64_t time) {
+		addPass (getThread()->current, name, time);
+	}
+	void Profiler::count (ProfileCounter counter, uint64_t value) {
+		getThread()->current->counters[counter] += value;
+	}
+	ProfileFunction* Profiler::getCurrentFunction() {
+		return getThread()->current;
+	}
+	ProfileFunction* Profiler::beginFunction (uint32_t binary, uint64_t addr) {
+		ProfileThread* thread = getThread();
+		thread->current = &thread->functions[ProfileFunctionKey (binary, addr)];
+		thread->current->binary = binary;
+		thread->current->addr = addr;
+		return thread->current;
+	}
+	void Profiler::endFunction (const char* name, uint64_t start, uint64_t end, ProfileFunction* previous, const uint64_t* counters) {
+		ProfileThread* thread = getThread();
+		ProfileFunction* function = thread->current;
+		ProfileEvent event = {name, start, end - start, function->binary, function->addr, true, {}};
+		for (int i = 0; i < eProfileCounterCount; i++)
+			event.counters[i] = function->counters[i] - counters[i];
+		thread->events.push_back (event);
+		function->time += end - start;
+		addPass (function, name, end - start, true);
+		thread->current = previous;
+	}
+
+	//file names may contain quotes and backslashes
+	static std::string escapeJson (const std::string& str) {
+		std::string escaped;
+		for (char c : str) {
+			if (c == '"' || c == '\\')
+				escaped += '\\';
+			if ((unsigned char) c >= 0x20)
+				escaped += c;
+		}
+		return escaped;
+	}
+
+	bool Profiler::writeTrace (const char* path) {
+		FILE* file = fopen (path, "w");
+		if (!file) {
+			printf ("Could not open File %s\n", path);
+			return false;
+		}
+		size_t eventCount = 0;
+		bool first = true;
+		fprintf (file, "{\"traceEvents\":[\n");
+		for (ProfileThread* thread : threads) {
+			std::string name = thread->name.empty() ? "Thread " + std::to_string (thread->id) : thread->name;
+			fprintf (file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}", first ? "" : ",\n", thread->id, name.c_str());
+			first = false;
+			for (ProfileEvent& event : thread->events) {
+				fprintf (file, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{", event.name, event.functionScope ? "function" : "pass",
+				         event.start / 1000.0, event.duration / 1000.0, thread->id);
+				bool firstArg = true;
+				if (event.addr) {
+					fprintf (file, "\"function\":\"0x%" PRIx64 "\"", event.addr);
+					firstArg = false;
+				}
+				if (event.binary && event.binary <= binaries.size()) {
+					fprintf (file, "%s\"binary\":\"%s\"", firstArg ? "" : ",", escapeJson (binaries[event.binary - 1]).c_str());
+					firstArg = false;
+				}
+				if (event.functionScope) {
+					for (int i = 0; i < eProfileCounterCount; i++) {
+						fprintf (file, "%s\"%s\":%" PRIu64, firstArg ? "" : ",", counterNames[i], event.counters[i]);
+						firstArg = false;
+					}
+				}
+				fprintf (file, "}}");
+				eventCount++;
+			}
+		}
+		fprintf (file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+		bool written = !ferror (file);
+		fclose (file);
+		if (!written) {
+			printf ("Could not write Trace %s\n", path);
+			return false;
+		}
+		printf ("Wrote Trace %s with %zu Events\n", path, eventCount);
+		return true;
+	}
+
+	void Profiler::mergeFunctions (HMap<ProfileFunctionKey, ProfileFunction>* functions) {
+		for (ProfileThread* thread : threads) {
+			for (auto& entry : thread->functions) {
+				ProfileFunction& merged = (*functions)[entry.first];
+				merged.binary = entry.first.first;
+				merged.addr = entry.first.second;
+				merged.time += entry.second.time;
+				for (int i = 0; i < eProfileCounterCount; i++)
+					merged.counters[i] += entry.second.counters[i];
+				for (ProfilePass& pass : entry.second.passes) {
+					auto it = std::find_if (merged.passes.begin(), merged.passes.end(), [&pass] (ProfilePass & other) {
+						return strcmp (other.name, pass.name) == 0;
+					});
+					if (it == merged.passes.end()) {
+						merged.passes.push_back (pass);
+						continue;
+					}
+					it->calls += pass.calls;
+					it->time += pass.time;
+					it->maxtime = std::max (it->maxtime, pass.maxtime);
+				}
+			}
+		}
+	}
+	void Profiler::printSummary (size_t functionCount) {
+		HMap<ProfileFunctionKey, ProfileFunction> functions;
+		mergeFunctions (&functions);
+
+		//over all functions with the function where the pass took the longest
+		struct PassSummary {
+			ProfilePass pass;
+			ProfileFunction* slowest;
+			uint64_t slowestTime;
+		};
+		HList<PassSummary> passes;
+		uint64_t counters[eProfileCounterCount] = {};
+		for (auto& entry : functions) {
+			for (int i = 0; i < eProfileCounterCount; i++)
+				counters[i] += entry.second.counters[i];
+			for (ProfilePass& pass : entry.second.passes) {
+				auto it = std::find_if (passes.begin(), passes.end(), [&pass] (PassSummary & other) {
+					return strcmp (other.pass.name, pass.name) == 0;
+				});
+				if (it == passes.end()) {
+					passes.push_back ({pass, &entry.second, pass.time});
+					continue;
+				}
+				it->pass.calls += pass.calls;
+				it->pass.time += pass.time;
+				it->pass.maxtime = std::max (it->pass.maxtime, pass.maxtime);
+				if (pass.time > it->slowestTime) {
+					it->slowest = &entry.second;
+					it->slowestTime = pass.time;
+				}
+			}
+		}
+		std::sort (passes.begin(), passes.end(), [] (const PassSummary & lhs, const PassSummary & rhs) {
+			return lhs.pass.time > rhs.pass.time;
+		});
+
+		printf ("Profile: %zu Functions in %zu Binaries on %zu Threads\n", functions.size() - (functions.find (ProfileFunctionKey (0, 0)) != functions.end()), binaries.size(), threads.size());
+		printf ("%-24s %10s %12s %10s %10s  %s\n", "Pass", "Calls", "Total ms", "Avg us", "Max us", "Slowest Function");
+		for (PassSummary& summary : passes) {
+			printf ("%-24s %10" PRIu64 " %12.3f %10.1f %10.1f  ", summary.pass.name, summary.pass.calls, summary.pass.time / 1000000.0,
+			        summary.pass.time / 1000.0 / summary.pass.calls, summary.pass.maxtime / 1000.0);
+			if (summary.slowest->addr)
+				printf ("%s %.3f ms\n", getFunctionName (summary.slowest->binary, summary.slowest->addr).c_str(), summary.slowestTime / 1000000.0);
+			else
+				printf ("-\n");
+		}
+		printf ("Counters:");
+		for (int i = 0; i < eProfileCounterCount; i++)
+			printf ("%s %s %" PRIu64, i ? "," : "", counterNames[i], counters[i]);
+		printf ("\n");
+
+		HList<ProfileFunction*> sorted;
+		for (auto& entry : functions) {
+			if (entry.first.second)
+				sorted.push_back (&entry.second);
+		}
+		std::sort (sorted.begin(), sorted.end(), [] (const ProfileFunction * lhs, const ProfileFunction * rhs) {
+			return lhs->time > rhs->time;
+		});
+		if (sorted.size() > functionCount)
+			sorted.resize (functionCount);
+		printf ("Slowest %zu Functions\n", sorted.size());
+		for (ProfileFunction* function : sorted) {
+			ProfilePass* slowest = nullptr;
+			for (ProfilePass& pass : function->passes) {
+				if (!pass.functionScope && (!slowest || pass.time > slowest->time))
+					slowest = &pass;
+			}
+			printf ("\t%s %.3f ms", getFunctionName (function->binary, function->addr).c_str(), function->time / 1000000.0);
+			if (slowest)
+				printf (", %s %.3f ms", slowest->name, slowest->time / 1000000.0);
+			for (int i = 0; i < eProfileCounterCount; i++)
+				printf (", %s %" PRIu64, counterNames[i], function->counters[i]);
+			printf ("\n");
+		}
+	}
+}
@@ -0,0 +1,186 @@
+#ifndef H_PROFILER_H
+#define H_PROFILER_H
+
+#include "General.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#define H_PROFILE_CONCAT_INNER(a, b) a ## b
+#define H_PROFILE_CONCAT(a, b) H_PROFILE_CONCAT_INNER (a, b)
+
+//the names have to be string literals, they are kept as pointers
+#ifndef H_NO_PROFILE
+//a span in the trace, its time is added to the pass with the name
+#define H_PROFILE_SCOPE(name) holodec::ProfileScope H_PROFILE_CONCAT (profileScope, __LINE__) (name)
+//a span that everything inside of it is counted for the function at the address in the binary from registerBinary
+#define H_PROFILE_FUNCTION_SCOPE(name, binary, addr) holodec::ProfileFunctionScope H_PROFILE_CONCAT (profileScope, __LINE__) (name, binary, addr)
+//only the time is added to the pass, for code that runs too often to be in the trace
+#define H_PROFILE_TIMER(name) holodec::ProfileTimer H_PROFILE_CONCAT (profileTimer, __LINE__) (name)
+#define H_PROFILE_COUNT(counter, value) \
+	do { \
+		if (holodec::g_profiler.isEnabled()) \
+			holodec::g_profiler.count (counter, value); \
+	} while (0)
+#else
+#define H_PROFILE_SCOPE(name) do {} while (0)
+#define H_PROFILE_FUNCTION_SCOPE(name, binary, addr) do {} while (0)
+#define H_PROFILE_TIMER(name) do {} while (0)
+#define H_PROFILE_COUNT(counter, value) do {} while (0)
+#endif
+
+namespace holodec {
+
+	enum ProfileCounter {
+		eProfileInstructions = 0,
+		eProfileExpressionsCreated,
+		eProfileExpressionsRemoved,
+		eProfilePhisInserted,
+		eProfileReplaceRounds,
+		eProfileTemplateHits,
+		eProfileCacheHits,
+		eProfileCounterCount
+	};
+
+	struct ProfilePass {
+		const char* name;
+		uint64_t calls;
+		uint64_t time;
+		uint64_t maxtime;
+		//the time of the passes in the function is part of it
+		bool functionScope;
+	};
+	struct ProfileFunction {
+		uint32_t binary = 0;
+		uint64_t addr = 0;
+		//of the function scopes
+		uint64_t time = 0;
+		uint64_t counters[eProfileCounterCount] = {};
+		HList<ProfilePass> passes;
+	};
+	struct ProfileEvent {
+		const char* name;
+		//in ns since the profiler was enabled
+		uint64_t start;
+		uint64_t duration;
+		uint32_t binary;
+		uint64_t addr;
+		//what was counted in a function scope
+		bool functionScope;
+		uint64_t counters[eProfileCounterCount];
+	};
+	typedef std::pair<uint32_t, uint64_t> ProfileFunctionKey;
+	//everything recorded by one thread, only that thread writes to it
+	struct ProfileThread {
+		uint32_t id;
+		std::string name;
+		HList<ProfileEvent> events;
+		//binary and address -> function, the same addresses are in different binaries in batch mode
+		//binary 0 and address 0 collects what is outside of a function
+		HMap<ProfileFunctionKey, ProfileFunction> functions;
+		ProfileFunction* current;
+	};
+
+	//records spans and counters of the analysis per thread and per function without locking
+	//the results are exported when no thread records anymore
+	class Profiler {
+	public:
+		~Profiler();
+
+		bool isEnabled() {
+			return enabled.load (std::memory_order_relaxed);
+		}
+		void enable();
+		uint64_t now();
+
+		//shown for the thread in the trace
+		void nameThread (const char* name);
+		//the id for the function scopes of the binary, ids start with 1
+		uint32_t registerBinary (const char* name);
+		void addSpan (const char* name, uint64_t start, uint64_t end);
+		void addTime (const char* name, uint64_t time);
+		void count (ProfileCounter counter, uint64_t value);
+		ProfileFunction* beginFunction (uint32_t binary, uint64_t addr);
+		void endFunction (const char* name, uint64_t start, uint64_t end, ProfileFunction* previous, const uint64_t* counters);
+		ProfileFunction* getCurrentFunction();
+
+		//json for chrome://tracing and perfetto
+		bool writeTrace (const char* path);
+		//the passes and the functions that took the longest
+		void printSummary (size_t functionCount);
+
+	private:
+		std::atomic<bool> enabled = {false};
+		uint64_t startTime = 0;
+		HList<ProfileThread*> threads;
+		HList<std::string> binaries;
+		std::mutex mutex;
+
+		ProfileThread* getThread();
+		void addPass (ProfileFunction* function, const char* name, uint64_t time, bool functionScope = false);
+		//of all threads, merged by name
+		void mergeFunctions (HMap<ProfileFunctionKey, ProfileFunction>* functions);
+		//the address with the name of the binary
+		std::string getFunctionName (uint32_t binary, uint64_t addr);
+	};
+
+	extern Profiler g_profiler;
+
+	class ProfileScope {
+	public:
+		ProfileScope (const char* name) : name (name), active (g_profiler.isEnabled()) {
+			if (active)
+				start = g_profiler.now();
+		}
+		~ProfileScope() {
+			if (active)
+				g_profiler.addSpan (name, start, g_profiler.now());
+		}
+	private:
+		const char* name;
+		bool active;
+		uint64_t start = 0;
+	};
+	class ProfileFunctionScope {
+	public:
+		ProfileFunctionScope (const char* name, uint32_t binary, uint64_t addr) : name (name), active (g_profiler.isEnabled()) {
+			if (!active)
+				return;
+			previous = g_profiler.getCurrentFunction();
+			ProfileFunction* function = g_profiler.beginFunction (binary, addr);
+			for (int i = 0; i < eProfileCounterCount; i++)
+				counters[i] = function->counters[i];
+			start = g_profiler.now();
+		}
+		~ProfileFunctionScope() {
+			if (active)
+				g_profiler.endFunction (name, start, g_profiler.now(), previous, counters);
+		}
+	private:
+		const char* name;
+		bool active;
+		uint64_t start = 0;
+		ProfileFunction* previous = nullptr;
+		//when the scope started
+		uint64_t counters[eProfileCounterCount];
+	};
+	class ProfileTimer {
+	public:
+		ProfileTimer (const char* name) : name (name), active (g_profiler.isEnabled()) {
+			if (active)
+				start = g_profiler.now();
+		}
+		~ProfileTimer() {
+			if (active)
+				g_profiler.addTime (name, g_profiler.now() - start);
+		}
+	private:
+		const char* name;
+		bool active;
+		uint64_t start = 0;
+	};
+}
+
+#endif // H_PROFILER_H
@@ -0,0 +1,599 @@
+#include "ProjectDB.h"
+#include "Binary.h"
+#include "Architecture.h"
+
+#include <inttypes.h>
+#include <functional>
+#include <algorithm>
+#include <string>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace holodec {
+
+	static const size_t columnElementSizes[eProjectColumnCount] = {
+		sizeof (char),
+		sizeof (ProjectDBSection),
+		sizeof (ProjectDBSymbol),
+		sizeof (HId),
+		sizeof (ProjectDBFunction),
+		sizeof (ProjectDBRegState),
+		sizeof (uint64_t),
+		sizeof (ProjectDBBlock),
+		sizeof (ProjectDBInstruction),
+		sizeof (IRTableArgument),
+		sizeof (ProjectDBJumpTable),
+		sizeof (ProjectDBJumpEntry),
+		sizeof (ProjectDBSSABlock),
+		sizeof (HId),
+		sizeof (ProjectDBSSAExpression),
+		sizeof (ProjectDBSSAArgument),
+	};
+	static const SymbolType* symbolTypes[] = {
+		&SymbolType::symbool, &SymbolType::symint, &SymbolType::symuint, &SymbolType::symfloat,
+		&SymbolType::symstring, &SymbolType::symfunc, &SymbolType::symdynfunc
+	};
+
+	static uint64_t hashData (Data* data) {
+		uint64_t hash = 0xcbf29ce484222325ULL;
+		size_t i = 0;
+		for (; i + sizeof (uint64_t) <= data->size; i += sizeof (uint64_t)) {
+			uint64_t val;
+			memcpy (&val, data->data + i, sizeof (uint64_t));
+			hash = (hash ^ val) * 0x100000001b3ULL;
+		}
+		for (; i < data->size; i++)
+			hash = (hash ^ data->data[i]) * 0x100000001b3ULL;
+		return hash ^ data->size;
+	}
+	//the generator of an id-list continues after the highest restored id
+	template<typename LIST>
+	static void restoreGenerator (LIST& list, HId maxId) {
+		for (HId id = 0; id < maxId; id++)
+			list.gen.next();
+	}
+
+	ProjectDB::~ProjectDB() {
+		close();
+	}
+
+	bool ProjectDB::open (const char* path, Data* data) {
+		close();
+		int fd = ::open (path, O_RDONLY);
+		if (fd < 0)
+			return false;
+		struct stat filestat;
+		if (fstat (fd, &filestat) != 0 || (size_t) filestat.st_size < sizeof (ProjectDBHeader)) {
+			::close (fd);
+			return false;
+		}
+		size_t filesize = filestat.st_size;
+		void* mapping = mmap (nullptr, filesize, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close (fd);
+		if (mapping == MAP_FAILED)
+			return false;
+		//functions are read in the order they are used, reading ahead would load the whole file
+		madvise (mapping, filesize, MADV_RANDOM);
+
+		const ProjectDBHeader* header = (const ProjectDBHeader*) mapping;
+		if (header->magic != H_PROJECTDB_MAGIC || header->version != H_PROJECTDB_VERSION || header->headersize != sizeof (ProjectDBHeader) || header->filesize != filesize) {
+			printf ("Project %s has an invalid Format\n", path);
+			munmap (mapping, filesize);
+			return false;
+		}
+		if (header->archchecksum != arch->getSourceChecksum() || header->datasize != data->size || header->datahash != hashData (data)) {
+			printf ("Project %s is stale\n", path);
+			munmap (mapping, filesize);
+			return false;
+		}
+		for (size_t i = 0; i < eProjectColumnCount; i++) {
+			const ProjectDBColumn& column = header->columns[i];
+			if (column.offset % 8 || column.offset > filesize || column.count > (filesize - column.offset) / columnElementSizes[i]) {
+				printf ("Project %s is truncated\n", path);
+				munmap (mapping, filesize);
+				return false;
+			}
+		}
+		const ProjectDBColumn& strings = header->columns[eProjectStrings];
+		if (strings.count && ((const char*) mapping) [strings.offset + strings.count - 1] != '\0') {
+			printf ("Project %s is corrupt\n", path);
+			munmap (mapping, filesize);
+			return false;
+		}
+		this->base = (const uint8_t*) mapping;
+		this->size = filesize;
+		this->header = header;
+		return true;
+	}
+	void ProjectDB::close() {
+		if (base)
+			munmap ( (void*) base, size);
+		base = nullptr;
+		size = 0;
+		header = nullptr;
+		pending.clear();
+	}
+
+	const char* ProjectDB::getString (uint64_t offset) {
+		if (offset < header->columns[eProjectStrings].count)
+			return column<char> (eProjectStrings) + offset;
+		return "";
+	}
+
+	bool ProjectDB::loadBinary (Binary* binary) {
+		if (!base)
+			return false;
+		binary->bitbase = header->bitbase;
+		binary->arch = getString (header->archname);
+
+		const ProjectDBSection* sections = column<ProjectDBSection> (eProjectSections);
+		HList<Section*> loadedSections;
+		HId maxId = 0;
+		for (size_t i = 0; i < header->columns[eProjectSections].count; i++) {
+			const ProjectDBSection& record = sections[i];
+			if (record.parent > i) {
+				printf ("Section %zu of the Project is corrupt\n", i);
+				return false;
+			}
+			Section* section = new Section();
+			section->id = record.id;
+			section->name = getString (record.name);
+			section->offset = record.offset;
+			section->vaddr = record.vaddr;
+			section->size = record.size;
+			section->srwx = record.srwx;
+			if (record.parent) {
+				loadedSections[record.parent - 1]->subsections.push_back (section);
+			} else {
+				binary->sections.list.push_back (section);
+				maxId = std::max (maxId, record.id);
+			}
+			loadedSections.push_back (section);
+		}
+		restoreGenerator (binary->sections, maxId);
+
+		const ProjectDBSymbol* symbols = column<ProjectDBSymbol> (eProjectSymbols);
+		maxId = 0;
+		for (size_t i = 0; i < header->columns[eProjectSymbols].count; i++) {
+			const ProjectDBSymbol& record = symbols[i];
+			const SymbolType* symboltype = nullptr;
+			HString typeName = getString (record.symboltype);
+			for (const SymbolType* type : symbolTypes) {
+				if (type->name == typeName)
+					symboltype = type;
+			}
+			binary->symbols.list.push_back (new Symbol ({record.id, getString (record.name), symboltype, record.typeId, record.vaddr, record.size}));
+			maxId = std::max (maxId, record.id);
+		}
+		restoreGenerator (binary->symbols, maxId);
+
+		const HId* entrypoints = column<HId> (eProjectEntrypoints);
+		for (size_t i = 0; i < header->columns[eProjectEntrypoints].count; i++)
+			binary->addEntrypoint (entrypoints[i]);
+
+		const ProjectDBFunction* functions = column<ProjectDBFunction> (eProjectFunctions);
+		const ProjectDBRegState* regstates = column<ProjectDBRegState> (eProjectRegStates);
+		const uint64_t* calls = column<uint64_t> (eProjectCalls);
+		maxId = 0;
+		for (size_t i = 0; i < header->columns[eProjectFunctions].count; i++) {
+			const ProjectDBFunction& record = functions[i];
+			if (!inColumn (eProjectRegStates, record.regstates.offset, record.regstates.count) ||
+			        !inColumn (eProjectCalls, record.calls.offset, record.calls.count) ||
+			        !inColumn (eProjectBlocks, record.blocks.offset, record.blocks.count) ||
+			        !inColumn (eProjectInstructions, record.instructions.offset, record.instructions.count) ||
+			        !inColumn (eProjectJumpTables, record.jumptables.offset, record.jumptables.count) ||
+			        !inColumn (eProjectSSABlocks, record.ssablocks.offset, record.ssablocks.count) ||
+			        !inColumn (eProjectSSAExpressions, record.ssaexpressions.offset, record.ssaexpressions.count)) {
+				printf ("Function at Address 0x%" PRIx64 " of the Project is corrupt\n", record.baseaddr);
+				return false;
+			}
+			Function* function = new Function();
+			function->id = record.id;
+			function->symbolref = record.symbolref;
+			function->callingconvention = record.callingconvention;
+			function->baseaddr = record.baseaddr;
+			function->hasRegStates = record.flags & H_PROJECTDB_FUNC_REGSTATES;
+			function->stackAdjust = record.stackAdjust;
+			function->stackAdjustKnown = record.flags & H_PROJECTDB_FUNC_STACKADJUST;
+			function->stackReadEnd = record.stackReadEnd;
+			function->stackReadEndKnown = record.flags & H_PROJECTDB_FUNC_STACKREADEND;
+			for (size_t j = 0; j < record.regstates.count; j++) {
+				RegisterState state;
+				state.regId = regstates[record.regstates.offset + j].regId;
+				state.flags.mask = regstates[record.regstates.offset + j].flags;
+				function->regStates.push_back (state);
+			}
+			function->funcsCalled.assign (calls + record.calls.offset, calls + record.calls.offset + record.calls.count);
+			binary->functions.list.push_back (function);
+			maxId = std::max (maxId, record.id);
+			pending[function->id] = &record;
+		}
+		restoreGenerator (binary->functions, maxId);
+		return true;
+	}
+
+	void appendInstructions (InstructionList* instructions, HList<ProjectDBInstruction>* records, HList<IRTableArgument>* operands) {
+		for (size_t i = 0; i < instructions->size(); i++) {
+			InstrDefinition* instrdef = instructions->instrdefs[i];
+			size_t operandcount = instructions->operandCounts[i];
+			records->push_back ({instructions->addrs[i], instructions->sizes[i], instrdef ? instrdef->id : 0, (uint32_t) operandcount, operands->size(),
+			                     instructions->getFallthrough (i), instructions->getJumpDest (i), instructions->getCallDest (i)});
+			IRArgument* instrOperands = instructions->getOperands (i);
+			for (size_t j = 0; j < operandcount; j++)
+				operands->push_back (toIRTableArgument (instrOperands[j]));
+		}
+	}
+	bool readInstructions (Architecture* arch, InstructionList* instructions, const ProjectDBInstruction* records, size_t count, const IRTableArgument* operands, size_t operandcount) {
+		instructions->reserve (count);
+		for (size_t i = 0; i < count; i++) {
+			const ProjectDBInstruction& record = records[i];
+			if (record.operandoffset > operandcount || record.operandcount > operandcount - record.operandoffset || record.operandcount > UINT8_MAX || record.size > UINT8_MAX)
+				return false;
+			instructions->addrs.push_back (record.addr);
+			instructions->sizes.push_back (record.size);
+			instructions->operandCounts.push_back (record.operandcount);
+			instructions->operandOffsets.push_back (instructions->operands.size());
+			instructions->instrdefs.push_back (record.instrdef ? arch->getInstrDef (record.instrdef) : nullptr);
+			instructions->pushDests (record.nojumpdest, record.jumpdest, record.calldest);
+			for (size_t j = 0; j < record.operandcount; j++)
+				instructions->operands.push_back (toIRArgument (&operands[record.operandoffset + j]));
+		}
+		return true;
+	}
+	void appendBlocks (HIdList<DisAsmBasicBlock>* basicblocks, HList<ProjectDBBlock>* records) {
+		for (DisAsmBasicBlock& bb : *basicblocks)
+			records->push_back ({bb.id, bb.nextblock, bb.nextcondblock, bb.jumptable, bb.instrOffset, bb.instrCount, bb.addr, bb.size});
+	}
+	bool readBlocks (Function* function, const ProjectDBBlock* records, size_t count) {
+		HId maxId = 0;
+		for (size_t i = 0; i < count; i++) {
+			const ProjectDBBlock& record = records[i];
+			if (record.instrOffset > function->instructions.size() || record.instrCount > function->instructions.size() - record.instrOffset)
+				return false;
+			DisAsmBasicBlock bb;
+			bb.id = record.id;
+			bb.instrOffset = record.instrOffset;
+			bb.instrCount = record.instrCount;
+			bb.nextblock = record.nextblock;
+			bb.nextcondblock = record.nextcondblock;
+			bb.jumptable = record.jumptable;
+			bb.addr = record.addr;
+			bb.size = record.size;
+			function->basicblocks.list.push_back (bb);
+			function->blockIndex[bb.addr] = bb.id;
+			maxId = std::max (maxId, bb.id);
+		}
+		restoreGenerator (function->basicblocks, maxId);
+		return true;
+	}
+	void appendSSARepresentation (SSARepresentation* ssaRep, HList<ProjectDBSSABlock>* blocks, HList<HId>* ids, HList<ProjectDBSSAExpression>* exprs, HList<ProjectDBSSAArgument>* args) {
+		for (SSAExpression& expr : ssaRep->expressions) {
+			exprs->push_back ({expr.id, (uint32_t) expr.type, expr.refcount, expr.size, (uint32_t) expr.returntype, expr.builtinId, (uint32_t) expr.location, expr.locref.refId, expr.locref.index, (uint32_t) expr.subExpressions.size(), args->size(), expr.instrAddr});
+			for (SSAArgument& arg : expr.subExpressions)
+				args->push_back ({(uint32_t) arg.type, arg.size, arg.uval, (uint32_t) arg.location, arg.locref.refId, arg.locref.index, 0});
+		}
+		for (SSABB& bb : ssaRep->bbs) {
+			blocks->push_back ({bb.id, bb.fallthroughId, bb.startaddr, bb.endaddr, bb.reachable, (uint32_t) bb.exprIds.size(), ids->size(), (uint32_t) bb.inBlocks.size(), (uint32_t) bb.outBlocks.size(), ids->size() + bb.exprIds.size()});
+			ids->insert (ids->end(), bb.exprIds.begin(), bb.exprIds.end());
+			ids->insert (ids->end(), bb.inBlocks.begin(), bb.inBlocks.end());
+			ids->insert (ids->end(), bb.outBlocks.begin(), bb.outBlocks.end());
+		}
+	}
+	bool readSSARepresentation (SSARepresentation* ssaRep, const ProjectDBSSABlock* blocks, size_t blockcount, const HId* ids, size_t idcount, const ProjectDBSSAExpression* exprs, size_t exprcount, const ProjectDBSSAArgument* args, size_t argcount) {
+		for (size_t i = 0; i < exprcount; i++) {
+			const ProjectDBSSAExpression& record = exprs[i];
+			if ( (record.id && record.id != i + 1) || record.argoffset > argcount || record.argcount > argcount - record.argoffset)
+				return false;
+			SSAExpression expr;
+			expr.type = (SSAExprType) record.type;
+			expr.refcount = record.refcount;
+			expr.size = record.size;
+			expr.returntype = (SSAType) record.returntype;
+			expr.builtinId = record.subtype;
+			expr.location = (SSAExprLocation) record.location;
+			expr.locref = {record.locrefId, record.locrefIndex};
+			expr.instrAddr = record.instrAddr;
+			expr.subExpressions.reserve (record.argcount);
+			for (size_t j = 0; j < record.argcount; j++) {
+				const ProjectDBSSAArgument& argRecord = args[record.argoffset + j];
+				SSAArgument arg;
+				arg.type = (SSAArgType) argRecord.type;
+				arg.size = argRecord.size;
+				arg.uval = argRecord.value;
+				arg.location = (SSAExprLocation) argRecord.location;
+				arg.locref = {argRecord.locrefId, argRecord.locrefIndex};
+				expr.subExpressions.push_back (arg);
+			}
+			ssaRep->expressions.push_back (expr);
+			if (!record.id)
+				ssaRep->expressions[i + 1].id = 0;
+		}
+		HId maxId = 0;
+		for (size_t i = 0; i < blockcount; i++) {
+			const ProjectDBSSABlock& record = blocks[i];
+			if (record.exproffset > idcount || record.exprcount > idcount - record.exproffset ||
+			        record.inoffset > idcount || (uint64_t) record.incount + record.outcount > idcount - record.inoffset)
+				return false;
+			SSABB bb;
+			bb.id = record.id;
+			bb.fallthroughId = record.fallthroughId;
+			bb.startaddr = record.startaddr;
+			bb.endaddr = record.endaddr;
+			bb.reachable = record.reachable;
+			bb.exprIds.assign (ids + record.exproffset, ids + record.exproffset + record.exprcount);
+			const HId* inIds = ids + record.inoffset;
+			bb.inBlocks.list.assign (inIds, inIds + record.incount);
+			bb.outBlocks.list.assign (inIds + record.incount, inIds + record.incount + record.outcount);
+			ssaRep->bbs.list.push_back (bb);
+			maxId = std::max (maxId, bb.id);
+		}
+		restoreGenerator (ssaRep->bbs, maxId);
+		return true;
+	}
+
+	bool ProjectDB::loadFunction (Function* function) {
+		std::unique_lock<std::mutex> lock (mutex);
+		auto it = pending.find (function->id);
+		if (it == pending.end())
+			return true;
+		const ProjectDBFunction& record = *it->second;
+		pending.erase (it);
+
+		bool valid = readInstructions (arch, &function->instructions, column<ProjectDBInstruction> (eProjectInstructions) + record.instructions.offset, record.instructions.count,
+		                               column<IRTableArgument> (eProjectOperands), header->columns[eProjectOperands].count) &&
+		             readBlocks (function, column<ProjectDBBlock> (eProjectBlocks) + record.blocks.offset, record.blocks.count) &&
+		             readSSARepresentation (&function->ssaRep, column<ProjectDBSSABlock> (eProjectSSABlocks) + record.ssablocks.offset, record.ssablocks.count,
+		                                    column<HId> (eProjectSSAIds), header->columns[eProjectSSAIds].count,
+		                                    column<ProjectDBSSAExpression> (eProjectSSAExpressions) + record.ssaexpressions.offset, record.ssaexpressions.count,
+		                                    column<ProjectDBSSAArgument> (eProjectSSAArguments), header->columns[eProjectSSAArguments].count);
+
+		const ProjectDBJumpTable* jumptables = column<ProjectDBJumpTable> (eProjectJumpTables) + record.jumptables.offset;
+		const ProjectDBJumpEntry* entries = column<ProjectDBJumpEntry> (eProjectJumpEntries);
+		HId maxId = 0;
+		for (size_t i = 0; valid && i < record.jumptables.count; i++) {
+			const ProjectDBJumpTable& tableRecord = jumptables[i];
+			if (!inColumn (eProjectJumpEntries, tableRecord.entryoffset, tableRecord.entrycount)) {
+				valid = false;
+				break;
+			}
+			JumpTable table;
+			table.id = tableRecord.id;
+			table.addr = tableRecord.addr;
+			for (size_t j = 0; j < tableRecord.entrycount; j++) {
+				const ProjectDBJumpEntry& entry = entries[tableRecord.entryoffset + j];
+				table.entries.push_back ({entry.addr, entry.targetaddr, entry.bb_id});
+			}
+			function->jumptables.list.push_back (table);
+			maxId = std::max (maxId, table.id);
+		}
+		restoreGenerator (function->jumptables, maxId);
+		if (!valid)
+			printf ("Function at Address 0x%" PRIx64 " of the Project is corrupt\n", record.baseaddr);
+		return valid;
+	}
+
+	bool ProjectDB::write (const char* path, Binary* binary) {
+		//functions that were never used have to be read before the mapping is replaced
+		for (Function* function : binary->functions) {
+			if (!loadFunction (function))
+				return false;
+		}
+		ProjectDBWriter writer (arch);
+		return writer.open (path) && writer.finish (binary);
+	}
+
+	ProjectDBWriter::~ProjectDBWriter() {
+		close();
+	}
+
+	bool ProjectDBWriter::open (const char* path) {
+		close();
+		//the columns after the functions are filled per function
+		for (size_t i = eProjectFunctions + 1; i < eProjectColumnCount; i++) {
+			spools[i] = tmpfile();
+			if (!spools[i]) {
+				printf ("Could not create temporary File for Project %s\n", path);
+				close();
+				return false;
+			}
+		}
+		this->path = path;
+		return true;
+	}
+	void ProjectDBWriter::close() {
+		for (size_t i = 0; i < eProjectColumnCount; i++) {
+			if (spools[i])
+				fclose (spools[i]);
+			spools[i] = nullptr;
+			counts[i] = 0;
+		}
+		HList<ProjectDBFunction>().swap (functions);
+		added.clear();
+		failed = false;
+		path.clear();
+	}
+
+	template<typename T>
+	void ProjectDBWriter::spool (ProjectDBColumnType type, HList<T>* records) {
+		if (!records->empty() && fwrite (records->data(), sizeof (T), records->size(), spools[type]) != records->size())
+			failed = true;
+		counts[type] += records->size();
+	}
+
+	bool ProjectDBWriter::addFunction (Function* function) {
+		ProjectDBFunction record = {};
+		record.id = function->id;
+		record.symbolref = function->symbolref;
+		record.callingconvention = function->callingconvention;
+		record.flags = (function->hasRegStates ? H_PROJECTDB_FUNC_REGSTATES : 0) |
+		               (function->stackAdjustKnown ? H_PROJECTDB_FUNC_STACKADJUST : 0) |
+		               (function->stackReadEndKnown ? H_PROJECTDB_FUNC_STACKREADEND : 0);
+		record.baseaddr = function->baseaddr;
+		record.stackAdjust = function->stackAdjust;
+		record.stackReadEnd = function->stackReadEnd;
+
+		//offsets are relative to the function until it gets its place in the columns
+		HList<ProjectDBRegState> regstates;
+		for (RegisterState& state : function->regStates)
+			regstates.push_back ({state.regId, 0, state.flags.mask});
+		HList<uint64_t> calls (function->funcsCalled.begin(), function->funcsCalled.end());
+		HList<ProjectDBInstruction> instructions;
+		HList<IRTableArgument> operands;
+		appendInstructions (&function->instructions, &instructions, &operands);
+		HList<ProjectDBBlock> blocks;
+		appendBlocks (&function->basicblocks, &blocks);
+		HList<ProjectDBJumpTable> jumptables;
+		HList<ProjectDBJumpEntry> entries;
+		for (JumpTable& table : function->jumptables) {
+			jumptables.push_back ({table.id, (uint32_t) table.entries.size(), entries.size(), table.addr});
+			for (JumpTable::HEntry& entry : table.entries)
+				entries.push_back ({entry.addr, entry.targetaddr, entry.bb_id, 0});
+		}
+		HList<ProjectDBSSABlock> ssablocks;
+		HList<HId> ssaids;
+		HList<ProjectDBSSAExpression> exprs;
+		HList<ProjectDBSSAArgument> args;
+		appendSSARepresentation (&function->ssaRep, &ssablocks, &ssaids, &exprs, &args);
+
+		std::unique_lock<std::mutex> lock (mutex);
+		if (!isOpen() || added.find (function->id) != added.end())
+			return false;
+		for (ProjectDBInstruction& instr : instructions)
+			instr.operandoffset += counts[eProjectOperands];
+		for (ProjectDBJumpTable& table : jumptables)
+			table.entryoffset += counts[eProjectJumpEntries];
+		for (ProjectDBSSABlock& block : ssablocks) {
+			block.exproffset += counts[eProjectSSAIds];
+			block.inoffset += counts[eProjectSSAIds];
+		}
+		for (ProjectDBSSAExpression& expr : exprs)
+			expr.argoffset += counts[eProjectSSAArguments];
+
+		record.regstates = {counts[eProjectRegStates], regstates.size()};
+		record.calls = {counts[eProjectCalls], calls.size()};
+		record.instructions = {counts[eProjectInstructions], instructions.size()};
+		record.blocks = {counts[eProjectBlocks], blocks.size()};
+		record.jumptables = {counts[eProjectJumpTables], jumptables.size()};
+		record.ssaexpressions = {counts[eProjectSSAExpressions], exprs.size()};
+		record.ssablocks = {counts[eProjectSSABlocks], ssablocks.size()};
+		spool (eProjectRegStates, &regstates);
+		spool (eProjectCalls, &calls);
+		spool (eProjectBlocks, &blocks);
+		spool (eProjectInstructions, &instructions);
+		spool (eProjectOperands, &operands);
+		spool (eProjectJumpTables, &jumptables);
+		spool (eProjectJumpEntries, &entries);
+		spool (eProjectSSABlocks, &ssablocks);
+		spool (eProjectSSAIds, &ssaids);
+		spool (eProjectSSAExpressions, &exprs);
+		spool (eProjectSSAArguments, &args);
+		functions.push_back (record);
+		added.insert (function->id);
+		return !failed;
+	}
+
+	bool ProjectDBWriter::finish (Binary* binary) {
+		if (!isOpen())
+			return false;
+		for (Function* function : binary->functions) {
+			if (added.find (function->id) == added.end())
+				addFunction (function);
+		}
+
+		HList<char> strings;
+		HList<ProjectDBSection> sections;
+		HList<ProjectDBSymbol> symbols;
+
+		auto addString = [&strings] (const char* str) {
+			uint32_t offset = strings.size();
+			strings.insert (strings.end(), str, str + strlen (str) + 1);
+			return offset;
+		};
+		//offset 0 is the empty string
+		addString ("");
+
+		std::function<void (Section*, uint32_t) > addSection = [&] (Section * section, uint32_t parent) {
+			sections.push_back ({section->id, parent, section->srwx, addString (section->name.cstr()), section->offset, section->vaddr, section->size});
+			uint32_t index = sections.size();
+			for (Section* subsection : section->subsections)
+				addSection (subsection, index);
+		};
+		for (Section* section : binary->sections)
+			addSection (section, 0);
+		for (Symbol* symbol : binary->symbols)
+			symbols.push_back ({symbol->id, symbol->typeId, addString (symbol->name.cstr()), addString (symbol->symboltype ? symbol->symboltype->name.cstr() : ""), symbol->vaddr, symbol->size});
+		//the functions of the binary are looked up by id
+		std::sort (functions.begin(), functions.end(), [] (const ProjectDBFunction & lhs, const ProjectDBFunction & rhs) {
+			return lhs.id < rhs.id;
+		});
+
+		ProjectDBHeader header = {};
+		header.magic = H_PROJECTDB_MAGIC;
+		header.version = H_PROJECTDB_VERSION;
+		header.headersize = sizeof (ProjectDBHeader);
+		header.archchecksum = arch->getSourceChecksum();
+		header.datasize = binary->data->size;
+		header.datahash = hashData (binary->data);
+		header.bitbase = binary->bitbase;
+		header.archname = addString (binary->arch.cstr());
+
+		const void* columns[eProjectColumnCount] = {strings.data(), sections.data(), symbols.data(), binary->entrypoints.data(), functions.data()};
+		counts[eProjectStrings] = strings.size();
+		counts[eProjectSections] = sections.size();
+		counts[eProjectSymbols] = symbols.size();
+		counts[eProjectEntrypoints] = binary->entrypoints.size();
+		counts[eProjectFunctions] = functions.size();
+		//8 byte aligned columns so the mapping can be read in place
+		uint64_t offset = sizeof (ProjectDBHeader);
+		for (size_t i = 0; i < eProjectColumnCount; i++) {
+			offset = (offset + 7) & ~ (uint64_t) 7;
+			header.columns[i] = {offset, counts[i]};
+			offset += counts[i] * columnElementSizes[i];
+		}
+		header.filesize = offset;
+
+		//the project that is currently mapped may be the one that is replaced
+		std::string tmppath = path + ".tmp";
+		FILE* file = fopen (tmppath.c_str(), "wb");
+		if (!file) {
+			printf ("Could not open File %s\n", tmppath.c_str());
+			close();
+			return false;
+		}
+		bool written = !failed && fwrite (&header, sizeof (ProjectDBHeader), 1, file) == 1;
+		uint64_t position = sizeof (ProjectDBHeader);
+		uint8_t buffer[0x10000] = {};
+		for (size_t i = 0; written && i < eProjectColumnCount; i++) {
+			uint64_t padding = header.columns[i].offset - position;
+			uint64_t size = counts[i] * columnElementSizes[i];
+			written = fwrite (buffer, 1, padding, file) == padding;
+			if (spools[i]) {
+				//copied from the temporary file
+				written = written && fflush (spools[i]) == 0 && fseek (spools[i], 0, SEEK_SET) == 0;
+				for (uint64_t copied = 0; written && copied < size;) {
+					size_t chunk = std::min<uint64_t> (sizeof (buffer), size - copied);
+					written = fread (buffer, 1, chunk, spools[i]) == chunk && fwrite (buffer, 1, chunk, file) == chunk;
+					copied += chunk;
+				}
+				memset (buffer, 0, sizeof (buffer));
+			} else if (size) {
+				written = written && fwrite (columns[i], 1, size, file) == size;
+			}
+			position = header.columns[i].offset + size;
+		}
+		written = fclose (file) == 0 && written;
+		if (!written || rename (tmppath.c_str(), path.c_str()) != 0) {
+			printf ("Could not write Project %s\n", path.c_str());
+			remove (tmppath.c_str());
+			close();
+			return false;
+		}
+		printf ("Wrote Project %s with %zu Functions, %zu Instructions, %zu SSA-Expressions in %" PRIu64 " Bytes\n", path.c_str(), functions.size(),
+		        (size_t) counts[eProjectInstructions], (size_t) counts[eProjectSSAExpressions], header.filesize);
+		close();
+		return true;
+	}
+}
@@ -0,0 +1,263 @@
+#ifndef H_PROJECTDB_H
+#define H_PROJECTDB_H
+
+#include "General.h"
+#include "IRTables.h"
+#include "Function.h"
+
+#include <mutex>
+#include <string>
+#include <stdio.h>
+
+//"HOLOPROJ"
+#define H_PROJECTDB_MAGIC (0x4a4f52504f4c4f48ULL)
+#define H_PROJECTDB_VERSION (1)
+
+namespace holodec {
+
+	struct Binary;
+	struct Data;
+
+	//the project is stored as columns of fixed size records, every column is 8 byte aligned and read in place from the mapping
+	//records refer to the rows of other columns by index, strings are offsets into the string column
+	enum ProjectDBColumnType {
+		eProjectStrings = 0,
+		eProjectSections,
+		eProjectSymbols,
+		eProjectEntrypoints,
+		eProjectFunctions,
+		eProjectRegStates,
+		eProjectCalls,
+		eProjectBlocks,
+		eProjectInstructions,
+		eProjectOperands,
+		eProjectJumpTables,
+		eProjectJumpEntries,
+		eProjectSSABlocks,
+		eProjectSSAIds,
+		eProjectSSAExpressions,
+		eProjectSSAArguments,
+		eProjectColumnCount
+	};
+	struct ProjectDBColumn {
+		uint64_t offset;
+		uint64_t count;
+	};
+	struct ProjectDBHeader {
+		uint64_t magic;
+		uint32_t version;
+		uint32_t headersize;
+		//Architecture::getSourceChecksum, register and instruction ids are only valid for the same architecture
+		uint64_t archchecksum;
+		//the analyzed file
+		uint64_t datasize;
+		uint64_t datahash;
+		uint64_t filesize;
+
+		uint64_t bitbase;
+		uint64_t archname;
+		ProjectDBColumn columns[eProjectColumnCount];
+	};
+
+	struct ProjectDBSection {
+		HId id;
+		//index + 1 of the enclosing section or 0, the enclosing section is always stored first
+		uint32_t parent;
+		uint32_t srwx;
+		uint32_t name;
+		uint64_t offset;
+		uint64_t vaddr;
+		uint64_t size;
+	};
+	struct ProjectDBSymbol {
+		HId id;
+		HId typeId;
+		uint32_t name;
+		//name of the SymbolType
+		uint32_t symboltype;
+		uint64_t vaddr;
+		uint64_t size;
+	};
+	//the summary is loaded with the binary, the rest of the function on first access
+	struct ProjectDBFunction {
+		HId id;
+		HId symbolref;
+		HId callingconvention;
+		uint32_t flags;
+		uint64_t baseaddr;
+		int64_t stackAdjust;
+		int64_t stackReadEnd;
+
+		ProjectDBColumn regstates;
+		ProjectDBColumn calls;
+		ProjectDBColumn blocks;
+		ProjectDBColumn instructions;
+		ProjectDBColumn jumptables;
+		ProjectDBColumn ssablocks;
+		ProjectDBColumn ssaexpressions;
+	};
+#define H_PROJECTDB_FUNC_REGSTATES (0x1)
+#define H_PROJECTDB_FUNC_STACKADJUST (0x2)
+#define H_PROJECTDB_FUNC_STACKREADEND (0x4)
+
+	struct ProjectDBRegState {
+		HId regId;
+		uint32_t pad;
+		uint64_t flags;
+	};
+	struct ProjectDBBlock {
+		HId id;
+		HId nextblock;
+		HId nextcondblock;
+		HId jumptable;
+		//relative to the instructions of the function
+		uint64_t instrOffset;
+		uint64_t instrCount;
+		uint64_t addr;
+		uint64_t size;
+	};
+	struct ProjectDBInstruction {
+		uint64_t addr;
+		uint64_t size;
+		HId instrdef;
+		uint32_t operandcount;
+		uint64_t operandoffset;
+		uint64_t nojumpdest;
+		uint64_t jumpdest;
+		uint64_t calldest;
+	};
+	struct ProjectDBJumpTable {
+		HId id;
+		uint32_t entrycount;
+		uint64_t entryoffset;
+		uint64_t addr;
+	};
+	struct ProjectDBJumpEntry {
+		uint64_t addr;
+		uint64_t targetaddr;
+		HId bb_id;
+		uint32_t pad;
+	};
+	struct ProjectDBSSABlock {
+		HId id;
+		HId fallthroughId;
+		uint64_t startaddr;
+		uint64_t endaddr;
+		uint32_t reachable;
+		uint32_t exprcount;
+		uint64_t exproffset;
+		uint32_t incount;
+		uint32_t outcount;
+		//outBlocks follow the inBlocks
+		uint64_t inoffset;
+	};
+	struct ProjectDBSSAExpression {
+		//0 for removed expressions, they keep their slot so the ids stay the same
+		HId id;
+		uint32_t type;
+		uint64_t refcount;
+		uint64_t size;
+		uint32_t returntype;
+		//flagType, opType or builtinId
+		uint32_t subtype;
+		uint32_t location;
+		HId locrefId;
+		HId locrefIndex;
+		uint32_t argcount;
+		uint64_t argoffset;
+		uint64_t instrAddr;
+	};
+	struct ProjectDBSSAArgument {
+		uint32_t type;
+		uint32_t size;
+		//ssaId, sval, uval or fval
+		uint64_t value;
+		uint32_t location;
+		HId locrefId;
+		HId locrefIndex;
+		uint32_t pad;
+	};
+
+	//the records of a function, ids and arguments are appended to the shared columns
+	void appendInstructions (InstructionList* instructions, HList<ProjectDBInstruction>* records, HList<IRTableArgument>* operands);
+	bool readInstructions (Architecture* arch, InstructionList* instructions, const ProjectDBInstruction* records, size_t count, const IRTableArgument* operands, size_t operandcount);
+	void appendBlocks (HIdList<DisAsmBasicBlock>* basicblocks, HList<ProjectDBBlock>* records);
+	//needs the instructions of the function
+	bool readBlocks (Function* function, const ProjectDBBlock* records, size_t count);
+	void appendSSARepresentation (SSARepresentation* ssaRep, HList<ProjectDBSSABlock>* blocks, HList<HId>* ids, HList<ProjectDBSSAExpression>* exprs, HList<ProjectDBSSAArgument>* args);
+	bool readSSARepresentation (SSARepresentation* ssaRep, const ProjectDBSSABlock* blocks, size_t blockcount, const HId* ids, size_t idcount,
+	                            const ProjectDBSSAExpression* exprs, size_t exprcount, const ProjectDBSSAArgument* args, size_t argcount);
+
+	//an analyzed binary stored in a file that is mapped back instead of analyzing it again
+	//functions are materialized from the mapping on first access, so only the pages of the used functions are read
+	class ProjectDB {
+	public:
+		Architecture* arch;
+
+		ProjectDB (Architecture* arch) : arch (arch) {}
+		~ProjectDB();
+
+		//maps the project, fails if it is not for the given file and architecture
+		bool open (const char* path, Data* data);
+		void close();
+
+		//creates the sections, symbols and functions, the functions only contain their summary
+		bool loadBinary (Binary* binary);
+		//loads the rest of a function from the project if it was not loaded yet
+		bool loadFunction (Function* function);
+
+		bool write (const char* path, Binary* binary);
+
+	private:
+		const uint8_t* base = nullptr;
+		size_t size = 0;
+		const ProjectDBHeader* header = nullptr;
+		//functions that were not loaded yet
+		HMap<HId, const ProjectDBFunction*> pending;
+		std::mutex mutex;
+
+		template<typename T>
+		const T* column (ProjectDBColumnType type) {
+			return (const T*) (base + header->columns[type].offset);
+		}
+		bool inColumn (ProjectDBColumnType type, uint64_t offset, uint64_t count) {
+			return offset <= header->columns[type].count && count <= header->columns[type].count - offset;
+		}
+		const char* getString (uint64_t offset);
+	};
+
+	//writes a project while the binary is analyzed
+	//the records of an added function go to temporary files, so the function can be released right after it was added
+	class ProjectDBWriter {
+	public:
+		Architecture* arch;
+
+		ProjectDBWriter (Architecture* arch) : arch (arch) {}
+		~ProjectDBWriter();
+
+		bool open (const char* path);
+		bool isOpen() {
+			return !path.empty();
+		}
+		//can be called from multiple threads
+		bool addFunction (Function* function);
+		//adds the functions that were not added yet and the rest of the binary and moves the project in place
+		bool finish (Binary* binary);
+		void close();
+
+	private:
+		std::string path;
+		//a temporary file for every column of the functions, the other columns are only created by finish
+		FILE* spools[eProjectColumnCount] = {};
+		uint64_t counts[eProjectColumnCount] = {};
+		HList<ProjectDBFunction> functions;
+		HSet<HId> added;
+		bool failed = false;
+		std::mutex mutex;
+
+		template<typename T>
+		void spool (ProjectDBColumnType type, HList<T>* records);
+	};
+}
+
+#endif // H_PROJECTDB_H
@@ -1,8 +1,12 @@
 
 #include "SSA.h"
 #include "Architecture.h"
+#include "Logger.h"
+#include "Profiler.h"
 
+#include <inttypes.h>
 #include <cassert>
+#include <algorithm>
 
 namespace holodec {
 
@@ -288,9 +292,11 @@ namespace holodec {
 
 
 	void SSARepresentation::replaceNodes (HMap<HId, SSAArgument>* replacements) {
+		H_PROFILE_SCOPE ("replaceNodes");
 
 		bool replaced = false;
 		do {
+			H_PROFILE_COUNT (eProfileReplaceRounds, 1);
 			replaced = false;
 			for (auto it = replacements->begin(); it != replacements->end(); ++it) {
 				if (it->second.type != SSAArgType::eId || it->first == it->second.ssaId)  //
@@ -320,7 +326,7 @@ namespace holodec {
 			}
 		} while (replaced);
 
-		printf ("Remove\n");
+		H_LOG_TRACE (eLogSSA, "Remove\n");
 		for (SSABB& bb : bbs) {
 			for (auto it = bb.exprIds.begin(); it != bb.exprIds.end();) {
 				if (replacements->find (*it) != replacements->end()) {
@@ -330,7 +336,7 @@ namespace holodec {
 				it++;
 			}
 		}
-		printf ("Change Args\n");
+		H_LOG_TRACE (eLogSSA, "Change Args\n");
 		for (SSAExpression& expr : expressions) {
 			for (SSAArgument& arg : expr.subExpressions) {
 				if (arg.type == SSAArgType::eId) {
@@ -341,8 +347,15 @@ namespace holodec {
 							if (it->second.type == SSAArgType::eId)
 								changeRefCount (it->second.ssaId, expr.refcount);
 						} else {
+							//the location of call and return arguments is the register that is passed
+							SSAExprLocation location = arg.location;
+							Reference locref = arg.locref;
 							//References are already removed in the previous loop at removeExpr
 							arg = it->second;
+							if ((expr.type == SSAExprType::eCall || expr.type == SSAExprType::eReturn) && location != SSAExprLocation::eNone) {
+								arg.location = location;
+								arg.locref = locref;
+							}
 							if (it->second.type == SSAArgType::eId)
 								changeRefCount (it->second.ssaId, 1);
 						}
@@ -363,7 +376,37 @@ namespace holodec {
 		}
 	}
 
+	void SSARepresentation::calcReversePostorder (HList<HId>* order) {
+		order->clear();
+		if (!bbs.size())
+			return;
+		HId maxBlockId = 0;
+		for (SSABB& bb : bbs)
+			maxBlockId = std::max (maxBlockId, bb.id);
+
+		HList<bool> visited (maxBlockId + 1, false);
+		HList<std::pair<HId, size_t>> stack;
+		stack.push_back (std::make_pair (bbs.begin()->id, (size_t) 0));
+		visited[bbs.begin()->id] = true;
+		while (!stack.empty()) {
+			SSABB* bb = bbs.get (stack.back().first);
+			size_t index = stack.back().second++;
+			if (index < bb->outBlocks.size()) {
+				HId succId = bb->outBlocks[index];
+				if (succId <= maxBlockId && !visited[succId]) {
+					visited[succId] = true;
+					stack.push_back (std::make_pair (succId, (size_t) 0));
+				}
+				continue;
+			}
+			order->push_back (bb->id);
+			stack.pop_back();
+		}
+		std::reverse (order->begin(), order->end());
+	}
+
 	void SSARepresentation::compress() {
+		H_PROFILE_SCOPE ("compress");
 
 		std::map<HId, HId> replacements;
 
@@ -439,6 +482,7 @@ namespace holodec {
 	}
 	HId SSARepresentation::addExpr (SSAExpression* expr) {
 		expressions.push_back (*expr);
+		H_PROFILE_COUNT (eProfileExpressionsCreated, 1);
 		HId newId = expressions.back().id;
 		if (!EXPR_IS_TRANSIENT (expr->type))
 			propagateRefCount (newId, 1);
@@ -522,10 +566,10 @@ namespace holodec {
 
 	HList<HId>::iterator SSARepresentation::removeExpr (HList<HId>& ids, HList<HId>::iterator it) {
 		SSAExpression& expr = expressions[*it];
-		if(expr.instrAddr >= 0x401607 && expr.instrAddr < 0x401620)
-			printf("Removing Output %d\n", expr.id);
+		H_LOG_TRACE (eLogSSA, "Removing Expression %d at Address 0x%" PRIx64 "\n", expr.id, expr.instrAddr);
 		propagateRefCount (&expr, -1);
 		expr.id = 0;
+		H_PROFILE_COUNT (eProfileExpressionsRemoved, 1);
 		return ids.erase (it);
 	}
 	void SSARepresentation::removeExpr (HId ssaId, HId blockId) {
@@ -566,7 +610,7 @@ namespace holodec {
 
 		for (SSABB& bb : bbs) {
 			printIndent (indent + 1);
-			printf ("Block bb Id: %d 0x%x - 0x%x\n", bb.id, bb.startaddr, bb.endaddr);
+			printf ("Block bb Id: %d 0x%x - 0x%x%s\n", bb.id, bb.startaddr, bb.endaddr, bb.reachable ? "" : " Unreachable");
 
 			printIndent (indent + 1);
 			printf ("InBlocks ");
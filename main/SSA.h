@@ -300,6 +300,8 @@ namespace holodec {
 		uint64_t startaddr = (uint64_t)-1;
 		uint64_t endaddr = 0;
 		HList<HId> exprIds;
+		//cleared for blocks that can never be executed, they are empty and have no edges
+		bool reachable = true;
 		HUniqueList<HId> inBlocks;
 		HUniqueList<HId> outBlocks;
 
@@ -321,11 +323,18 @@ namespace holodec {
 			bbs.clear();
 			expressions.clear();
 		}
+		void release(){
+			bbs.release();
+			expressions.release();
+		}
 
 		void replaceNodes(HMap<HId,SSAArgument>* replacements);
 		void removeNodes(HSet<HId>* ids);
 		
 		void compress();
+
+		//blocks reachable from the entry block in reverse postorder
+		void calcReversePostorder (HList<HId>* order);
 		
 		void propagateRefCount(SSAExpression* expr, int64_t modifier);
 		void propagateRefCount(HId id, int64_t modifier = 1);
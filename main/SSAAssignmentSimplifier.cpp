@@ -4,13 +4,18 @@
 #include "General.h"
 #include "SSA.h"
 #include "Function.h"
+#include "Logger.h"
+#include "Profiler.h"
+
+#include <inttypes.h>
 
 
 namespace holodec{
 	
 	void SSAAssignmentSimplifier::doTransformation (Function* function){
 		
-		printf ("Simplifying Assignments for Function at Address 0x%x\n", function->baseaddr);
+		H_PROFILE_SCOPE ("AssignmentSimplifier");
+		H_LOG_DEBUG (eLogSSA, "Simplifying Assignments for Function at Address 0x%" PRIx64 "\n", function->baseaddr);
 		
 		HMap<HId, SSAArgument> replacements;
 		
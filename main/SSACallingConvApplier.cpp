@@ -1,13 +1,17 @@
 #include "SSACallingConvApplier.h"
 #include "CallingConvention.h"
 #include "Architecture.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include <inttypes.h>
 #include <assert.h>
 
 namespace holodec {
 
 	void SSACallingConvApplier::doTransformation (Function* function) {
 
-		printf ("Apply Calling Convention in Function at Address 0x%x\n", function->baseaddr);
+		H_PROFILE_SCOPE ("CallingConvApplier");
+		H_LOG_DEBUG (eLogSSA, "Apply Calling Convention in Function at Address 0x%" PRIx64 "\n", function->baseaddr);
 
 		CallingConvention* cc = arch->getCallingConvention (function->callingconvention);
 
@@ -0,0 +1,359 @@
+#include "SSACallingConvInference.h"
+
+#include "CallGraph.h"
+#include "Function.h"
+#include "Architecture.h"
+#include "Logger.h"
+#include "Profiler.h"
+
+#include <inttypes.h>
+#include <algorithm>
+
+namespace holodec {
+
+	void SSACallingConvInference::doTransformation (Function* function) {
+
+		H_PROFILE_SCOPE ("CallingConvInference");
+		H_LOG_DEBUG (eLogSSA, "Infer Calling Convention for Function at Address 0x%" PRIx64 "\n", function->baseaddr);
+
+		this->function = function;
+		ssaRep = &function->ssaRep;
+		parameters.clear();
+		clobbered.clear();
+		returns.clear();
+		//calls to itself use the calling convention
+		function->hasRegStates = false;
+
+		if (!function->callingconvention) {
+			CallingConvention* defaultCC = arch->getCallingConvention (defaultConvention);
+			if (defaultCC)
+				function->callingconvention = defaultCC->id;
+		}
+		cc = arch->getCallingConvention (function->callingconvention);
+		if (!cc) {
+			H_LOG_WARN (eLogSSA, "No Calling Convention to fall back to for Function at Address 0x%" PRIx64 "\n", function->baseaddr);
+			return;
+		}
+		Stack* stack = cc->stack ? arch->getStack (cc->stack) : nullptr;
+		stackReg = stack && stack->trackingReg ? arch->getRegister (stack->trackingReg) : nullptr;
+
+		//registers whose value at a return is not the value at entry
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (!expr.id || expr.type != SSAExprType::eReturn)
+				continue;
+			for (size_t i = 1; i < expr.subExpressions.size(); i++) {
+				SSAArgument& arg = expr.subExpressions[i];
+				if (arg.location != SSAExprLocation::eReg || (stackReg && arg.locref.refId == stackReg->id))
+					continue;
+				HSet<HId> visited;
+				if (!isEntryValue (arg, arg.locref.refId, &visited)) {
+					clobbered.insert (arg.locref.refId);
+					if (isConventionReturn (cc, arg.locref.refId))
+						returns.insert (arg.locref.refId);
+				}
+			}
+		}
+
+		calcStackAdjust();
+		rewriteOutputs();
+		pruneArguments();
+		ssaRep->recalcRefCounts();
+		calcParameters();
+		selectConvention();
+		storeRegStates();
+
+		H_LOG_DEBUG (eLogSSA, "Inferred %zu Parameters, %zu Returns, %zu changed Registers, Calling Convention %s\n", parameters.size(), returns.size(), clobbered.size(),
+		        arch->getCallingConvention (function->callingconvention)->name.cstr());
+	}
+
+	Function* SSACallingConvInference::getCallee (SSAExpression* callExpr) {
+		if (!callgraph || callExpr->subExpressions.empty() || callExpr->subExpressions[0].type != SSAArgType::eUInt)
+			return nullptr;
+		return callgraph->getFunction (callExpr->subExpressions[0].uval);
+	}
+	bool SSACallingConvInference::hasSummary (Function* callee) {
+		return callgraph && callgraph->hasSummary (function, callee);
+	}
+	CallingConvention* SSACallingConvInference::getConvention (Function* callee) {
+		CallingConvention* conv = callee ? arch->getCallingConvention (callee->callingconvention) : nullptr;
+		return conv ? conv : cc;
+	}
+	bool SSACallingConvInference::calleeReads (Function* callee, HId regId) {
+		if (hasSummary (callee)) {
+			RegisterState* state = callee->getRegisterState (regId);
+			return state && (state->flags & RegisterUsedFlag::eRead);
+		}
+		for (CCParameter& para : getConvention (callee)->parameters) {
+			if (arch->getRegister (para.regref)->id == regId)
+				return true;
+		}
+		return false;
+	}
+	bool SSACallingConvInference::calleeChanges (Function* callee, HId regId) {
+		if (hasSummary (callee)) {
+			RegisterState* state = callee->getRegisterState (regId);
+			return state && (state->flags & RegisterUsedFlag::eWrite);
+		}
+		for (StringRef& regRef : getConvention (callee)->nonVolatileReg) {
+			if (arch->getRegister (regRef)->id == regId)
+				return false;
+		}
+		return true;
+	}
+	bool SSACallingConvInference::calleeReturns (Function* callee, HId regId) {
+		if (hasSummary (callee)) {
+			RegisterState* state = callee->getRegisterState (regId);
+			return state && (state->flags & RegisterUsedFlag::eFuncWrite);
+		}
+		return isConventionReturn (getConvention (callee), regId);
+	}
+	bool SSACallingConvInference::isConventionReturn (CallingConvention* conv, HId regId) {
+		for (CCParameter& para : conv->returns) {
+			if (arch->getRegister (para.regref)->id == regId)
+				return true;
+		}
+		return false;
+	}
+
+	bool SSACallingConvInference::isEntryValue (SSAArgument& arg, HId regId, HSet<HId>* visited) {
+		if (arg.type != SSAArgType::eId || !arg.ssaId)
+			return false;
+		//loops are resolved by the other arguments of the phi
+		if (visited->find (arg.ssaId) != visited->end())
+			return true;
+		visited->insert (arg.ssaId);
+
+		SSAExpression* expr = ssaRep->expressions.get (arg.ssaId);
+		switch (expr->type) {
+		case SSAExprType::eInput:
+			return expr->location == SSAExprLocation::eReg && expr->locref.refId == regId;
+		case SSAExprType::eAssign:
+			return isEntryValue (expr->subExpressions[0], regId, visited);
+		case SSAExprType::ePhi:
+			for (SSAArgument& phiArg : expr->subExpressions) {
+				if (!isEntryValue (phiArg, regId, visited))
+					return false;
+			}
+			return true;
+		case SSAExprType::eOutput: {
+			if (expr->location != SSAExprLocation::eReg || expr->locref.refId != regId)
+				return false;
+			SSAExpression* callExpr = ssaRep->expressions.get (expr->subExpressions[0].ssaId);
+			if (!callExpr || callExpr->type != SSAExprType::eCall || calleeChanges (getCallee (callExpr), regId))
+				return false;
+			for (size_t i = 1; i < callExpr->subExpressions.size(); i++) {
+				SSAArgument& callArg = callExpr->subExpressions[i];
+				if (callArg.location == SSAExprLocation::eReg && callArg.locref.refId == regId)
+					return isEntryValue (callArg, regId, visited);
+			}
+			return false;
+		}
+		default:
+			return false;
+		}
+	}
+
+	bool SSACallingConvInference::keepArgument (SSAArgument& arg) {
+		if (arg.location == SSAExprLocation::eMem)
+			return true;
+		if (arg.location != SSAExprLocation::eReg)
+			return true;
+		return stackReg && arg.locref.refId == stackReg->id;
+	}
+
+	void SSACallingConvInference::calcStackAdjust() {
+		function->stackAdjust = 0;
+		function->stackAdjustKnown = false;
+		function->stackReadEnd = 0;
+		function->stackReadEndKnown = false;
+		if (!stackReg)
+			return;
+		memory.arch = arch;
+		memory.callgraph = callgraph;
+		memory.analyze (function);
+
+		//the arguments on the stack that are read by the function or the functions it calls
+		bool readEndKnown = !memory.stackEscapes;
+		int64_t readEnd = 0;
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (!readEndKnown)
+				break;
+			if (!expr.id)
+				continue;
+			if (expr.type == SSAExprType::eLoad) {
+				SSAMemLocation& location = memory.locations[expr.id];
+				if (!location.isStack)
+					continue;
+				if (!location.offsetKnown || !location.size || !memory.isStackPointer (&ssaRep->expressions[location.base]))
+					readEndKnown = false;
+				else
+					readEnd = std::max (readEnd, location.offset + (int64_t) location.size);
+			} else if (SSAMemorySSA::isClobber (expr.type)) {
+				Function* callee = expr.type == SSAExprType::eCall ? getCallee (&expr) : nullptr;
+				SSAArgument* spArg = nullptr;
+				for (SSAArgument& arg : expr.subExpressions) {
+					if (arg.location == SSAExprLocation::eReg && arg.locref.refId == stackReg->id)
+						spArg = &arg;
+				}
+				SSAMemLocation location;
+				if (spArg)
+					location = memory.getLocation (*spArg, 0);
+				if (!hasSummary (callee) || !callee->stackReadEndKnown || !spArg || !location.offsetKnown || !location.base || !memory.isStackPointer (&ssaRep->expressions[location.base]))
+					readEndKnown = false;
+				else
+					readEnd = std::max (readEnd, location.offset + callee->stackReadEnd);
+			}
+		}
+		function->stackReadEnd = readEnd;
+		function->stackReadEndKnown = readEndKnown;
+
+		bool first = true;
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (!expr.id || expr.type != SSAExprType::eReturn)
+				continue;
+			for (size_t i = 1; i < expr.subExpressions.size(); i++) {
+				SSAArgument& arg = expr.subExpressions[i];
+				if (arg.location != SSAExprLocation::eReg || arg.locref.refId != stackReg->id)
+					continue;
+				SSAMemLocation location = memory.getLocation (arg, 0);
+				bool known = location.isStack && location.offsetKnown && location.base && memory.isStackPointer (&ssaRep->expressions[location.base]);
+				if (!known || (!first && location.offset != function->stackAdjust)) {
+					function->stackAdjustKnown = false;
+					return;
+				}
+				function->stackAdjust = location.offset;
+				function->stackAdjustKnown = true;
+				first = false;
+			}
+		}
+	}
+
+	void SSACallingConvInference::rewriteOutputs() {
+		HMap<HId, SSAArgument> replacements;
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (!expr.id || expr.type != SSAExprType::eOutput || expr.location != SSAExprLocation::eReg)
+				continue;
+			HId regId = expr.locref.refId;
+			if (stackReg && regId == stackReg->id)
+				continue;
+			SSAExpression* callExpr = ssaRep->expressions.get (expr.subExpressions[0].ssaId);
+			if (!callExpr || callExpr->type != SSAExprType::eCall)
+				continue;
+			Function* callee = getCallee (callExpr);
+			if (!calleeChanges (callee, regId)) {
+				//the register has the same value as before the call
+				for (size_t i = 1; i < callExpr->subExpressions.size(); i++) {
+					SSAArgument& arg = callExpr->subExpressions[i];
+					if (arg.location == SSAExprLocation::eReg && arg.locref.refId == regId) {
+						replacements.insert (std::pair<HId, SSAArgument> (expr.id, arg));
+						break;
+					}
+				}
+			} else if (!calleeReturns (callee, regId)) {
+				replacements.insert (std::pair<HId, SSAArgument> (expr.id, SSAArgument::createUndef (expr.location, expr.locref, expr.size)));
+			}
+		}
+		if (!replacements.empty())
+			ssaRep->replaceNodes (&replacements);
+	}
+
+	void SSACallingConvInference::pruneArguments() {
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (!expr.id || expr.subExpressions.empty())
+				continue;
+			if (expr.type == SSAExprType::eCall) {
+				Function* callee = getCallee (&expr);
+				for (auto it = expr.subExpressions.begin() + 1/* skip the target*/; it != expr.subExpressions.end();) {
+					if (keepArgument (*it) || calleeReads (callee, it->locref.refId)) {
+						++it;
+						continue;
+					}
+					it = expr.subExpressions.erase (it);
+				}
+			} else if (expr.type == SSAExprType::eReturn) {
+				for (auto it = expr.subExpressions.begin() + 1/* skip the return address*/; it != expr.subExpressions.end();) {
+					if (keepArgument (*it) || returns.find (it->locref.refId) != returns.end()) {
+						++it;
+						continue;
+					}
+					it = expr.subExpressions.erase (it);
+				}
+			}
+		}
+	}
+
+	void SSACallingConvInference::calcParameters() {
+		//an input is a parameter if a side effect depends on it after the plumbing was removed
+		HSet<HId> live;
+		HList<HId> worklist;
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (expr.id && EXPR_HAS_SIDEEFFECT (expr.type)) {
+				live.insert (expr.id);
+				worklist.push_back (expr.id);
+			}
+		}
+		while (!worklist.empty()) {
+			HId id = worklist.back();
+			worklist.pop_back();
+			for (SSAArgument& arg : ssaRep->expressions[id].subExpressions) {
+				if (arg.type == SSAArgType::eId && arg.ssaId && live.insert (arg.ssaId).second)
+					worklist.push_back (arg.ssaId);
+			}
+		}
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (!expr.id || expr.type != SSAExprType::eInput || expr.location != SSAExprLocation::eReg)
+				continue;
+			if (stackReg && expr.locref.refId == stackReg->id)
+				continue;
+			if (live.find (expr.id) != live.end())
+				parameters.insert (expr.locref.refId);
+		}
+	}
+
+	void SSACallingConvInference::selectConvention() {
+		//the first calling convention that allows the parameters and keeps its non-volatile registers, the assumed one is preferred
+		CallingConvention* selected = nullptr;
+		for (CallingConvention& conv : arch->callingconventions) {
+			bool matches = true;
+			for (HId regId : parameters) {
+				bool found = false;
+				for (CCParameter& para : conv.parameters) {
+					if (arch->getRegister (para.regref)->id == regId) {
+						found = true;
+						break;
+					}
+				}
+				if (!found) {
+					matches = false;
+					break;
+				}
+			}
+			for (StringRef& regRef : conv.nonVolatileReg) {
+				if (clobbered.find (arch->getRegister (regRef)->id) != clobbered.end())
+					matches = false;
+			}
+			if (matches && (!selected || &conv == cc))
+				selected = &conv;
+		}
+		if (selected)
+			function->callingconvention = selected->id;
+	}
+
+	void SSACallingConvInference::storeRegStates() {
+		function->regStates.clear();
+		for (Register& reg : arch->registers) {
+			if (!reg.id || reg.directParentRef)
+				continue;
+			Flags<RegisterUsedFlag> flags;
+			if (parameters.find (reg.id) != parameters.end())
+				flags |= RegisterUsedFlag::eRead;
+			if (clobbered.find (reg.id) != clobbered.end())
+				flags |= RegisterUsedFlag::eWrite;
+			if (returns.find (reg.id) != returns.end())
+				flags |= RegisterUsedFlag::eFuncWrite;
+			if (flags)
+				function->regStates.push_back ({reg.id, flags});
+		}
+		function->hasRegStates = true;
+	}
+}
@@ -0,0 +1,58 @@
+#ifndef SSACALLINGCONVINFERENCE_H
+#define SSACALLINGCONVINFERENCE_H
+
+#include "SSATransformer.h"
+#include "CallingConvention.h"
+#include "SSAMemorySSA.h"
+
+namespace holodec {
+
+	class CallGraph;
+	struct Register;
+
+	//derives the parameter and return registers of a function from the uses of its inputs and the definitions reaching its returns
+	//calls use the registers the callee was inferred to read and change, the calling convention is only used for unknown callees
+	//so the functions have to be transformed callees first, functions of the same component use the calling convention for each other
+	class SSACallingConvInference : public SSATransformer {
+	public:
+		CallGraph* callgraph = nullptr;
+		//assumed for unknown callees when neither function has a calling convention
+		HString defaultConvention = "amd64";
+
+		SSARepresentation* ssaRep;
+		Function* function;
+		CallingConvention* cc;
+		Register* stackReg;
+		SSAMemorySSA memory;
+
+		HSet<HId> parameters;
+		HSet<HId> clobbered;
+		HSet<HId> returns;
+
+		virtual void doTransformation (Function* function);
+
+	private:
+		Function* getCallee (SSAExpression* callExpr);
+		//the inferred register states of the callee are used instead of its calling convention
+		bool hasSummary (Function* callee);
+		CallingConvention* getConvention (Function* callee);
+		bool calleeReads (Function* callee, HId regId);
+		bool calleeChanges (Function* callee, HId regId);
+		bool calleeReturns (Function* callee, HId regId);
+		bool isConventionReturn (CallingConvention* conv, HId regId);
+
+		bool isEntryValue (SSAArgument& arg, HId regId, HSet<HId>* visited);
+		bool keepArgument (SSAArgument& arg);
+
+		void calcStackAdjust();
+
+		void rewriteOutputs();
+		void pruneArguments();
+		void calcParameters();
+		void selectConvention();
+		void storeRegStates();
+	};
+
+}
+
+#endif // SSACALLINGCONVINFERENCE_H
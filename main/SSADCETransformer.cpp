@@ -5,12 +5,17 @@
 #include "Function.h"
 #include "Argument.h"
 #include "General.h"
+#include "Logger.h"
+#include "Profiler.h"
+
+#include <inttypes.h>
 
 namespace holodec {
 
 	void SSADCETransformer::doTransformation (Function* function) {
 
-		printf ("DCE for Function at Address 0x%llx\n", function->baseaddr);
+		H_PROFILE_SCOPE ("DCE");
+		H_LOG_DEBUG (eLogSSA, "DCE for Function at Address 0x%" PRIx64 "\n", function->baseaddr);
 		function->ssaRep.recalcRefCounts();
 		ssaRep = &function->ssaRep;
 		do {
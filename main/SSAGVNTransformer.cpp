@@ -0,0 +1,252 @@
+#include "SSAGVNTransformer.h"
+
+#include "SSA.h"
+#include "Function.h"
+#include "General.h"
+#include "Logger.h"
+#include "Profiler.h"
+
+#include <inttypes.h>
+#include <string.h>
+
+namespace holodec {
+
+	static uint64_t hashCombine (uint64_t hash, uint64_t value) {
+		return (hash ^ value) * 0x100000001b3ULL;
+	}
+	static bool isNumbered (SSAExprType type) {
+		switch (type) {
+		case SSAExprType::eOp:
+		case SSAExprType::eLoadAddr:
+		case SSAExprType::eFlag:
+		case SSAExprType::eExtend:
+		case SSAExprType::eSplit:
+		case SSAExprType::eAppend:
+		case SSAExprType::eCast:
+			return true;
+		default:
+			return false;
+		}
+	}
+	static bool isCommutative (SSAExpression* expr) {
+		if (expr->type != SSAExprType::eOp || expr->subExpressions.size() != 2)
+			return false;
+		switch (expr->opType) {
+		case SSAOpType::eAdd:
+		case SSAOpType::eMul:
+		case SSAOpType::eAnd:
+		case SSAOpType::eOr:
+		case SSAOpType::eXor:
+		case SSAOpType::eEq:
+		case SSAOpType::eNe:
+		case SSAOpType::eBAnd:
+		case SSAOpType::eBOr:
+		case SSAOpType::eBXor:
+			return true;
+		default:
+			return false;
+		}
+	}
+	static uint64_t getSubType (SSAExpression* expr) {
+		if (expr->type == SSAExprType::eOp)
+			return (uint64_t) expr->opType;
+		if (expr->type == SSAExprType::eFlag)
+			return (uint64_t) expr->flagType;
+		return 0;
+	}
+
+	void SSAGVNTransformer::calcDominators() {
+		HId maxBlockId = 0;
+		for (SSABB& bb : ssaRep->bbs)
+			maxBlockId = std::max (maxBlockId, bb.id);
+		idoms.assign (maxBlockId + 1, 0);
+		domChildren.clear();
+		if (!ssaRep->bbs.size())
+			return;
+
+		HId entryId = ssaRep->bbs.begin()->id;
+		HList<HId> order;
+		HList<size_t> orderIndex (maxBlockId + 1, (size_t) -1);
+		ssaRep->calcReversePostorder (&order);
+		for (size_t i = 0; i < order.size(); i++)
+			orderIndex[order[i]] = i;
+
+		//Cooper, Harvey, Kennedy: A Simple, Fast Dominance Algorithm
+		auto intersect = [this, &orderIndex] (HId lhs, HId rhs) {
+			while (lhs != rhs) {
+				while (orderIndex[lhs] > orderIndex[rhs])
+					lhs = idoms[lhs];
+				while (orderIndex[rhs] > orderIndex[lhs])
+					rhs = idoms[rhs];
+			}
+			return lhs;
+		};
+		idoms[entryId] = entryId;
+		bool changed = true;
+		while (changed) {
+			changed = false;
+			for (size_t i = 1; i < order.size(); i++) {
+				SSABB* bb = ssaRep->bbs.get (order[i]);
+				HId newIdom = 0;
+				for (HId predId : bb->inBlocks) {
+					if (predId > maxBlockId || !idoms[predId])
+						continue;
+					newIdom = newIdom ? intersect (predId, newIdom) : predId;
+				}
+				if (newIdom && idoms[bb->id] != newIdom) {
+					idoms[bb->id] = newIdom;
+					changed = true;
+				}
+			}
+		}
+		idoms[entryId] = 0;
+		for (size_t i = 1; i < order.size(); i++)
+			domChildren[idoms[order[i]]].push_back (order[i]);
+	}
+
+	HId SSAGVNTransformer::getLeader (HId id) {
+		if (id && id < leaders.size() && leaders[id])
+			return leaders[id];
+		return id;
+	}
+
+	uint64_t SSAGVNTransformer::hashArgument (SSAArgument& arg) {
+		uint64_t hash = hashCombine (0xcbf29ce484222325ULL, (uint64_t) arg.type);
+		hash = hashCombine (hash, arg.size);
+		switch (arg.type) {
+		case SSAArgType::eSInt:
+			return hashCombine (hash, (uint64_t) arg.sval);
+		case SSAArgType::eUInt:
+			return hashCombine (hash, arg.uval);
+		case SSAArgType::eFloat: {
+			uint64_t bits = 0;
+			memcpy (&bits, &arg.fval, std::min (sizeof (bits), sizeof (arg.fval)));
+			return hashCombine (hash, bits);
+		}
+		case SSAArgType::eId:
+			if (arg.ssaId)
+				return hashCombine (hash, getLeader (arg.ssaId));
+			//memory and block references have no ssa-id
+			hash = hashCombine (hash, (uint64_t) arg.location);
+			hash = hashCombine (hash, arg.locref.refId);
+			return hashCombine (hash, arg.locref.index);
+		default:
+			return hash;
+		}
+	}
+
+	uint64_t SSAGVNTransformer::hashExpression (SSAExpression* expr) {
+		uint64_t hash = hashCombine (0xcbf29ce484222325ULL, (uint64_t) expr->type);
+		hash = hashCombine (hash, getSubType (expr));
+		hash = hashCombine (hash, expr->size);
+		hash = hashCombine (hash, (uint64_t) expr->returntype);
+		if (isCommutative (expr))
+			return hashCombine (hash, hashArgument (expr->subExpressions[0]) + hashArgument (expr->subExpressions[1]));
+		for (SSAArgument& arg : expr->subExpressions)
+			hash = hashCombine (hash, hashArgument (arg));
+		return hash;
+	}
+
+	bool SSAGVNTransformer::isArgumentEqual (SSAArgument& lhs, SSAArgument& rhs) {
+		if (lhs.type != rhs.type || lhs.size != rhs.size)
+			return false;
+		switch (lhs.type) {
+		case SSAArgType::eSInt:
+			return lhs.sval == rhs.sval;
+		case SSAArgType::eUInt:
+			return lhs.uval == rhs.uval;
+		case SSAArgType::eFloat:
+			return lhs.fval == rhs.fval;
+		case SSAArgType::eId:
+			if (lhs.ssaId || rhs.ssaId)
+				return getLeader (lhs.ssaId) == getLeader (rhs.ssaId);
+			return lhs.location == rhs.location && lhs.locref == rhs.locref;
+		default:
+			//undefined values are never the same
+			return false;
+		}
+	}
+
+	//unlike operator== the location the value is stored in does not matter
+	bool SSAGVNTransformer::isValueEqual (SSAExpression* lhs, SSAExpression* rhs) {
+		if (lhs->type != rhs->type || getSubType (lhs) != getSubType (rhs) || lhs->size != rhs->size || lhs->returntype != rhs->returntype)
+			return false;
+		if (lhs->subExpressions.size() != rhs->subExpressions.size())
+			return false;
+		bool equal = true;
+		for (size_t i = 0; equal && i < lhs->subExpressions.size(); i++)
+			equal = isArgumentEqual (lhs->subExpressions[i], rhs->subExpressions[i]);
+		if (!equal && isCommutative (lhs))
+			equal = isArgumentEqual (lhs->subExpressions[0], rhs->subExpressions[1]) && isArgumentEqual (lhs->subExpressions[1], rhs->subExpressions[0]);
+		return equal;
+	}
+
+	void SSAGVNTransformer::visitBlock (HId blockId) {
+		size_t scopeStart = scopeKeys.size();
+		SSABB* bb = ssaRep->bbs.get (blockId);
+		for (HId id : bb->exprIds) {
+			SSAExpression* expr = &ssaRep->expressions[id];
+			if (!isNumbered (expr->type))
+				continue;
+			uint64_t hash = hashExpression (expr);
+			HList<HId>& bucket = table[hash];
+			HId leader = 0;
+			for (auto it = bucket.rbegin(); it != bucket.rend(); ++it) {
+				if (isValueEqual (expr, &ssaRep->expressions[*it])) {
+					leader = *it;
+					break;
+				}
+			}
+			if (leader) {
+				leaders[id] = leader;
+				replacements.insert (std::pair<HId, SSAArgument> (id, SSAArgument::create (leader, expr->size, expr->location, expr->locref)));
+			} else {
+				bucket.push_back (id);
+				scopeKeys.push_back (hash);
+			}
+		}
+		auto it = domChildren.find (blockId);
+		if (it != domChildren.end()) {
+			for (HId childId : it->second)
+				visitBlock (childId);
+		}
+		//values of this block are not visible in the siblings
+		while (scopeKeys.size() > scopeStart) {
+			auto bucketIt = table.find (scopeKeys.back());
+			bucketIt->second.pop_back();
+			if (bucketIt->second.empty())
+				table.erase (bucketIt);
+			scopeKeys.pop_back();
+		}
+	}
+
+	void SSAGVNTransformer::doTransformation (Function* function) {
+
+		H_PROFILE_SCOPE ("GVN");
+		H_LOG_DEBUG (eLogSSA, "GVN for Function at Address 0x%" PRIx64 "\n", function->baseaddr);
+
+		ssaRep = &function->ssaRep;
+		leaders.assign (ssaRep->expressions.size() + 1, 0);
+		table.clear();
+		scopeKeys.clear();
+		replacements.clear();
+
+		size_t exprCount = 0;
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (expr.id)
+				exprCount++;
+		}
+
+		calcDominators();
+		if (ssaRep->bbs.size())
+			visitBlock (ssaRep->bbs.begin()->id);
+
+		size_t merged = replacements.size();
+		if (!replacements.empty()) {
+			ssaRep->replaceNodes (&replacements);
+			ssaRep->compress();
+		}
+
+		H_LOG_DEBUG (eLogSSA, "GVN merged %zu of %zu Expressions (%.1f%%)\n", merged, exprCount, exprCount ? 100.0 * merged / exprCount : 0.0);
+	}
+}
@@ -0,0 +1,42 @@
+#ifndef SSAGVNTRANSFORMER_H
+#define SSAGVNTRANSFORMER_H
+
+#include "SSATransformer.h"
+
+namespace holodec {
+
+	//global value numbering over the dominator tree
+	//an expression that computes the same value as an expression in a dominating block is replaced by it
+	class SSAGVNTransformer : public SSATransformer {
+	public:
+		SSARepresentation* ssaRep;
+
+		//immediate dominator of every block, 0 for the entry and for blocks that are never reached
+		HList<HId> idoms;
+		HMap<HId, HList<HId>> domChildren;
+
+		//the expression that represents the value of every expression
+		HList<HId> leaders;
+		//hash -> expressions that are visible in the current dominator scope
+		HMap<uint64_t, HList<HId>> table;
+		HList<uint64_t> scopeKeys;
+
+		HMap<HId, SSAArgument> replacements;
+
+		virtual void doTransformation (Function* function);
+
+	private:
+		void calcDominators();
+
+		HId getLeader (HId id);
+		uint64_t hashArgument (SSAArgument& arg);
+		uint64_t hashExpression (SSAExpression* expr);
+		bool isArgumentEqual (SSAArgument& lhs, SSAArgument& rhs);
+		bool isValueEqual (SSAExpression* lhs, SSAExpression* rhs);
+
+		void visitBlock (HId blockId);
+	};
+
+}
+
+#endif // SSAGVNTRANSFORMER_H
@@ -1,11 +1,17 @@
 #include "SSAGen.h"
 #include "Architecture.h"
+#include "IRCondition.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include <inttypes.h>
 #include <assert.h>
 
 namespace holodec {
 
 	template IRArgument SSAGen::parseConstExpression (IRArgument argExpr, HList<IRArgument>* arglist);
 	template IRArgument SSAGen::parseConstExpression (IRArgument argExpr, HLocalBackedList<IRArgument, 4>* arglist);
+	template bool SSAGen::matchCondition (IRRepresentation* rep, HList<IRArgument>* arglist);
+	template bool SSAGen::matchCondition (IRRepresentation* rep, HLocalBackedList<IRArgument, 4>* arglist);
 
 
 
@@ -17,18 +23,8 @@ namespace holodec {
 
 		InstrDefinition* instrdef = instr->instrdef;
 		for (int i = 0; i < instrdef->irs.size(); i++) {
-			if (instr->operands.size() == instrdef->irs[i].argcount) {
-				IRArgument constArg = parseConstExpression (instrdef->irs[i].condExpr, &instr->operands);
-				if (constArg && constArg.type == IR_ARGTYPE_UINT && constArg.uval) {
-					if (instrdef->irs[i].condstring) {
-						printf ("Successfully parsed Condition for Instruction\n");
-						instrdef->irs[i].print (arch);
-						instr->print (arch);
-						printf ("\n");
-					}
-					return &instrdef->irs[i];
-				}
-			}
+			if (instr->operands.size() == instrdef->irs[i].argcount && matchCondition (&instrdef->irs[i], &instr->operands))
+				return &instrdef->irs[i];
 		}
 		for (int i = 0; i < instr->operands.size(); i++) {
 			instr->operands[i].print (arch);
@@ -39,6 +35,181 @@ namespace holodec {
 		return nullptr;
 	}
 
+	HId SSAGen::getLastOp() {
+		return ssaRepresentation && lastOp && lastOp <= ssaRepresentation->expressions.size() && ssaRepresentation->expressions[lastOp].type == SSAExprType::eOp ? lastOp : 0;
+	}
+	bool SSAGen::getTemplateKey (Instruction* instr, HList<uint64_t>* key) {
+		InstrDefinition* instrdef = instr->instrdef;
+		for (IRRepresentation& rep : instrdef->irs) {
+			//the key covers the types and sizes of the operands but not their values
+			if (rep.condstring && rep.condProgram.empty())
+				return false;
+			for (IRCondOp& op : rep.condProgram) {
+				if (op.type == IRCondOp::ePushArg)
+					return false;
+			}
+		}
+		key->push_back (instrdef->id);
+		key->push_back (getLastOp() != 0);
+		key->push_back (instr->operands.size());
+		for (size_t i = 0; i < instr->operands.size(); i++) {
+			IRArgument& arg = instr->operands[i];
+			key->push_back (arg.type);
+			key->push_back (arg.size);
+			switch (arg.type) {
+			case IR_ARGTYPE_SINT:
+			case IR_ARGTYPE_UINT:
+				break;
+			case IR_ARGTYPE_MEMOP:
+				key->push_back (arg.mem.segment);
+				key->push_back (arg.mem.base);
+				key->push_back (arg.mem.index);
+				key->push_back (arg.mem.scale);
+				break;
+			case IR_ARGTYPE_REG:
+			case IR_ARGTYPE_STACK:
+			case IR_ARGTYPE_MEM:
+				key->push_back (arg.ref.refId);
+				key->push_back (arg.ref.index);
+				break;
+			default:
+				return false;
+			}
+		}
+		return true;
+	}
+	bool SSAGen::recordTemplate (IRRepresentation* rep, Instruction* instr, SSATemplate* ssaTemplate) {
+		Function* savedFunction = function;
+		SSARepresentation* savedRepresentation = ssaRepresentation;
+		HId savedBlockId = activeBlockId;
+		HId savedLastOp = lastOp;
+		//the template has to match the key, a stale last operation is not looked at
+		HId lastOpBefore = getLastOp();
+
+		//expand the instruction with sentinels for the variable values into a scratch function
+		Instruction sentinelInstr = *instr;
+		sentinelInstr.addr = H_SSATEMPLATE_SENTINEL | ( (uint64_t) SSATemplateSlot::eAddr << 40);
+		for (size_t i = 0; i < sentinelInstr.operands.size(); i++) {
+			IRArgument& arg = sentinelInstr.operands[i];
+			if (arg.type == IR_ARGTYPE_SINT || arg.type == IR_ARGTYPE_UINT)
+				arg.uval = H_SSATEMPLATE_SENTINEL | ( (uint64_t) SSATemplateSlot::eOperand << 40) | (i << 8);
+			else if (arg.type == IR_ARGTYPE_MEMOP)
+				arg.mem.disp = H_SSATEMPLATE_SENTINEL | ( (uint64_t) SSATemplateSlot::eDisp << 40) | (i << 8);
+		}
+		Function scratch;
+		function = &scratch;
+		ssaRepresentation = &scratch.ssaRep;
+		activateBlock (createNewBlock());
+		HId blockId = activeBlockId;
+		//stands in for the last operation before the instruction which flags refer to
+		HId placeholder = 0;
+		if (lastOpBefore) {
+			SSAExpression expression;
+			expression.type = SSAExprType::eUndef;
+			expression.size = savedRepresentation->expressions[lastOpBefore].size;
+			placeholder = addExpression (&expression);
+		}
+		lastOp = placeholder;
+
+		setupForInstr();
+		instruction = &sentinelInstr;
+		for (size_t i = 0; i < sentinelInstr.operands.size(); i++) {
+			arguments.push_back (sentinelInstr.operands[i]);
+		}
+		evaluatedCondition = false;
+		parseExpression (rep->rootExpr);
+
+		ssaTemplate->valid = !evaluatedCondition && activeBlockId == blockId && scratch.ssaRep.bbs.size() == 1;
+		ssaTemplate->endOfBlock = endOfBlock;
+		ssaTemplate->fallthrough = fallthrough;
+		HMap<HId, uint32_t> localIndices;
+		for (HId id : getBlock (blockId)->exprIds) {
+			if (!ssaTemplate->valid)
+				break;
+			if (id == placeholder)
+				continue;
+			SSAExpression& expression = scratch.ssaRep.expressions[id];
+			//a sentinel that was used as a size can not be substituted
+			if (expression.size > 0xFFFF)
+				ssaTemplate->valid = false;
+			uint32_t exprIndex = ssaTemplate->expressions.size();
+			for (uint32_t j = 0; j < expression.subExpressions.size(); j++) {
+				SSAArgument& arg = expression.subExpressions[j];
+				if (arg.location == SSAExprLocation::eBlock || arg.size > 0xFFFF) {
+					ssaTemplate->valid = false;
+				} else if (arg.type == SSAArgType::eId && arg.ssaId) {
+					if (arg.ssaId == placeholder) {
+						ssaTemplate->slots.push_back ({SSATemplateSlot::eLastOp, exprIndex, j, 0, 0});
+					} else {
+						auto it = localIndices.find (arg.ssaId);
+						if (it != localIndices.end())
+							ssaTemplate->slots.push_back ({SSATemplateSlot::eLocal, exprIndex, j, it->second, 0});
+						else
+							ssaTemplate->valid = false;
+					}
+				} else if ( (arg.type == SSAArgType::eUInt || arg.type == SSAArgType::eSInt) && (arg.uval & H_SSATEMPLATE_SENTINEL_MASK) == H_SSATEMPLATE_SENTINEL) {
+					uint64_t kind = (arg.uval >> 40) & 0xFF;
+					uint32_t index = (arg.uval >> 8) & 0xFF;
+					if (kind == SSATemplateSlot::eOperand || kind == SSATemplateSlot::eDisp || kind == SSATemplateSlot::eAddr)
+						ssaTemplate->slots.push_back ({ (decltype (SSATemplateSlot::kind)) kind, exprIndex, j, index, arg.uval & 0xFF});
+					else
+						ssaTemplate->valid = false;
+				}
+			}
+			localIndices[id] = exprIndex;
+			ssaTemplate->expressions.push_back (expression);
+			//the references are counted again when the template is instantiated
+			ssaTemplate->expressions.back().refcount = 0;
+		}
+		if (!ssaTemplate->valid) {
+			ssaTemplate->expressions.clear();
+			ssaTemplate->slots.clear();
+		}
+
+		function = savedFunction;
+		ssaRepresentation = savedRepresentation;
+		activateBlock (savedBlockId);
+		lastOp = savedLastOp;
+		instruction = nullptr;
+		return ssaTemplate->valid;
+	}
+	void SSAGen::instantiateTemplate (SSATemplate* ssaTemplate) {
+		HId startLastOp = lastOp;
+		HList<HId> ids (ssaTemplate->expressions.size());
+		size_t slotIndex = 0;
+		for (size_t i = 0; i < ssaTemplate->expressions.size(); i++) {
+			SSAExpression expression = ssaTemplate->expressions[i];
+			for (; slotIndex < ssaTemplate->slots.size() && ssaTemplate->slots[slotIndex].exprIndex == i; slotIndex++) {
+				SSATemplateSlot& slot = ssaTemplate->slots[slotIndex];
+				SSAArgument& arg = expression.subExpressions[slot.argIndex];
+				switch (slot.kind) {
+				case SSATemplateSlot::eLocal:
+					arg.ssaId = ids[slot.index];
+					break;
+				case SSATemplateSlot::eLastOp:
+					arg.ssaId = startLastOp;
+					arg.size = ssaRepresentation->expressions[startLastOp].size;
+					break;
+				case SSATemplateSlot::eOperand:
+					arg.uval = arguments[slot.index].uval + slot.delta;
+					break;
+				case SSATemplateSlot::eDisp:
+					arg.uval = arguments[slot.index].mem.disp + slot.delta;
+					break;
+				case SSATemplateSlot::eAddr:
+					arg.uval = instruction->addr + slot.delta;
+					break;
+				}
+			}
+			if (expression.type == SSAExprType::eCall && expression.subExpressions[0].type == SSAArgType::eUInt) {
+				function->funcsCalled.push_back (expression.subExpressions[0].uval);
+			}
+			ids[i] = addExpression (&expression);
+		}
+		endOfBlock = ssaTemplate->endOfBlock;
+		fallthrough = ssaTemplate->fallthrough;
+	}
+
 	IRArgument SSAGen::parseMemArgToExpr (IRArgument mem) {
 		SSAExpression memexpr;
 		memexpr.type = SSAExprType::eLoadAddr;
@@ -69,13 +240,23 @@ namespace holodec {
 		return IRArgument::createSSAId (addExpression (&memexpr), arch->bitbase);
 	}
 
+	template<typename ARGLIST>
+	bool SSAGen::matchCondition (IRRepresentation* rep, ARGLIST* arglist) {
+		if (!rep->condProgram.empty())
+			return evaluateIRCondition (&rep->condProgram, arglist);
+		IRArgument constArg = parseConstExpression (rep->condExpr, arglist);
+		return constArg && constArg.type == IR_ARGTYPE_UINT && constArg.uval;
+	}
+
 	template<typename ARGLIST>
 	IRArgument SSAGen::parseConstExpression (IRArgument argExpr, ARGLIST* arglist) {
 		switch (argExpr.type) {
 		default:
 			return IRArgument::createVal ( (uint64_t) 1, arch->bitbase);
 		case IR_ARGTYPE_ARG: {
-			return (*arglist) [argExpr.ref.refId];
+			if (!argExpr.ref.refId || argExpr.ref.refId > arglist->size())
+				return IRArgument::create();
+			return (*arglist) [argExpr.ref.refId - 1];
 		}
 		case IR_ARGTYPE_ID: {
 			IRExpression* irExpr = arch->getIrExpr (argExpr.ref.refId);
@@ -84,7 +265,7 @@ namespace holodec {
 			case IR_EXPR_OP: {
 				switch (irExpr->mod.opType) {
 				case SSAOpType::eAnd: {
-					uint64_t val = 0;
+					uint64_t val = 1;
 					for (size_t i = 0; i < irExpr->subExpressions.size(); i++) {
 						IRArgument arg = parseConstExpression (irExpr->subExpressions[i], arglist);
 						if (arg.type == IR_ARGTYPE_UINT)
@@ -265,10 +446,14 @@ namespace holodec {
 	}
 	void SSAGen::reset() {
 		ssaRepresentation = nullptr;
+		lastOp = 0;
 	}
 	void SSAGen::setup (Function* function, uint64_t addr) {
 		this->function = function;
 		ssaRepresentation = &function->ssaRep;
+		//the inputs do not belong to an instruction, the last one may point to the previous function
+		instruction = nullptr;
+		lastOp = 0;
 		activateBlock (createNewBlock());
 		for (Register& reg : arch->registers) {
 			if (!reg.id || reg.directParentRef)
@@ -303,7 +488,7 @@ namespace holodec {
 					SSAExpression* expr = ssaRepresentation->expressions.get (*it);
 					assert (expr);
 					if (expr->type == SSAExprType::eLabel && expr->subExpressions.size() > 0 && expr->subExpressions[0].type == SSAArgType::eUInt && expr->subExpressions[0].uval == addr) {
-						printf ("Split SSA 0x%x\n", addr);
+						H_LOG_TRACE (eLogAnalysis, "Split SSA 0x%" PRIx64 "\n", addr);
 						HId oldId = bb.id;
 						HId newEndAddr = bb.endaddr;
 						bb.endaddr = addr;
@@ -392,11 +577,47 @@ namespace holodec {
 	}
 
 	bool SSAGen::parseInstruction (Instruction* instruction) {
+		H_PROFILE_TIMER ("SSAGen");
 		if (getActiveBlock()->startaddr > instruction->addr)
 			getActiveBlock()->startaddr = instruction->addr;
 
+		HList<uint64_t> key;
+		SSATemplate* ssaTemplate = nullptr;
+		if (useTemplates && getTemplateKey (instruction, &key)) {
+			auto it = templates.find (key);
+			if (it != templates.end())
+				ssaTemplate = &it->second;
+		} else {
+			key.clear();
+		}
+		if (ssaTemplate && ssaTemplate->valid) {
+			templateHits++;
+			H_PROFILE_COUNT (eProfileTemplateHits, 1);
+			setupForInstr();
+			this->instruction = instruction;
+			for (int i = 0; i < instruction->operands.size(); i++) {
+				arguments.push_back (instruction->operands[i]);
+			}
+			insertLabel (instruction->addr);
+			instantiateTemplate (ssaTemplate);
+			if (getActiveBlock()->endaddr < instruction->addr + instruction->size)
+				getActiveBlock()->endaddr = instruction->addr + instruction->size;
+			return true;
+		}
+
 		IRRepresentation* rep = matchIr (instruction);
 
+		if (rep && !key.empty() && !ssaTemplate) {
+			SSATemplate newTemplate;
+			if (recordTemplate (rep, instruction, &newTemplate))
+				templateMisses++;
+			else
+				templateUncacheable++;
+			templates.insert (std::make_pair (key, newTemplate));
+		} else if (rep && useTemplates) {
+			templateUncacheable++;
+		}
+
 		if (rep) {
 			setupForInstr();
 			this->instruction = instruction;
@@ -964,8 +1185,9 @@ namespace holodec {
 				int i;
 				for (i = 0; i < instrdef->irs.size(); i++) {
 					if (arguments.size() == instrdef->irs[i].argcount) {
-						IRArgument constArg = parseConstExpression (instrdef->irs[i].condExpr, &arguments);
-						if (constArg && constArg.type == IR_ARGTYPE_UINT && constArg.uval) {
+						if (instrdef->irs[i].condstring)
+							evaluatedCondition = true;
+						if (matchCondition (&instrdef->irs[i], &arguments)) {
 							parseExpression (instrdef->irs[i].rootExpr);
 							break;
 						}
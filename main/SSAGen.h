@@ -11,6 +11,33 @@ namespace holodec {
 		HId id;
 		IRArgument arg;
 	};
+
+	//values that differ between instructions of the same shape are recorded as sentinels and substituted on instantiation
+	//sentinel | kind << 40 | operand << 8 | delta
+#define H_SSATEMPLATE_SENTINEL (0x5e7e000000000000ULL)
+#define H_SSATEMPLATE_SENTINEL_MASK (0xFFFF000000000000ULL)
+
+	struct SSATemplateSlot {
+		enum {
+			eLocal = 0,//ssaId of an expression of the template
+			eLastOp,//ssaId of the last operation before the instruction
+			eOperand,//value of the operand + delta
+			eDisp,//displacement of the memory operand + delta
+			eAddr//address of the instruction + delta
+		} kind;
+		uint32_t exprIndex;
+		uint32_t argIndex;
+		uint32_t index;//local expression or operand
+		uint64_t delta;
+	};
+	//the ssa-expressions one instruction of a shape expands to
+	struct SSATemplate {
+		bool valid = false;
+		HList<SSAExpression> expressions;
+		HList<SSATemplateSlot> slots;
+		bool endOfBlock = false;
+		bool fallthrough = true;
+	};
 	
 	
 	struct SSAGen {
@@ -31,6 +58,16 @@ namespace holodec {
 
 		HList<SSATmpDef> tmpdefs;
 
+		//expansion templates keyed by instrdef and the kinds, sizes and registers of the operands
+		//kept across functions as they only depend on the architecture
+		bool useTemplates = true;
+		HMap<HList<uint64_t>, SSATemplate> templates;
+		size_t templateHits = 0;
+		size_t templateMisses = 0;
+		size_t templateUncacheable = 0;
+		//set when the expansion evaluated a condition that may depend on the value of an operand
+		bool evaluatedCondition = false;
+
 		SSAGen (Architecture* arch);
 		~SSAGen();
 
@@ -55,6 +92,15 @@ namespace holodec {
 
 		IRRepresentation* matchIr (Instruction* instr);
 
+		//the last operation if it is an expression of the function that is generated
+		HId getLastOp();
+		bool getTemplateKey (Instruction* instr, HList<uint64_t>* key);
+		bool recordTemplate (IRRepresentation* rep, Instruction* instr, SSATemplate* ssaTemplate);
+		void instantiateTemplate (SSATemplate* ssaTemplate);
+
+		//uses the compiled condition of the representation if there is one
+		template<typename ARGLIST>
+		bool matchCondition (IRRepresentation* rep, ARGLIST* arglist);
 		template<typename ARGLIST>
 		IRArgument parseConstExpression (IRArgument argExpr, ARGLIST* arglist);
 		
@@ -0,0 +1,526 @@
+#include "SSAMemorySSA.h"
+
+#include "SSA.h"
+#include "Function.h"
+#include "Architecture.h"
+#include "CallingConvention.h"
+#include "CallGraph.h"
+#include "Logger.h"
+#include "Profiler.h"
+
+#include <inttypes.h>
+
+//maximum number of memory accesses that are looked at for one load
+#define H_MEMSSA_WALK_BUDGET (1024)
+
+namespace holodec {
+
+	static bool getConstValue (SSAArgument& arg, int64_t* value) {
+		if (arg.type == SSAArgType::eUInt) {
+			*value = (int64_t) arg.uval;
+			return true;
+		} else if (arg.type == SSAArgType::eSInt) {
+			*value = arg.sval;
+			return true;
+		}
+		return false;
+	}
+	//loads and stores may have the memory they access as first argument
+	size_t SSAMemorySSA::getAddressIndex (SSAExpression* expr) {
+		if (!expr->subExpressions.empty() && expr->subExpressions[0].location == SSAExprLocation::eMem)
+			return 1;
+		return 0;
+	}
+	static bool isDerivation (SSAExprType type) {
+		switch (type) {
+		case SSAExprType::eOp:
+		case SSAExprType::eLoadAddr:
+		case SSAExprType::eSplit:
+		case SSAExprType::eExtend:
+		case SSAExprType::eAppend:
+		case SSAExprType::eUpdatePart:
+		case SSAExprType::eCast:
+		case SSAExprType::ePhi:
+		case SSAExprType::eAssign:
+			return true;
+		default:
+			return false;
+		}
+	}
+	bool SSAMemorySSA::isClobber (SSAExprType type) {
+		switch (type) {
+		case SSAExprType::eCall:
+		case SSAExprType::eSyscall:
+		case SSAExprType::eTrap:
+		case SSAExprType::eBuiltin:
+		case SSAExprType::eMemAccess:
+		case SSAExprType::ePush:
+		case SSAExprType::ePop:
+			return true;
+		default:
+			return false;
+		}
+	}
+	static bool isSameValue (SSAArgument& lhs, SSAArgument& rhs) {
+		if (lhs.type != rhs.type || lhs.size != rhs.size)
+			return false;
+		switch (lhs.type) {
+		case SSAArgType::eSInt:
+			return lhs.sval == rhs.sval;
+		case SSAArgType::eUInt:
+			return lhs.uval == rhs.uval;
+		case SSAArgType::eId:
+			return lhs.ssaId && lhs.ssaId == rhs.ssaId;
+		default:
+			return false;
+		}
+	}
+
+	bool SSAMemorySSA::isStackRegister (HId regId) {
+		if (stackRegs.find (regId) != stackRegs.end())
+			return true;
+		return stackRegs.find (arch->getRegister (regId)->parentRef.refId) != stackRegs.end();
+	}
+	bool SSAMemorySSA::isPreservedRegister (HId regId) {
+		if (preservedRegs.find (regId) != preservedRegs.end())
+			return true;
+		return preservedRegs.find (arch->getRegister (regId)->parentRef.refId) != preservedRegs.end();
+	}
+	bool SSAMemorySSA::isStackPointer (SSAExpression* expr) {
+		if (expr->type != SSAExprType::eInput || expr->location != SSAExprLocation::eReg)
+			return false;
+		return stackRegs.find (expr->locref.refId) != stackRegs.end();
+	}
+	Function* SSAMemorySSA::getCallee (SSAExpression* call) {
+		if (!callgraph || call->subExpressions.empty() || call->subExpressions[0].type != SSAArgType::eUInt)
+			return nullptr;
+		return callgraph->getFunction (call->subExpressions[0].uval);
+	}
+	bool SSAMemorySSA::hasSummary (Function* callee) {
+		return callgraph && callgraph->hasSummary (function, callee);
+	}
+	bool SSAMemorySSA::keepsRegister (SSAExpression* call, HId regId) {
+		Function* callee = getCallee (call);
+		if (hasSummary (callee)) {
+			RegisterState* state = callee->getRegisterState (regId);
+			return !state || ! (state->flags & RegisterUsedFlag::eWrite);
+		}
+		return isPreservedRegister (regId);
+	}
+	bool SSAMemorySSA::readsRegister (SSAExpression* call, HId regId) {
+		Function* callee = getCallee (call);
+		if (hasSummary (callee)) {
+			RegisterState* state = callee->getRegisterState (regId);
+			return state && (state->flags & RegisterUsedFlag::eRead);
+		}
+		return true;
+	}
+	//the argument of the call that passes the register an output of the call is written to
+	SSAArgument* SSAMemorySSA::getCallArgument (SSAExpression* output) {
+		if (output->location != SSAExprLocation::eReg || output->subExpressions.empty() || output->subExpressions[0].type != SSAArgType::eId || !output->subExpressions[0].ssaId)
+			return nullptr;
+		SSAExpression* call = &ssaRep->expressions[output->subExpressions[0].ssaId];
+		if (call->type != SSAExprType::eCall)
+			return nullptr;
+		for (SSAArgument& arg : call->subExpressions) {
+			if (arg.location == SSAExprLocation::eReg && arg.locref.refId == output->locref.refId)
+				return &arg;
+		}
+		return nullptr;
+	}
+
+	void SSAMemorySSA::calcStackDerived() {
+		stackDerived.assign (ssaRep->expressions.size() + 1, false);
+		bool changed = true;
+		while (changed) {
+			changed = false;
+			for (SSAExpression& expr : ssaRep->expressions) {
+				if (!expr.id || stackDerived[expr.id])
+					continue;
+				bool derived = isStackPointer (&expr);
+				if (!derived && expr.type == SSAExprType::eOutput) {
+					SSAArgument* arg = getCallArgument (&expr);
+					derived = arg && arg->type == SSAArgType::eId && arg->ssaId && stackDerived[arg->ssaId];
+				} else if (!derived && isDerivation (expr.type)) {
+					for (SSAArgument& arg : expr.subExpressions) {
+						if (arg.type == SSAArgType::eId && arg.ssaId && stackDerived[arg.ssaId]) {
+							derived = true;
+							break;
+						}
+					}
+				}
+				if (derived) {
+					stackDerived[expr.id] = true;
+					changed = true;
+				}
+			}
+		}
+	}
+
+	void SSAMemorySSA::calcStackEscapes() {
+		stackEscapes = false;
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (!expr.id || isDerivation (expr.type) || expr.type == SSAExprType::eFlag)
+				continue;
+			//jumps to a stack address do not give it away
+			if (EXPR_IS_CONTROLFLOW (expr.type) && expr.type != SSAExprType::eCall && expr.type != SSAExprType::eSyscall && expr.type != SSAExprType::eReturn)
+				continue;
+			for (size_t i = 0; i < expr.subExpressions.size(); i++) {
+				SSAArgument& arg = expr.subExpressions[i];
+				if (arg.type != SSAArgType::eId || !arg.ssaId || !stackDerived[arg.ssaId])
+					continue;
+				if ((expr.type == SSAExprType::eLoad || expr.type == SSAExprType::eStore) && i == getAddressIndex (&expr))
+					continue;
+				//the stackpointer and registers the callee has to keep are passed to calls and returned
+				if (arg.location == SSAExprLocation::eReg && (isStackRegister (arg.locref.refId) || isPreservedRegister (arg.locref.refId)))
+					continue;
+				if (expr.type == SSAExprType::eCall && arg.location == SSAExprLocation::eReg && (keepsRegister (&expr, arg.locref.refId) || !readsRegister (&expr, arg.locref.refId)))
+					continue;
+				stackEscapes = true;
+				return;
+			}
+		}
+	}
+
+	SSAMemLocation SSAMemorySSA::getBase (HId id, HSet<HId>* inProgress) {
+		auto it = bases.find (id);
+		if (it != bases.end())
+			return it->second;
+
+		SSAMemLocation location;
+		location.base = id;
+		location.offsetKnown = true;
+		location.isStack = stackDerived[id];
+		//a loop carried value is its own base
+		if (inProgress->find (id) != inProgress->end())
+			return location;
+		inProgress->insert (id);
+
+		auto argBase = [this, inProgress] (SSAArgument & arg, SSAMemLocation * result) {
+			int64_t value;
+			if (getConstValue (arg, &value)) {
+				result->base = 0;
+				result->offset = value;
+				result->offsetKnown = true;
+				result->isStack = false;
+				return true;
+			}
+			if (arg.type == SSAArgType::eId && arg.ssaId) {
+				*result = getBase (arg.ssaId, inProgress);
+				return true;
+			}
+			return false;
+		};
+
+		SSAExpression* expr = &ssaRep->expressions[id];
+		switch (expr->type) {
+		case SSAExprType::eOp: {
+			if ((expr->opType != SSAOpType::eAdd && expr->opType != SSAOpType::eSub) || expr->subExpressions.empty())
+				break;
+			//one value and constant offsets, a subtracted value is not an address
+			SSAMemLocation result;
+			int64_t offset = 0;
+			size_t valueCount = 0;
+			for (size_t i = 0; i < expr->subExpressions.size(); i++) {
+				SSAArgument& arg = expr->subExpressions[i];
+				int64_t value;
+				if (getConstValue (arg, &value)) {
+					offset += (expr->opType == SSAOpType::eSub && i) ? -value : value;
+				} else if (arg.type == SSAArgType::eId && arg.ssaId && (i == 0 || expr->opType == SSAOpType::eAdd)) {
+					valueCount++;
+					result = getBase (arg.ssaId, inProgress);
+				} else {
+					valueCount = 2;
+				}
+			}
+			if (valueCount != 1)
+				break;
+			result.offset += offset;
+			location = result;
+		}
+		break;
+		case SSAExprType::eLoadAddr: {
+			//segment::[base + index*scale + disp]
+			if (expr->subExpressions.size() != 5 || !expr->subExpressions[0].isValue (0))
+				break;
+			SSAMemLocation result;
+			int64_t index, scale, disp;
+			if (!argBase (expr->subExpressions[1], &result) || !getConstValue (expr->subExpressions[3], &scale) || !getConstValue (expr->subExpressions[4], &disp))
+				break;
+			if (getConstValue (expr->subExpressions[2], &index))
+				result.offset += index * scale;
+			else if (scale)
+				result.offsetKnown = false;
+			result.offset += disp;
+			location = result;
+		}
+		break;
+		case SSAExprType::eSplit:
+			if (expr->subExpressions.size() == 3 && expr->subExpressions[1].isValue (0))
+				argBase (expr->subExpressions[0], &location);
+			break;
+		case SSAExprType::eExtend:
+		case SSAExprType::eAssign:
+			if (expr->subExpressions.size() == 1)
+				argBase (expr->subExpressions[0], &location);
+			break;
+		case SSAExprType::eOutput: {
+			//preserved registers keep their value, the stackpointer is moved by the arguments the callee removes
+			SSAArgument* arg = getCallArgument (expr);
+			if (!arg)
+				break;
+			SSAExpression* call = &ssaRep->expressions[expr->subExpressions[0].ssaId];
+			bool isStack = isStackRegister (expr->locref.refId);
+			if ((!isStack && !keepsRegister (call, expr->locref.refId)) || !argBase (*arg, &location))
+				break;
+			if (isStack) {
+				Function* callee = getCallee (call);
+				if (hasSummary (callee) && callee->stackAdjustKnown)
+					location.offset += callee->stackAdjust;
+				else
+					location.offsetKnown = false;
+			}
+		}
+		break;
+		case SSAExprType::ePhi: {
+			bool first = true, equal = true;
+			SSAMemLocation result;
+			for (SSAArgument& arg : expr->subExpressions) {
+				SSAMemLocation argLocation;
+				if (!argBase (arg, &argLocation)) {
+					equal = false;
+					break;
+				}
+				if (first) {
+					result = argLocation;
+					first = false;
+				} else if (result.base != argLocation.base || result.offset != argLocation.offset || result.offsetKnown != argLocation.offsetKnown) {
+					equal = false;
+					break;
+				}
+			}
+			if (!first && equal)
+				location = result;
+		}
+		break;
+		default:
+			break;
+		}
+		location.isStack = stackDerived[id];
+		inProgress->erase (id);
+		bases[id] = location;
+		return location;
+	}
+
+	SSAMemLocation SSAMemorySSA::getLocation (SSAArgument& arg, uint64_t bitsize) {
+		SSAMemLocation location;
+		int64_t value;
+		if (getConstValue (arg, &value)) {
+			location.offset = value;
+			location.offsetKnown = true;
+		} else if (arg.type == SSAArgType::eId && arg.ssaId) {
+			HSet<HId> inProgress;
+			location = getBase (arg.ssaId, &inProgress);
+		}
+		location.size = bitsize && ! (bitsize % 8) ? bitsize / 8 : 0;
+		return location;
+	}
+
+	SSAAliasResult SSAMemorySSA::alias (SSAMemLocation& lhs, SSAMemLocation& rhs) {
+		if (lhs.isStack != rhs.isStack) {
+			//globals are never on the stack
+			SSAMemLocation& other = lhs.isStack ? rhs : lhs;
+			if (!stackEscapes || (!other.base && other.offsetKnown))
+				return SSAAliasResult::eNoAlias;
+			return SSAAliasResult::eMayAlias;
+		}
+		if (!lhs.offsetKnown || !rhs.offsetKnown || lhs.base != rhs.base || !lhs.size || !rhs.size)
+			return SSAAliasResult::eMayAlias;
+		if (lhs.offset == rhs.offset && lhs.size == rhs.size)
+			return SSAAliasResult::eMustAlias;
+		if (lhs.offset + (int64_t) lhs.size <= rhs.offset || rhs.offset + (int64_t) rhs.size <= lhs.offset)
+			return SSAAliasResult::eNoAlias;
+		return SSAAliasResult::eMayAlias;
+	}
+
+	SSAMemorySSA::WalkResult SSAMemorySSA::walk (SSAMemLocation& location, uint64_t bitsize, HId blockId, size_t end, HMap<HId, WalkResult>* visited, size_t* budget) {
+		auto accessIt = blockAccesses.find (blockId);
+		for (size_t i = end; accessIt != blockAccesses.end() && i > 0; i--) {
+			if (! (*budget)--)
+				return WalkResult();
+			HId id = accessIt->second[i - 1];
+			SSAExpression* expr = &ssaRep->expressions[id];
+			WalkResult result;
+			if (expr->type == SSAExprType::eStore) {
+				SSAAliasResult aliasResult = alias (location, locations[id]);
+				if (aliasResult == SSAAliasResult::eNoAlias)
+					continue;
+				size_t valueIndex = getAddressIndex (expr) + 1;
+				if (aliasResult == SSAAliasResult::eMustAlias && valueIndex < expr->subExpressions.size() && expr->subExpressions[valueIndex].size == bitsize) {
+					result.kind = WalkResult::eSource;
+					result.value = expr->subExpressions[valueIndex];
+				} else {
+					result.kind = WalkResult::eClobber;
+					result.clobber = id;
+				}
+				return result;
+			} else if (expr->type == SSAExprType::eLoad) {
+				//loads do not change memory, but an earlier load of the same location has the value already
+				if (expr->size == bitsize && alias (location, locations[id]) == SSAAliasResult::eMustAlias) {
+					result.kind = WalkResult::eSource;
+					result.value = SSAArgument::create (id, expr->size);
+					return result;
+				}
+				continue;
+			}
+			result.kind = WalkResult::eClobber;
+			result.clobber = id;
+			return result;
+		}
+
+		SSABB* bb = ssaRep->bbs.get (blockId);
+		WalkResult result;
+		if (!bb->inBlocks.size()) {
+			result.kind = WalkResult::eEntry;
+			return result;
+		}
+		bool first = true;
+		for (HId predId : bb->inBlocks) {
+			//a value from the previous iteration of a loop is not the value of this one
+			if (predId >= orderIndex.size() || orderIndex[predId] >= orderIndex[blockId])
+				return WalkResult();
+			WalkResult predResult;
+			auto it = visited->find (predId);
+			if (it != visited->end()) {
+				predResult = it->second;
+			} else {
+				auto predAccessIt = blockAccesses.find (predId);
+				predResult = walk (location, bitsize, predId, predAccessIt != blockAccesses.end() ? predAccessIt->second.size() : 0, visited, budget);
+				(*visited)[predId] = predResult;
+			}
+			if (bb->inBlocks.size() == 1)
+				return predResult;
+			//without memory phis only a value or a definition that is the same on all paths is known
+			if (predResult.kind == WalkResult::eUnknown)
+				return WalkResult();
+			if (first)
+				result = predResult;
+			else if (result.kind != predResult.kind)
+				return WalkResult();
+			else if (result.kind == WalkResult::eSource && !isSameValue (result.value, predResult.value))
+				return WalkResult();
+			else if (result.kind == WalkResult::eClobber && result.clobber != predResult.clobber)
+				return WalkResult();
+			first = false;
+		}
+		return result;
+	}
+
+	void SSAMemorySSA::analyze (Function* function) {
+		this->function = function;
+		ssaRep = &function->ssaRep;
+		stackRegs.clear();
+		preservedRegs.clear();
+		bases.clear();
+		locations.clear();
+		blockAccesses.clear();
+		clobbers.clear();
+
+		for (Stack& stack : arch->stacks) {
+			if (stack.type != StackType::eMemory)
+				continue;
+			Register* reg = arch->getRegister (stack.trackingReg);
+			if (reg->id)
+				stackRegs.insert (reg->id);
+		}
+		//registers the calling convention keeps over a call
+		//the callee is assumed to use the calling convention of this function like in the calling convention applier
+		CallingConvention* cc = arch->getCallingConvention (function->callingconvention);
+		if (cc) {
+			for (StringRef& regRef : cc->nonVolatileReg) {
+				Register* reg = arch->getRegister (regRef);
+				if (reg->id)
+					preservedRegs.insert (reg->id);
+			}
+		}
+		calcStackDerived();
+		calcStackEscapes();
+
+		HList<HId> order;
+		ssaRep->calcReversePostorder (&order);
+		HId maxBlockId = 0;
+		for (SSABB& bb : ssaRep->bbs)
+			maxBlockId = std::max (maxBlockId, bb.id);
+		orderIndex.assign (maxBlockId + 1, (size_t) -1);
+		for (size_t i = 0; i < order.size(); i++)
+			orderIndex[order[i]] = i;
+
+		for (SSABB& bb : ssaRep->bbs) {
+			for (HId id : bb.exprIds) {
+				SSAExpression* expr = &ssaRep->expressions[id];
+				if (expr->type == SSAExprType::eLoad || expr->type == SSAExprType::eStore) {
+					size_t index = getAddressIndex (expr);
+					if (index >= expr->subExpressions.size())
+						continue;
+					uint64_t bitsize = expr->type == SSAExprType::eLoad ? expr->size : (index + 1 < expr->subExpressions.size() ? expr->subExpressions[index + 1].size : 0);
+					locations[id] = getLocation (expr->subExpressions[index], bitsize);
+				} else if (!isClobber (expr->type)) {
+					continue;
+				}
+				blockAccesses[bb.id].push_back (id);
+			}
+		}
+	}
+
+	void SSAMemorySSA::doTransformation (Function* function) {
+
+		H_PROFILE_SCOPE ("MemorySSA");
+		H_LOG_DEBUG (eLogSSA, "Memory SSA for Function at Address 0x%" PRIx64 "\n", function->baseaddr);
+
+		forwarded = 0;
+		loadCount = 0;
+		analyze (function);
+
+		HMap<HId, SSAArgument> replacements;
+		for (auto& entry : blockAccesses) {
+			//unreachable blocks have no order
+			if (entry.first >= orderIndex.size() || orderIndex[entry.first] == (size_t) -1)
+				continue;
+			for (size_t i = 0; i < entry.second.size(); i++) {
+				SSAExpression* expr = &ssaRep->expressions[entry.second[i]];
+				if (expr->type != SSAExprType::eLoad || locations.find (expr->id) == locations.end())
+					continue;
+				loadCount++;
+				HMap<HId, WalkResult> visited;
+				size_t budget = H_MEMSSA_WALK_BUDGET;
+				WalkResult result = walk (locations[expr->id], expr->size, entry.first, i, &visited, &budget);
+				if (result.kind == WalkResult::eSource) {
+					SSAArgument arg = result.value;
+					arg.location = SSAExprLocation::eNone;
+					arg.locref = {0, 0};
+					replacements.insert (std::pair<HId, SSAArgument> (expr->id, arg));
+					forwarded++;
+					continue;
+				}
+				//a load whose definition is not known keeps the chain it has
+				if (result.kind == WalkResult::eUnknown)
+					continue;
+				HId clobber = result.kind == WalkResult::eClobber ? result.clobber : 0;
+				clobbers[expr->id] = clobber;
+				//the load only depends on the nearest access that may change its value
+				SSAArgument& memArg = expr->subExpressions[0];
+				if (memArg.location == SSAExprLocation::eMem && memArg.type == SSAArgType::eId && memArg.ssaId != clobber) {
+					ssaRep->changeRefCount (memArg.ssaId, -1);
+					memArg.ssaId = clobber;
+					ssaRep->changeRefCount (clobber, 1);
+				}
+			}
+		}
+		if (!replacements.empty()) {
+			ssaRep->replaceNodes (&replacements);
+			ssaRep->compress();
+		}
+
+		H_LOG_DEBUG (eLogSSA, "Memory SSA forwarded %zu of %zu Loads, Stack %s\n", forwarded, loadCount, stackEscapes ? "escapes" : "is local");
+	}
+}
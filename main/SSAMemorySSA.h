@@ -0,0 +1,101 @@
+#ifndef SSAMEMORYSSA_H
+#define SSAMEMORYSSA_H
+
+#include "SSATransformer.h"
+
+namespace holodec {
+
+	class CallGraph;
+
+	//address of a memory access as base + offset
+	//the base is the ssa-id the address is derived from, 0 for absolute addresses
+	struct SSAMemLocation {
+		HId base = 0;
+		int64_t offset = 0;
+		//in bytes, 0 if unknown
+		uint64_t size = 0;
+		bool offsetKnown = false;
+		//derived from the stackpointer at function entry
+		bool isStack = false;
+	};
+
+	enum class SSAAliasResult {
+		eNoAlias = 0,
+		eMayAlias,
+		eMustAlias
+	};
+
+	//partitions loads and stores by their address and walks the chain of memory accesses from every load to the access that defines its value
+	//stores with a must-alias address and earlier loads of the same location are forwarded to the load,
+	//accesses that cannot alias are skipped so the load only depends on the nearest store that may alias
+	class SSAMemorySSA : public SSATransformer {
+	public:
+		SSARepresentation* ssaRep;
+		Function* function = nullptr;
+		//finds the callees whose inferred register usage is used instead of the calling convention
+		CallGraph* callgraph = nullptr;
+
+		//registers that hold the stackpointer of memory backed stacks
+		HSet<HId> stackRegs;
+		//registers that have the same value before and after a call
+		HSet<HId> preservedRegs;
+		HMap<HId, SSAMemLocation> bases;
+		HList<bool> stackDerived;
+		//a stack address is stored or passed on, so accesses without a stack base may alias the stack
+		bool stackEscapes = false;
+		HList<size_t> orderIndex;
+
+		HMap<HId, SSAMemLocation> locations;
+		//memory accesses and expressions that clobber memory in order for every block
+		HMap<HId, HList<HId>> blockAccesses;
+		//memory definition every remaining load depends on, 0 for the memory at function entry
+		//loads whose definition is not known keep their memory argument and are not in it
+		HMap<HId, HId> clobbers;
+
+		size_t forwarded = 0;
+		size_t loadCount = 0;
+
+		virtual void doTransformation (Function* function);
+
+		//fills the locations and block accesses without changing the function
+		void analyze (Function* function);
+		bool hasSummary (Function* callee);
+		SSAAliasResult alias (SSAMemLocation& lhs, SSAMemLocation& rhs);
+		bool isStackRegister (HId regId);
+		bool isPreservedRegister (HId regId);
+		bool isStackPointer (SSAExpression* expr);
+		SSAArgument* getCallArgument (SSAExpression* output);
+		Function* getCallee (SSAExpression* call);
+		//the register has the same value after the call
+		bool keepsRegister (SSAExpression* call, HId regId);
+		//the callee may read the register
+		bool readsRegister (SSAExpression* call, HId regId);
+		SSAMemLocation getLocation (SSAArgument& arg, uint64_t bitsize);
+		//index of the address argument of a load or store
+		static size_t getAddressIndex (SSAExpression* expr);
+		//expressions that may read or write any memory
+		static bool isClobber (SSAExprType type);
+
+	private:
+		struct WalkResult {
+			enum {
+				eUnknown = 0,
+				eSource,
+				eClobber,
+				//no access on any path, the memory at function entry
+				eEntry
+			} kind = eUnknown;
+			SSAArgument value;
+			HId clobber = 0;
+		};
+
+		void calcStackDerived();
+		void calcStackEscapes();
+		SSAMemLocation getBase (HId id, HSet<HId>* inProgress);
+
+		WalkResult walk (SSAMemLocation& location, uint64_t bitsize, HId blockId, size_t end, HMap<HId, WalkResult>* visited, size_t* budget);
+	};
+
+}
+
+#endif // SSAMEMORYSSA_H
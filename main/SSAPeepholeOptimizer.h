@@ -29,6 +29,8 @@ namespace holodec {
 	
 	struct MatchContext{
 		std::vector<HId> expressionsMatched;
+		//expressions of the matches an executor was run on
+		std::vector<HId> expressionsChanged;
 	};
 	
 	//inherit: expr-type, size, write-location, instrAddress
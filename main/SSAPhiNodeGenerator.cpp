@@ -1,6 +1,9 @@
 #include "SSAPhiNodeGenerator.h"
 #include "Function.h"
 #include "Architecture.h"
+#include "Logger.h"
+#include "Profiler.h"
+#include <inttypes.h>
 #include <assert.h>
 
 namespace holodec {
@@ -178,7 +181,8 @@ namespace holodec {
 	void SSAPhiNodeGenerator::doTransformation (Function* function) {
 
 
-		printf ("Generating Phi-Nodes for Function at Address 0x%x\n", function->baseaddr);
+		H_PROFILE_SCOPE ("PhiNodes");
+		H_LOG_DEBUG (eLogSSA, "Generating Phi-Nodes for Function at Address 0x%" PRIx64 "\n", function->baseaddr);
 		this->function = function;
 		
 		for (SSABB& bb : function->ssaRep.bbs) {
@@ -209,7 +213,7 @@ namespace holodec {
 				Register* reg = arch->getRegister (regDef.regId);
 
 				if (!reg->id)
-					printf ("%d - %d %s\n", wrap.ssaBB->id, regDef.regId, reg->name.cstr());
+					H_LOG_TRACE (eLogSSA, "%d - %d %s\n", wrap.ssaBB->id, regDef.regId, reg->name.cstr());
 
 				//printf ("Searching Defs for Reg %s in Block %d\n", reg->name.cstr(), wrap.ssaBB->id);
 				for (HId inBlockId : wrap.ssaBB->inBlocks) {
@@ -230,6 +234,7 @@ namespace holodec {
 					phinode.subExpressions[i] = SSAArgument::createReg (reg, gatheredIds[i]);
 				}
 				HId exprId = function->ssaRep.addAtStart (&phinode, wrap.ssaBB);
+				H_PROFILE_COUNT (eProfilePhisInserted, 1);
 				bool needInOutput = true;
 				for (SSARegDef& def : wrap.outputs) {
 					if (def.parentId == reg->parentRef.refId) {
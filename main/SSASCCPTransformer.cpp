@@ -0,0 +1,597 @@
+#include "SSASCCPTransformer.h"
+
+#include "SSA.h"
+#include "Function.h"
+#include "Argument.h"
+#include "General.h"
+#include "Logger.h"
+#include "Profiler.h"
+
+#include <inttypes.h>
+
+namespace holodec {
+
+	static uint64_t sizeMask (uint64_t size) {
+		return (size == 0 || size >= 64) ? ~ (uint64_t) 0 : (( (uint64_t) 1 << size) - 1);
+	}
+	static int64_t signExtend (uint64_t value, uint64_t size) {
+		if (size == 0 || size >= 64)
+			return (int64_t) value;
+		uint64_t signbit = (uint64_t) 1 << (size - 1);
+		value &= sizeMask (size);
+		return (int64_t) ((value ^ signbit) - signbit);
+	}
+	static bool isJump (SSAExprType type) {
+		return type == SSAExprType::eJmp || type == SSAExprType::eCJmp || type == SSAExprType::eMultiBranch;
+	}
+
+	SSALatticeValue SSASCCPTransformer::getValue (SSAArgument& arg) {
+		switch (arg.type) {
+		case SSAArgType::eUInt:
+			return SSALatticeValue::constant (arg.uval & sizeMask (arg.size));
+		case SSAArgType::eSInt:
+			return SSALatticeValue::constant ((uint64_t) arg.sval & sizeMask (arg.size));
+		case SSAArgType::eId:
+			if (arg.ssaId && arg.ssaId < values.size())
+				return values[arg.ssaId];
+			return SSALatticeValue::bottom();
+		default:
+			return SSALatticeValue::bottom();
+		}
+	}
+
+	SSALatticeValue SSASCCPTransformer::evaluateOp (SSAExpression* expr) {
+		if (expr->returntype == SSAType::eFloat || expr->subExpressions.empty())
+			return SSALatticeValue::bottom();
+
+		HList<SSALatticeValue> args;
+		HList<uint64_t> sizes;
+		bool hasTop = false, hasBottom = false;
+		for (SSAArgument& arg : expr->subExpressions) {
+			SSALatticeValue value = getValue (arg);
+			if (value.isConst()) {
+				//a known value decides and, or, band and mul without looking at the other arguments
+				if ((expr->opType == SSAOpType::eAnd && !value.value) || (expr->opType == SSAOpType::eBAnd && !value.value) || (expr->opType == SSAOpType::eMul && !value.value))
+					return SSALatticeValue::constant (0);
+				if (expr->opType == SSAOpType::eOr && value.value)
+					return SSALatticeValue::constant (1);
+			}
+			hasTop = hasTop || value.state == SSALatticeValue::eTop;
+			hasBottom = hasBottom || value.state == SSALatticeValue::eBottom;
+			args.push_back (value);
+			sizes.push_back (arg.size ? arg.size : expr->size);
+		}
+		if (hasBottom)
+			return SSALatticeValue::bottom();
+		if (hasTop)
+			return SSALatticeValue::top();
+
+		bool isSigned = expr->returntype == SSAType::eInt;
+		uint64_t size = expr->size;
+		uint64_t result = args[0].value;
+		switch (expr->opType) {
+		case SSAOpType::eAdd:
+			for (size_t i = 1; i < args.size(); i++)
+				result += args[i].value;
+			break;
+		case SSAOpType::eSub:
+			for (size_t i = 1; i < args.size(); i++)
+				result -= args[i].value;
+			break;
+		case SSAOpType::eMul:
+			for (size_t i = 1; i < args.size(); i++)
+				result *= args[i].value;
+			break;
+		case SSAOpType::eDiv:
+		case SSAOpType::eMod:
+			for (size_t i = 1; i < args.size(); i++) {
+				if (!args[i].value)
+					return SSALatticeValue::bottom();
+				if (isSigned) {
+					int64_t lhs = signExtend (result, i == 1 ? sizes[0] : size), rhs = signExtend (args[i].value, sizes[i]);
+					if (rhs == -1 && lhs == INT64_MIN)
+						return SSALatticeValue::bottom();
+					result = (uint64_t) (expr->opType == SSAOpType::eDiv ? lhs / rhs : lhs % rhs);
+				} else {
+					result = expr->opType == SSAOpType::eDiv ? result / args[i].value : result % args[i].value;
+				}
+			}
+			break;
+		case SSAOpType::eAnd:
+		case SSAOpType::eOr:
+		case SSAOpType::eXor:
+			result = !!result;
+			for (size_t i = 1; i < args.size(); i++) {
+				if (expr->opType == SSAOpType::eAnd)
+					result = result && args[i].value;
+				else if (expr->opType == SSAOpType::eOr)
+					result = result || args[i].value;
+				else
+					result = result ^ !!args[i].value;
+			}
+			break;
+		case SSAOpType::eNot:
+			result = !result;
+			break;
+		case SSAOpType::eEq:
+		case SSAOpType::eNe:
+		case SSAOpType::eLower:
+		case SSAOpType::eLe:
+		case SSAOpType::eGreater:
+		case SSAOpType::eGe: {
+			if (args.size() != 2)
+				return SSALatticeValue::bottom();
+			uint64_t lhs = args[0].value, rhs = args[1].value;
+			switch (expr->opType) {
+			case SSAOpType::eEq:
+				result = lhs == rhs;
+				break;
+			case SSAOpType::eNe:
+				result = lhs != rhs;
+				break;
+			case SSAOpType::eLower:
+				result = lhs < rhs;
+				break;
+			case SSAOpType::eLe:
+				result = lhs <= rhs;
+				break;
+			case SSAOpType::eGreater:
+				result = lhs > rhs;
+				break;
+			default:
+				result = lhs >= rhs;
+				break;
+			}
+		}
+		break;
+		case SSAOpType::eBAnd:
+			for (size_t i = 1; i < args.size(); i++)
+				result &= args[i].value;
+			break;
+		case SSAOpType::eBOr:
+			for (size_t i = 1; i < args.size(); i++)
+				result |= args[i].value;
+			break;
+		case SSAOpType::eBXor:
+			for (size_t i = 1; i < args.size(); i++)
+				result ^= args[i].value;
+			break;
+		case SSAOpType::eBNot:
+			result = ~result;
+			break;
+		case SSAOpType::eShr:
+		case SSAOpType::eShl:
+		case SSAOpType::eSal:
+		case SSAOpType::eSar:
+		case SSAOpType::eRor:
+		case SSAOpType::eRol: {
+			if (args.size() != 2 || !size || size > 64)
+				return SSALatticeValue::bottom();
+			uint64_t value = args[0].value & sizeMask (size), shift = args[1].value;
+			switch (expr->opType) {
+			case SSAOpType::eShr:
+				result = shift >= size ? 0 : value >> shift;
+				break;
+			case SSAOpType::eShl:
+			case SSAOpType::eSal:
+				result = shift >= 64 ? 0 : value << shift;
+				break;
+			case SSAOpType::eSar:
+				result = (uint64_t) (signExtend (value, size) >> (shift >= size ? size - 1 : shift));
+				break;
+			case SSAOpType::eRor:
+				shift %= size;
+				result = shift ? (value >> shift) | (value << (size - shift)) : value;
+				break;
+			default:
+				shift %= size;
+				result = shift ? (value << shift) | (value >> (size - shift)) : value;
+				break;
+			}
+		}
+		break;
+		default:
+			return SSALatticeValue::bottom();
+		}
+		return SSALatticeValue::constant (result & sizeMask (size));
+	}
+
+	SSALatticeValue SSASCCPTransformer::evaluateFlag (SSAExpression* expr) {
+		if (expr->subExpressions.size() != 1 || expr->subExpressions[0].type != SSAArgType::eId || !expr->subExpressions[0].ssaId)
+			return SSALatticeValue::bottom();
+		SSAExpression* opExpr = &ssaRep->expressions[expr->subExpressions[0].ssaId];
+		SSALatticeValue opValue = getValue (expr->subExpressions[0]);
+		uint64_t size = opExpr->size;
+		if (!size || size > 64)
+			return SSALatticeValue::bottom();
+		uint64_t result = opValue.value;
+
+		switch (expr->flagType) {
+		case SSAFlagType::eZ:
+		case SSAFlagType::eS:
+		case SSAFlagType::eP:
+			if (!opValue.isConst())
+				return opValue;
+			if (expr->flagType == SSAFlagType::eZ)
+				return SSALatticeValue::constant (result == 0);
+			if (expr->flagType == SSAFlagType::eS)
+				return SSALatticeValue::constant ((result >> (size - 1)) & 1);
+			return SSALatticeValue::constant (! (__builtin_popcountll (result & 0xFF) & 1));
+		case SSAFlagType::eC:
+		case SSAFlagType::eO:
+		case SSAFlagType::eA: {
+			//only defined for the two argument forms of add and sub
+			if (opExpr->type != SSAExprType::eOp || (opExpr->opType != SSAOpType::eAdd && opExpr->opType != SSAOpType::eSub) || opExpr->subExpressions.size() != 2)
+				return SSALatticeValue::bottom();
+			SSALatticeValue lhs = getValue (opExpr->subExpressions[0]), rhs = getValue (opExpr->subExpressions[1]);
+			if (lhs.state == SSALatticeValue::eBottom || rhs.state == SSALatticeValue::eBottom)
+				return SSALatticeValue::bottom();
+			if (lhs.state == SSALatticeValue::eTop || rhs.state == SSALatticeValue::eTop)
+				return SSALatticeValue::top();
+			uint64_t a = lhs.value & sizeMask (size), b = rhs.value & sizeMask (size);
+			bool isAdd = opExpr->opType == SSAOpType::eAdd;
+			uint64_t r = (isAdd ? a + b : a - b) & sizeMask (size);
+			uint64_t signbit = (uint64_t) 1 << (size - 1);
+			if (expr->flagType == SSAFlagType::eC)
+				return SSALatticeValue::constant (isAdd ? r < a : a < b);
+			if (expr->flagType == SSAFlagType::eA)
+				return SSALatticeValue::constant (((a ^ b ^ r) >> 4) & 1);
+			if (isAdd)
+				return SSALatticeValue::constant (! ((a ^ b) & signbit) && ((a ^ r) & signbit));
+			return SSALatticeValue::constant (((a ^ b) & signbit) && ((a ^ r) & signbit));
+		}
+		default:
+			return SSALatticeValue::bottom();
+		}
+	}
+
+	SSALatticeValue SSASCCPTransformer::evaluate (SSAExpression* expr) {
+		switch (expr->type) {
+		case SSAExprType::eOp:
+			return evaluateOp (expr);
+		case SSAExprType::eFlag:
+			return evaluateFlag (expr);
+		case SSAExprType::eAssign:
+			if (expr->subExpressions.size() != 1)
+				return SSALatticeValue::bottom();
+			return getValue (expr->subExpressions[0]);
+		case SSAExprType::ePhi: {
+			//the arguments are not tied to edges, values that are never reached stay top and are skipped
+			SSALatticeValue result = SSALatticeValue::top();
+			for (SSAArgument& arg : expr->subExpressions) {
+				SSALatticeValue value = getValue (arg);
+				if (value.state == SSALatticeValue::eTop)
+					continue;
+				if (value.state == SSALatticeValue::eBottom)
+					return value;
+				if (result.state == SSALatticeValue::eTop)
+					result = value;
+				else if (result.value != value.value)
+					return SSALatticeValue::bottom();
+			}
+			return result;
+		}
+		case SSAExprType::eExtend: {
+			if (expr->subExpressions.size() != 1)
+				return SSALatticeValue::bottom();
+			SSALatticeValue value = getValue (expr->subExpressions[0]);
+			if (!value.isConst())
+				return value;
+			if (expr->returntype == SSAType::eInt)
+				return SSALatticeValue::constant ((uint64_t) signExtend (value.value, expr->subExpressions[0].size) & sizeMask (expr->size));
+			return SSALatticeValue::constant (value.value & sizeMask (expr->size));
+		}
+		case SSAExprType::eSplit: {
+			if (expr->subExpressions.size() != 3)
+				return SSALatticeValue::bottom();
+			SSALatticeValue value = getValue (expr->subExpressions[0]), offset = getValue (expr->subExpressions[1]), size = getValue (expr->subExpressions[2]);
+			if (value.state == SSALatticeValue::eBottom || offset.state == SSALatticeValue::eBottom || size.state == SSALatticeValue::eBottom)
+				return SSALatticeValue::bottom();
+			if (!value.isConst() || !offset.isConst() || !size.isConst())
+				return SSALatticeValue::top();
+			return SSALatticeValue::constant (offset.value >= 64 ? 0 : (value.value >> offset.value) & sizeMask (size.value));
+		}
+		case SSAExprType::eAppend: {
+			//the first argument holds the lowest bits
+			uint64_t result = 0, offset = 0;
+			bool hasTop = false;
+			for (SSAArgument& arg : expr->subExpressions) {
+				SSALatticeValue value = getValue (arg);
+				if (value.state == SSALatticeValue::eBottom || !arg.size || offset + arg.size > 64)
+					return SSALatticeValue::bottom();
+				hasTop = hasTop || value.state == SSALatticeValue::eTop;
+				result |= (value.value & sizeMask (arg.size)) << offset;
+				offset += arg.size;
+			}
+			if (hasTop)
+				return SSALatticeValue::top();
+			return SSALatticeValue::constant (result);
+		}
+		case SSAExprType::eLoadAddr: {
+			//segment, base, index, scale, displacement
+			if (expr->subExpressions.size() != 5)
+				return SSALatticeValue::bottom();
+			SSALatticeValue args[5];
+			bool hasTop = false;
+			for (size_t i = 0; i < 5; i++) {
+				args[i] = getValue (expr->subExpressions[i]);
+				if (args[i].state == SSALatticeValue::eBottom)
+					return SSALatticeValue::bottom();
+				hasTop = hasTop || args[i].state == SSALatticeValue::eTop;
+			}
+			if (hasTop)
+				return SSALatticeValue::top();
+			if (args[0].value)
+				return SSALatticeValue::bottom();
+			return SSALatticeValue::constant ((args[1].value + args[2].value * args[3].value + args[4].value) & sizeMask (expr->size));
+		}
+		default:
+			return SSALatticeValue::bottom();
+		}
+	}
+
+	void SSASCCPTransformer::setValue (HId id, SSALatticeValue value) {
+		SSALatticeValue& old = values[id];
+		if (old == value || old.state == SSALatticeValue::eBottom)
+			return;
+		//values only move down in the lattice
+		if (old.isConst() && value.state != SSALatticeValue::eBottom)
+			value = SSALatticeValue::bottom();
+		old = value;
+		auto it = users.find (id);
+		if (it != users.end())
+			exprWorklist.insert (exprWorklist.end(), it->second.begin(), it->second.end());
+	}
+
+	void SSASCCPTransformer::markExecutable (HId blockId) {
+		if (!blockId || blockId >= executable.size() || executable[blockId])
+			return;
+		executable[blockId] = true;
+		blockWorklist.push_back (blockId);
+	}
+	void SSASCCPTransformer::markTarget (SSABB* bb, SSAArgument& target) {
+		if (target.type == SSAArgType::eId && target.location == SSAExprLocation::eBlock) {
+			markExecutable (target.locref.refId);
+			return;
+		}
+		SSALatticeValue value = getValue (target);
+		if (value.state == SSALatticeValue::eTop)
+			return;
+		if (value.isConst()) {
+			for (SSABB& targetBB : ssaRep->bbs) {
+				if (targetBB.startaddr == value.value) {
+					markExecutable (targetBB.id);
+					return;
+				}
+			}
+		}
+		for (HId id : bb->outBlocks)
+			markExecutable (id);
+	}
+	bool SSASCCPTransformer::evaluateControl (SSABB* bb, SSAExpression* expr) {
+		switch (expr->type) {
+		case SSAExprType::eCJmp: {
+			if (expr->subExpressions.size() < 2)
+				return true;
+			SSALatticeValue cond = getValue (expr->subExpressions[0]);
+			if (cond.state == SSALatticeValue::eTop)
+				return false;
+			if (cond.state == SSALatticeValue::eBottom || cond.value)
+				markTarget (bb, expr->subExpressions[1]);
+			return cond.state == SSALatticeValue::eBottom || !cond.value;
+		}
+		case SSAExprType::eJmp:
+			if (!expr->subExpressions.empty())
+				markTarget (bb, expr->subExpressions[0]);
+			return false;
+		case SSAExprType::eMultiBranch: {
+			SSALatticeValue selector = expr->subExpressions.empty() ? SSALatticeValue::bottom() : getValue (expr->subExpressions[0]);
+			if (selector.state == SSALatticeValue::eTop)
+				return false;
+			if (selector.isConst()) {
+				for (size_t i = 1; i < expr->subExpressions.size(); i++) {
+					SSAArgument& target = expr->subExpressions[i];
+					if (target.type == SSAArgType::eId && target.location == SSAExprLocation::eBlock && ssaRep->bbs[target.locref.refId].startaddr == selector.value) {
+						markExecutable (target.locref.refId);
+						return false;
+					}
+				}
+			}
+			for (size_t i = 1; i < expr->subExpressions.size(); i++)
+				markTarget (bb, expr->subExpressions[i]);
+			return false;
+		}
+		case SSAExprType::eReturn:
+		case SSAExprType::eTrap:
+			return false;
+		default:
+			return true;
+		}
+	}
+
+	void SSASCCPTransformer::visitBlock (SSABB* bb) {
+		while (progress[bb->id] < bb->exprIds.size()) {
+			HId id = bb->exprIds[progress[bb->id]++];
+			SSAExpression* expr = &ssaRep->expressions[id];
+			if (EXPR_IS_CONTROLFLOW (expr->type)) {
+				setValue (id, SSALatticeValue::bottom());
+				if (!evaluateControl (bb, expr))
+					return;
+			} else {
+				setValue (id, evaluate (expr));
+			}
+		}
+		markExecutable (bb->fallthroughId);
+	}
+
+	void SSASCCPTransformer::visitExpression (HId id) {
+		std::pair<HId, size_t>& position = positions[id];
+		//expressions that were not reached yet are evaluated when their block gets there
+		if (!position.first || !executable[position.first] || position.second >= progress[position.first])
+			return;
+		SSABB* bb = &ssaRep->bbs[position.first];
+		SSAExpression* expr = &ssaRep->expressions[id];
+		if (isJump (expr->type)) {
+			if (evaluateControl (bb, expr) && progress[bb->id] == position.second + 1)
+				visitBlock (bb);
+		} else if (!EXPR_IS_CONTROLFLOW (expr->type)) {
+			setValue (id, evaluate (expr));
+		}
+	}
+
+	void SSASCCPTransformer::applyResults (Function* function) {
+		HSet<HId> toRemove;
+		HMap<HId, SSAArgument> replacements;
+		HList<std::pair<HId, HId>> deadEdges;
+
+		for (SSABB& bb : ssaRep->bbs) {
+			if (!executable[bb.id]) {
+				toRemove.insert (bb.exprIds.begin(), bb.exprIds.end());
+				for (HId id : bb.inBlocks)
+					deadEdges.push_back (std::make_pair (id, bb.id));
+				for (HId id : bb.outBlocks)
+					deadEdges.push_back (std::make_pair (bb.id, id));
+				bb.reachable = false;
+				unreachableBlocks++;
+				continue;
+			}
+			//the rest of a block after a jump that is always taken
+			toRemove.insert (bb.exprIds.begin() + progress[bb.id], bb.exprIds.end());
+
+			for (size_t i = 0; i < progress[bb.id]; i++) {
+				HId id = bb.exprIds[i];
+				SSAExpression& expr = ssaRep->expressions[id];
+				if (expr.type == SSAExprType::eCJmp && expr.subExpressions.size() >= 2) {
+					SSALatticeValue cond = getValue (expr.subExpressions[0]);
+					if (!cond.isConst())
+						continue;
+					SSAArgument& target = expr.subExpressions[1];
+					HId targetId = target.type == SSAArgType::eId && target.location == SSAExprLocation::eBlock ? target.locref.refId : 0;
+					if (cond.value) {
+						//always taken, the jump stopped the block so there is no fallthrough left
+						expr.type = SSAExprType::eJmp;
+						expr.subExpressions.erase (expr.subExpressions.begin());
+						if (bb.fallthroughId && bb.fallthroughId != targetId)
+							deadEdges.push_back (std::make_pair (bb.id, bb.fallthroughId));
+						bb.fallthroughId = 0;
+					} else {
+						toRemove.insert (id);
+						if (targetId && targetId != bb.fallthroughId)
+							deadEdges.push_back (std::make_pair (bb.id, targetId));
+					}
+					continue;
+				}
+				if (expr.type == SSAExprType::ePhi) {
+					HList<SSAArgument> args;
+					for (SSAArgument& arg : expr.subExpressions) {
+						if (getValue (arg).state != SSALatticeValue::eTop)
+							args.push_back (arg);
+					}
+					if (!args.empty() && args.size() != expr.subExpressions.size()) {
+						ssaRep->propagateRefCount (&expr, -1);
+						expr.subExpressions = args;
+						ssaRep->propagateRefCount (&expr, 1);
+					}
+				}
+				if (!values[id].isConst() || EXPR_HAS_SIDEEFFECT (expr.type))
+					continue;
+				SSAArgument arg;
+				if (expr.returntype == SSAType::eInt)
+					arg = SSAArgument::createVal (signExtend (values[id].value, expr.size), expr.size);
+				else
+					arg = SSAArgument::createVal (values[id].value, expr.size);
+				arg.location = expr.location;
+				arg.locref = expr.locref;
+				replacements.insert (std::pair<HId, SSAArgument> (id, arg));
+			}
+		}
+
+		auto removeId = [] (HUniqueList<HId>& list, HId id) {
+			for (auto it = list.begin(); it != list.end(); ++it) {
+				if (*it == id) {
+					list.erase (it);
+					return;
+				}
+			}
+		};
+		for (auto& edge : deadEdges) {
+			if (!edge.first || !edge.second)
+				continue;
+			SSABB* from = ssaRep->bbs.get (edge.first);
+			SSABB* to = ssaRep->bbs.get (edge.second);
+			if (!from || !to)
+				continue;
+			removeId (from->outBlocks, edge.second);
+			removeId (to->inBlocks, edge.first);
+			if (from->fallthroughId == edge.second)
+				from->fallthroughId = 0;
+		}
+
+		eliminated = toRemove.size();
+		for (auto& entry : replacements) {
+			if (toRemove.find (entry.first) == toRemove.end())
+				eliminated++;
+		}
+		if (!toRemove.empty())
+			ssaRep->removeNodes (&toRemove);
+		if (!replacements.empty())
+			ssaRep->replaceNodes (&replacements);
+		ssaRep->compress();
+	}
+
+	void SSASCCPTransformer::doTransformation (Function* function) {
+
+		H_PROFILE_SCOPE ("SCCP");
+		H_LOG_DEBUG (eLogSSA, "SCCP for Function at Address 0x%" PRIx64 "\n", function->baseaddr);
+
+		ssaRep = &function->ssaRep;
+		eliminated = 0;
+		unreachableBlocks = 0;
+		size_t exprCount = 0;
+
+		HId maxBlockId = 0;
+		for (SSABB& bb : ssaRep->bbs)
+			maxBlockId = std::max (maxBlockId, bb.id);
+		values.assign (ssaRep->expressions.size() + 1, SSALatticeValue::top());
+		positions.assign (ssaRep->expressions.size() + 1, std::make_pair ((HId) 0, (size_t) 0));
+		progress.assign (maxBlockId + 1, 0);
+		executable.assign (maxBlockId + 1, false);
+		users.clear();
+		blockWorklist.clear();
+		exprWorklist.clear();
+
+		for (SSABB& bb : ssaRep->bbs) {
+			for (size_t i = 0; i < bb.exprIds.size(); i++)
+				positions[bb.exprIds[i]] = std::make_pair (bb.id, i);
+		}
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (!expr.id)
+				continue;
+			exprCount++;
+			for (SSAArgument& arg : expr.subExpressions) {
+				if (arg.type == SSAArgType::eId && arg.ssaId)
+					users[arg.ssaId].push_back (expr.id);
+			}
+		}
+
+		//the first block is the entry of the function
+		if (ssaRep->bbs.size())
+			markExecutable (ssaRep->bbs.begin()->id);
+		while (!blockWorklist.empty() || !exprWorklist.empty()) {
+			while (!blockWorklist.empty()) {
+				HId blockId = blockWorklist.back();
+				blockWorklist.pop_back();
+				visitBlock (&ssaRep->bbs[blockId]);
+			}
+			if (!exprWorklist.empty()) {
+				HId id = exprWorklist.back();
+				exprWorklist.pop_back();
+				visitExpression (id);
+			}
+		}
+
+		applyResults (function);
+
+		H_LOG_DEBUG (eLogSSA, "SCCP eliminated %zu of %zu Expressions (%.1f%%), %zu unreachable Blocks\n", eliminated, exprCount, exprCount ? 100.0 * eliminated / exprCount : 0.0, unreachableBlocks);
+	}
+}
@@ -0,0 +1,78 @@
+#ifndef SSASCCPTRANSFORMER_H
+#define SSASCCPTRANSFORMER_H
+
+#include "SSATransformer.h"
+
+namespace holodec {
+
+	//value of an expression in the sparse conditional constant propagation
+	//top: not evaluated yet, const: always value, bottom: not constant
+	struct SSALatticeValue {
+		enum {
+			eTop = 0,
+			eConst,
+			eBottom
+		} state = eTop;
+		uint64_t value = 0;
+
+		static SSALatticeValue top() {
+			return {eTop, 0};
+		}
+		static SSALatticeValue constant (uint64_t value) {
+			return {eConst, value};
+		}
+		static SSALatticeValue bottom() {
+			return {eBottom, 0};
+		}
+		bool isConst() {
+			return state == eConst;
+		}
+		bool operator== (const SSALatticeValue& other) const {
+			return state == other.state && (state != eConst || value == other.value);
+		}
+		bool operator!= (const SSALatticeValue& other) const {
+			return ! (*this == other);
+		}
+	};
+
+	//folds constants over ops, extend, split, append, flags and phis and removes the blocks conditional jumps with constant conditions never reach
+	class SSASCCPTransformer : public SSATransformer {
+	public:
+		SSARepresentation* ssaRep;
+
+		HList<SSALatticeValue> values;
+		//block and index in the block of every expression
+		HList<std::pair<HId, size_t>> positions;
+		HMap<HId, HList<HId>> users;
+		//index of the next expression to evaluate in a block, blocks stop at jumps that are not known to fall through
+		HList<size_t> progress;
+		HList<bool> executable;
+
+		HList<HId> blockWorklist;
+		HList<HId> exprWorklist;
+
+		size_t eliminated = 0;
+		size_t unreachableBlocks = 0;
+
+		virtual void doTransformation (Function* function);
+
+	private:
+		SSALatticeValue getValue (SSAArgument& arg);
+		SSALatticeValue evaluate (SSAExpression* expr);
+		SSALatticeValue evaluateOp (SSAExpression* expr);
+		SSALatticeValue evaluateFlag (SSAExpression* expr);
+		void setValue (HId id, SSALatticeValue value);
+
+		void markExecutable (HId blockId);
+		void markTarget (SSABB* bb, SSAArgument& target);
+		//returns true if the expressions after expr are executed
+		bool evaluateControl (SSABB* bb, SSAExpression* expr);
+		void visitBlock (SSABB* bb);
+		void visitExpression (HId id);
+
+		void applyResults (Function* function);
+	};
+
+}
+
+#endif // SSASCCPTRANSFORMER_H
@@ -0,0 +1,344 @@
+#include "SSAStackFrameTransformer.h"
+
+#include "SSA.h"
+#include "Function.h"
+#include "Architecture.h"
+#include "Logger.h"
+#include "Profiler.h"
+
+#include <inttypes.h>
+#include <algorithm>
+
+namespace holodec {
+
+	bool SSAStackFrameTransformer::collectSlots() {
+		HMap<std::pair<int64_t, uint64_t>, size_t> slotIndices;
+		for (auto& entry : memory.locations) {
+			SSAMemLocation& location = entry.second;
+			if (!location.isStack)
+				continue;
+			stackAccesses++;
+			//an access the offset is not known of can be in every slot
+			if (location.base != frameBase || !location.offsetKnown || !location.size)
+				return false;
+			auto it = slotIndices.find (std::make_pair (location.offset, location.size));
+			if (it == slotIndices.end()) {
+				it = slotIndices.insert (std::make_pair (std::make_pair (location.offset, location.size), slots.size())).first;
+				SSAStackSlot slot;
+				slot.offset = location.offset;
+				slot.size = location.size;
+				slots.push_back (slot);
+			}
+			slots[it->second].accesses.push_back (entry.first);
+		}
+		std::sort (slots.begin(), slots.end(), [] (const SSAStackSlot & lhs, const SSAStackSlot & rhs) {
+			return lhs.offset < rhs.offset || (lhs.offset == rhs.offset && lhs.size < rhs.size);
+		});
+
+		int64_t wordsize = stack->wordbitsize / 8;
+		for (size_t i = 0; i < slots.size(); i++) {
+			for (HId id : slots[i].accesses)
+				accessSlots[id] = i;
+			//the return address is read by the return
+			if (slots[i].offset < wordsize && slots[i].offset + (int64_t) slots[i].size > 0)
+				slots[i].promoted = false;
+			//partially overlapping accesses stay in memory
+			for (size_t j = i + 1; j < slots.size() && slots[j].offset < slots[i].offset + (int64_t) slots[i].size; j++) {
+				slots[i].promoted = false;
+				slots[j].promoted = false;
+			}
+		}
+		return true;
+	}
+
+	void SSAStackFrameTransformer::markCallVisible() {
+		for (auto& entry : memory.blockAccesses) {
+			for (HId id : entry.second) {
+				SSAExpression* expr = &ssaRep->expressions[id];
+				if (!SSAMemorySSA::isClobber (expr->type))
+					continue;
+				bool known = false;
+				for (SSAArgument& arg : expr->subExpressions) {
+					if (arg.location != SSAExprLocation::eReg || !memory.isStackRegister (arg.locref.refId))
+						continue;
+					SSAMemLocation location = memory.getLocation (arg, 0);
+					if (location.base == frameBase && location.offsetKnown) {
+						clobberOffsets[id] = location.offset;
+						known = true;
+					}
+					break;
+				}
+				//the callee can read everything above its stackpointer, a callee that was already analyzed only reads up to the end it was inferred to read
+				Function* callee = expr->type == SSAExprType::eCall ? memory.getCallee (expr) : nullptr;
+				bool limited = known && memory.hasSummary (callee) && callee->stackReadEndKnown;
+				for (SSAStackSlot& slot : slots) {
+					if (!known || (slot.offset + (int64_t) slot.size > clobberOffsets[id] && (!limited || slot.offset < clobberOffsets[id] + callee->stackReadEnd)))
+						slot.callVisible = true;
+				}
+			}
+		}
+	}
+
+	bool SSAStackFrameTransformer::storeReachesCall (size_t slotIndex, HId blockId, size_t start) {
+		HSet<HId> visited;
+		HList<std::pair<HId, size_t>> worklist;
+		worklist.push_back (std::make_pair (blockId, start));
+		while (!worklist.empty()) {
+			std::pair<HId, size_t> entry = worklist.back();
+			worklist.pop_back();
+			bool overwritten = false;
+			auto accessIt = memory.blockAccesses.find (entry.first);
+			for (size_t i = entry.second; accessIt != memory.blockAccesses.end() && i < accessIt->second.size(); i++) {
+				HId id = accessIt->second[i];
+				SSAExpression* expr = &ssaRep->expressions[id];
+				if (expr->type == SSAExprType::eStore) {
+					auto slotIt = accessSlots.find (id);
+					if (slotIt != accessSlots.end() && slotIt->second == slotIndex) {
+						overwritten = true;
+						break;
+					}
+				} else if (SSAMemorySSA::isClobber (expr->type)) {
+					auto offsetIt = clobberOffsets.find (id);
+					if (offsetIt == clobberOffsets.end() || offsetIt->second <= slots[slotIndex].offset)
+						return true;
+				}
+			}
+			if (overwritten)
+				continue;
+			for (HId succId : ssaRep->bbs[entry.first].outBlocks) {
+				if (visited.insert (succId).second)
+					worklist.push_back (std::make_pair (succId, (size_t) 0));
+			}
+		}
+		return false;
+	}
+
+	SSAArgument SSAStackFrameTransformer::createEntryValue (size_t slotIndex) {
+		auto key = std::make_pair (slotIndex, (HId) 0);
+		auto it = entryValues.find (key);
+		if (it != entryValues.end())
+			return it->second;
+		//parameters are passed in the slots above the return address, locals are not initialized
+		SSAExpression expr;
+		expr.type = slots[slotIndex].offset > 0 ? SSAExprType::eInput : SSAExprType::eUndef;
+		expr.returntype = SSAType::eUInt;
+		expr.size = slots[slotIndex].size * 8;
+		expr.location = SSAExprLocation::eStack;
+		expr.locref = {stack->id, (HId) slotIndex};
+		HId id = ssaRep->addAtStart (&expr, &*ssaRep->bbs.begin());
+		SSAArgument arg = SSAArgument::createStck (expr.locref, expr.size, id);
+		entryValues[key] = arg;
+		return arg;
+	}
+
+	SSAArgument SSAStackFrameTransformer::readAtEnd (size_t slotIndex, HId blockId) {
+		auto it = blockDefs.find (std::make_pair (slotIndex, blockId));
+		if (it != blockDefs.end())
+			return it->second;
+		return readAtEntry (slotIndex, blockId);
+	}
+
+	SSAArgument SSAStackFrameTransformer::readAtEntry (size_t slotIndex, HId blockId) {
+		auto key = std::make_pair (slotIndex, blockId);
+		auto it = entryValues.find (key);
+		if (it != entryValues.end())
+			return it->second;
+
+		SSABB* bb = ssaRep->bbs.get (blockId);
+		SSAArgument value;
+		if (!bb->inBlocks.size()) {
+			value = createEntryValue (slotIndex);
+		} else if (bb->inBlocks.size() == 1 && bb->inBlocks[0] != blockId) {
+			value = readAtEnd (slotIndex, bb->inBlocks[0]);
+		} else {
+			//the phi is known before its arguments, so loops end at it
+			SSAExpression phi;
+			phi.type = SSAExprType::ePhi;
+			phi.returntype = SSAType::eUInt;
+			phi.size = slots[slotIndex].size * 8;
+			phi.location = SSAExprLocation::eStack;
+			phi.locref = {stack->id, (HId) slotIndex};
+			phi.instrAddr = bb->startaddr;
+			HId phiId = ssaRep->addAtStart (&phi, bb);
+			entryValues[key] = SSAArgument::createStck (phi.locref, phi.size, phiId);
+			HList<HId> predIds (bb->inBlocks.begin(), bb->inBlocks.end());
+			for (HId predId : predIds) {
+				SSAArgument arg = readAtEnd (slotIndex, predId);
+				ssaRep->expressions[phiId].subExpressions.push_back (arg);
+			}
+			value = removeTrivialPhi (phiId);
+		}
+		entryValues[key] = value;
+		return value;
+	}
+
+	SSAArgument SSAStackFrameTransformer::removeTrivialPhi (HId phiId) {
+		SSAExpression& phi = ssaRep->expressions[phiId];
+		SSAArgument same;
+		bool found = false;
+		for (SSAArgument& arg : phi.subExpressions) {
+			if (arg.ssaId == phiId || (found && arg.ssaId == same.ssaId))
+				continue;
+			if (found)
+				return SSAArgument::createStck (phi.locref, phi.size, phiId);
+			same = arg;
+			found = true;
+		}
+		//a phi that only references itself is in a loop that is never entered
+		if (!found)
+			return SSAArgument::createStck (phi.locref, phi.size, phiId);
+		replacements[phiId] = same;
+		return same;
+	}
+
+	HId SSAStackFrameTransformer::getMemoryDef (SSAExpression* expr) {
+		if (SSAMemorySSA::getAddressIndex (expr) && expr->subExpressions[0].type == SSAArgType::eId)
+			return expr->subExpressions[0].ssaId;
+		return 0;
+	}
+
+	void SSAStackFrameTransformer::relinkMemory() {
+		//accesses that still use memory depend on the definition a removed one was based on, which may be in another block
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (!expr.id || removedDefs.find (expr.id) != removedDefs.end())
+				continue;
+			for (SSAArgument& arg : expr.subExpressions) {
+				if (arg.location != SSAExprLocation::eMem || arg.type != SSAArgType::eId)
+					continue;
+				//the chain goes back to earlier definitions, the limit only guards against a broken one
+				for (size_t i = 0; i <= removedDefs.size(); i++) {
+					auto it = removedDefs.find (arg.ssaId);
+					if (it == removedDefs.end())
+						break;
+					arg.ssaId = it->second;
+				}
+			}
+		}
+	}
+
+	void SSAStackFrameTransformer::doTransformation (Function* function) {
+
+		H_PROFILE_SCOPE ("StackFrame");
+		H_LOG_DEBUG (eLogSSA, "Stack Frame for Function at Address 0x%" PRIx64 "\n", function->baseaddr);
+
+		ssaRep = &function->ssaRep;
+		stack = nullptr;
+		frameBase = 0;
+		slots.clear();
+		accessSlots.clear();
+		clobberOffsets.clear();
+		blockDefs.clear();
+		entryValues.clear();
+		replacements.clear();
+		removedDefs.clear();
+		rewritten = 0;
+		stackAccesses = 0;
+
+		memory.arch = arch;
+		memory.callgraph = callgraph;
+		memory.analyze (function);
+
+		for (SSAExpression& expr : ssaRep->expressions) {
+			if (expr.id && memory.isStackPointer (&expr)) {
+				frameBase = expr.id;
+				for (Stack& arcStack : arch->stacks) {
+					if (arcStack.type == StackType::eMemory && arch->getRegister (arcStack.trackingReg)->id == expr.locref.refId)
+						stack = &arcStack;
+				}
+				break;
+			}
+		}
+		if (!frameBase || !stack)
+			return;
+		if (memory.stackEscapes) {
+			H_LOG_DEBUG (eLogSSA, "Stack Frame escapes, no Slots promoted\n");
+			return;
+		}
+		if (!collectSlots()) {
+			H_LOG_DEBUG (eLogSSA, "Stack Frame has Accesses with unknown Offsets, no Slots promoted\n");
+			return;
+		}
+		markCallVisible();
+
+		//stores become definitions of the slot
+		HMap<HId, size_t> defSlots;
+		for (SSABB& bb : ssaRep->bbs) {
+			auto accessIt = memory.blockAccesses.find (bb.id);
+			for (size_t i = 0; i < bb.exprIds.size(); i++) {
+				HId id = bb.exprIds[i];
+				auto slotIt = accessSlots.find (id);
+				if (slotIt == accessSlots.end() || !slots[slotIt->second].promoted || ssaRep->expressions[id].type != SSAExprType::eStore)
+					continue;
+				size_t slotIndex = slotIt->second;
+				SSAExpression* expr = &ssaRep->expressions[id];
+				size_t valueIndex = SSAMemorySSA::getAddressIndex (expr) + 1;
+				if (valueIndex >= expr->subExpressions.size())
+					continue;
+
+				SSAExpression def;
+				def.type = SSAExprType::eAssign;
+				def.returntype = SSAType::eUInt;
+				def.size = slots[slotIndex].size * 8;
+				def.location = SSAExprLocation::eStack;
+				def.locref = {stack->id, (HId) slotIndex};
+				def.instrAddr = expr->instrAddr;
+				def.subExpressions = {expr->subExpressions[valueIndex]};
+
+				size_t accessIndex = std::find (accessIt->second.begin(), accessIt->second.end(), id) - accessIt->second.begin();
+				HId defId;
+				if (slots[slotIndex].callVisible && storeReachesCall (slotIndex, bb.id, accessIndex + 1)) {
+					//the callee may read the value from memory
+					auto it = ssaRep->addAfter (&def, bb.exprIds, bb.exprIds.begin() + i);
+					defId = *it;
+					i++;
+				} else {
+					removedDefs[id] = getMemoryDef (expr);
+					ssaRep->propagateRefCount (expr, -1);
+					def.id = id;
+					def.refcount = expr->refcount;
+					*expr = def;
+					ssaRep->propagateRefCount (expr, 1);
+					defId = id;
+				}
+				defSlots[defId] = slotIndex;
+				blockDefs[std::make_pair (slotIndex, bb.id)] = SSAArgument::createStck (def.locref, def.size, defId);
+				rewritten++;
+			}
+		}
+
+		//loads read the definition that reaches them
+		for (SSABB& bb : ssaRep->bbs) {
+			HMap<size_t, SSAArgument> currentDefs;
+			//phis may be added to the start of the block while reading
+			HList<HId> exprIds = bb.exprIds;
+			for (HId id : exprIds) {
+				auto defIt = defSlots.find (id);
+				if (defIt != defSlots.end()) {
+					currentDefs[defIt->second] = SSAArgument::createStck ({stack->id, (HId) defIt->second}, slots[defIt->second].size * 8, id);
+					continue;
+				}
+				auto slotIt = accessSlots.find (id);
+				if (slotIt == accessSlots.end() || !slots[slotIt->second].promoted || ssaRep->expressions[id].type != SSAExprType::eLoad)
+					continue;
+				auto currentIt = currentDefs.find (slotIt->second);
+				SSAArgument value = currentIt != currentDefs.end() ? currentIt->second : readAtEntry (slotIt->second, bb.id);
+				replacements[id] = value;
+				removedDefs[id] = getMemoryDef (&ssaRep->expressions[id]);
+				rewritten++;
+			}
+		}
+
+		size_t promoted = 0;
+		for (SSAStackSlot& slot : slots) {
+			if (slot.promoted)
+				promoted++;
+		}
+		relinkMemory();
+		if (!replacements.empty())
+			ssaRep->replaceNodes (&replacements);
+		ssaRep->compress();
+		ssaRep->recalcRefCounts();
+
+		H_LOG_DEBUG (eLogSSA, "Stack Frame promoted %zu of %zu Slots, rewrote %zu of %zu Stack Accesses\n", promoted, slots.size(), rewritten, stackAccesses);
+	}
+}
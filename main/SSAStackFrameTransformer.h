@@ -0,0 +1,63 @@
+#ifndef SSASTACKFRAMETRANSFORMER_H
+#define SSASTACKFRAMETRANSFORMER_H
+
+#include "SSATransformer.h"
+#include "SSAMemorySSA.h"
+
+namespace holodec {
+
+	//a part of the stack frame relative to the stackpointer at function entry
+	//negative offsets are locals, positive offsets are parameters passed on the stack
+	struct SSAStackSlot {
+		int64_t offset;
+		//in bytes
+		uint64_t size;
+		bool promoted = true;
+		//a call can see the slot, so stores to it stay in memory as well
+		bool callVisible = false;
+		HList<HId> accesses;
+	};
+
+	//rewrites loads and stores of stack slots whose address does not escape into ssa-values with a stack location
+	class SSAStackFrameTransformer : public SSATransformer {
+	public:
+		SSARepresentation* ssaRep;
+		SSAMemorySSA memory;
+		CallGraph* callgraph = nullptr;
+
+		Stack* stack = nullptr;
+		HId frameBase = 0;
+		HList<SSAStackSlot> slots;
+		HMap<HId, size_t> accessSlots;
+		//stack pointer offsets of the expressions that clobber memory, unknown offsets are not in the map
+		HMap<HId, int64_t> clobberOffsets;
+
+		//last definition of a slot in a block and the value of a slot at the start of a block
+		HMap<std::pair<size_t, HId>, SSAArgument> blockDefs;
+		HMap<std::pair<size_t, HId>, SSAArgument> entryValues;
+		HMap<HId, SSAArgument> replacements;
+		//promoted loads and stores that no longer define memory -> the memory definition they were based on
+		HMap<HId, HId> removedDefs;
+
+		size_t rewritten = 0;
+		size_t stackAccesses = 0;
+
+		virtual void doTransformation (Function* function);
+
+	private:
+		bool collectSlots();
+		void markCallVisible();
+		bool storeReachesCall (size_t slotIndex, HId blockId, size_t start);
+
+		SSAArgument createEntryValue (size_t slotIndex);
+		SSAArgument readAtEntry (size_t slotIndex, HId blockId);
+		SSAArgument readAtEnd (size_t slotIndex, HId blockId);
+		SSAArgument removeTrivialPhi (HId phiId);
+		//the memory argument of a load or store, 0 for the memory at function entry
+		HId getMemoryDef (SSAExpression* expr);
+		void relinkMemory();
+	};
+
+}
+
+#endif // SSASTACKFRAMETRANSFORMER_H
@@ -2,10 +2,12 @@
 #include "Function.h"
 #include "Architecture.h"
 #include "SSA.h"
+#include "Profiler.h"
 
 namespace holodec {
 
 	void SSATransformParser::doTransformation (Function* function) {
+		H_PROFILE_SCOPE ("TransformParser");
 		this->function = function;
 
 		for (SSABB& bb : function->ssaRep.bbs) {
@@ -12,6 +12,8 @@ namespace holodec {
 	struct SSATransformer {
 		Architecture* arch;
 
+		virtual ~SSATransformer() {}
+
 		virtual void doTransformation (Function* function) = 0;
 	};
 
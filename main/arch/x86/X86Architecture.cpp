@@ -7,16 +7,11 @@ using namespace holodec;
 
 holox86::Architecture holox86::x86architecture {"x86", "x86", 64, 8, {
 		[] (Binary * binary) {
-			static FunctionAnalyzer* analyzer = nullptr;
-			if (analyzer == nullptr) {
-				printf ("Create New Object\n");
-				analyzer = new holox86::X86FunctionAnalyzer (&holox86::x86architecture);
-			}
-			if (analyzer->canAnalyze (binary)) {
-				FunctionAnalyzer* temp = analyzer;
-				analyzer = nullptr;
-				return temp;
-			}
+			//every binary gets its own analyzer, it is deleted by the caller
+			FunctionAnalyzer* analyzer = new holox86::X86FunctionAnalyzer (&holox86::x86architecture);
+			if (analyzer->canAnalyze (binary))
+				return analyzer;
+			delete analyzer;
 			return (FunctionAnalyzer*) nullptr;
 		}
 	},
@@ -865,4 +860,6 @@ holox86::Architecture holox86::x86architecture {"x86", "x86", 64, 8, {
 //TODO add missing instructions
 
 	},
+	{},//irExpressions
+	&holox86::x86irtables
 };
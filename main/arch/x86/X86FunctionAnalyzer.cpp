@@ -6,6 +6,9 @@
 #include "Architecture.h"
 #include "HString.h"
 #include "Binary.h"
+#include "X86FunctionScanner.h"
+#include "Logger.h"
+#include "Profiler.h"
 
 
 #define CODE "\x55\x48\x8b\x05\xb8\x13\x00\x00"
@@ -52,19 +55,73 @@ bool holox86::X86FunctionAnalyzer::terminate() {
 
 void analyzeInstruction (Instruction* instr, size_t addr, cs_insn *insn);
 
+void holox86::X86FunctionAnalyzer::scanFunctionStarts (HSet<uint64_t>* addresses) {
+	x86ScanFunctionStarts (binary, addresses);
+}
+
+void holox86::X86FunctionAnalyzer::preAnalysis() {
+	//walk the cfg with the pre-decoder so blocks are cut at their final boundaries while lifting
+	leaders.clear();
+	HSet<uint64_t> visited;
+	HList<uint64_t> worklist (state.function->addrToAnalyze.begin(), state.function->addrToAnalyze.end());
+	while (!worklist.empty()) {
+		uint64_t addr = worklist.back();
+		worklist.pop_back();
+		if (!visited.insert (addr).second)
+			continue;
+		uint8_t* ptr = binary->getVDataPtr (addr);
+		size_t size = binary->getVDataSize (addr);
+		for (size_t offset = 0; ptr && offset < size;) {
+			X86PreDecoded predecoded;
+			if (!x86PreDecode (ptr + offset, size - offset, addr + offset, &predecoded))
+				break;
+			offset += predecoded.length;
+			if (predecoded.flow == X86Flow::eJmp || predecoded.flow == X86Flow::eCJmp) {
+				leaders.insert (predecoded.target);
+				worklist.push_back (predecoded.target);
+			}
+			if (predecoded.flow == X86Flow::eCJmp) {
+				leaders.insert (addr + offset);
+				worklist.push_back (addr + offset);
+			}
+			if (x86FlowEndsBlock (predecoded.flow) || visited.find (addr + offset) != visited.end())
+				break;
+		}
+	}
+}
+
 bool holox86::X86FunctionAnalyzer::analyzeInsts (size_t addr) {
 	cs_insn *insn;
 	size_t count;
 
-	size_t size = binary->getVDataSize (addr);
-	size = size > 100 ? 100 : size;
-
 	bool running = true;
 
 	Instruction instruction;
 	do {
-		prepareBuffer (addr);
-		count = cs_disasm (handle, state.dataBuffer, state.bufferSize, addr, state.maxInstr, &insn);
+		//only hand the instructions up to the end of the block to capstone
+		size_t runsize = 0, runcount = 0;
+		bool reachedLeader = false;
+		{
+			H_PROFILE_TIMER ("Decode");
+			prepareBuffer (addr);
+			while (runsize < state.bufferSize) {
+				X86PreDecoded predecoded;
+				if (!x86PreDecode (state.dataBuffer + runsize, state.bufferSize - runsize, addr + runsize, &predecoded))
+					break;
+				runsize += predecoded.length;
+				runcount++;
+				if (x86FlowEndsBlock (predecoded.flow))
+					break;
+				if (leaders.find (addr + runsize) != leaders.end()) {
+					reachedLeader = true;
+					break;
+				}
+			}
+			if (runcount)
+				count = cs_disasm (handle, state.dataBuffer, runsize, addr, runcount, &insn);
+			else//let capstone decide on instructions the pre-decoder does not know
+				count = cs_disasm (handle, state.dataBuffer, state.bufferSize, addr, 1, &insn);
+		}
 		if (count > 0) {
 			for (size_t i = 0; i < count; i++) {
 				memset (&instruction, 0, sizeof (Instruction));
@@ -92,8 +149,12 @@ bool holox86::X86FunctionAnalyzer::analyzeInsts (size_t addr) {
 			}
 
 			cs_free (insn, count);
+			if (running && reachedLeader && count == runcount) {
+				addAddressToAnalyze (addr);
+				running = false;
+			}
 		} else {
-			printf ("ERROR:: Failed to disassemble given code at address : 0x%x!\n", addr);
+			H_LOG_ERROR (eLogAnalysis, "Failed to disassemble given code at address : 0x%" PRIx64 "!\n", addr);
 			running = false;
 			return false;
 		}
@@ -101,6 +162,49 @@ bool holox86::X86FunctionAnalyzer::analyzeInsts (size_t addr) {
 	return true;
 }
 
+static void verifyPreDecoderSection (csh handle, holodec::Binary* binary, holodec::Section* section, size_t* checked, size_t* mismatches) {
+	for (holodec::Section* subsection : section->subsections)
+		verifyPreDecoderSection (handle, binary, subsection, checked, mismatches);
+	if (!section->subsections.empty() || ! (section->srwx & 0x4))
+		return;
+
+	uint8_t* ptr = section->getPtr<uint8_t> (binary->getData(), 0);
+	size_t offset = 0;
+	while (offset < section->size) {
+		cs_insn *insn;
+		size_t count = cs_disasm (handle, ptr + offset, section->size - offset, section->vaddr + offset, 256, &insn);
+		for (size_t i = 0; i < count; i++) {
+			size_t instroffset = insn[i].address - section->vaddr;
+			holox86::X86PreDecoded predecoded;
+			bool valid = holox86::x86PreDecode (ptr + instroffset, section->size - instroffset, insn[i].address, &predecoded);
+			bool match = valid && predecoded.length == insn[i].size;
+			if (match && predecoded.target) {
+				cs_x86& x86 = insn[i].detail->x86;
+				match = x86.op_count == 1 && x86.operands[0].type == X86_OP_IMM && (uint64_t) x86.operands[0].imm == predecoded.target;
+			}
+			if (!match) {
+				printf ("Pre-Decoder mismatch at 0x%" PRIx64 " %s %s: length %d capstone %d\n", insn[i].address, insn[i].mnemonic, insn[i].op_str, predecoded.length, insn[i].size);
+				(*mismatches)++;
+			}
+			(*checked)++;
+			offset = instroffset + insn[i].size;
+		}
+		if (count)
+			cs_free (insn, count);
+		else//data in code, skip a byte like capstone would
+			offset++;
+	}
+}
+
+bool holox86::X86FunctionAnalyzer::verifyPreDecoder() {
+	size_t checked = 0, mismatches = 0;
+	for (Section* section : binary->sections)
+		verifyPreDecoderSection (handle, binary, section, &checked, &mismatches);
+	printf ("Pre-Decoder checked %zu instructions, %zu mismatches\n", checked, mismatches);
+	//nothing decoded means nothing was compared
+	return checked && !mismatches;
+}
+
 
 
 void holox86::X86FunctionAnalyzer::setOperands (Instruction* instruction, cs_detail* csdetail) {
@@ -111,7 +215,7 @@ void holox86::X86FunctionAnalyzer::setOperands (Instruction* instruction, cs_det
 		IRArgument arg;
 		switch (x86.operands[i].type) {
 		case X86_OP_INVALID:
-			printf ("Invalid\n");
+			H_LOG_WARN (eLogAnalysis, "Invalid Operand at 0x%" PRIx64 "\n", instruction->addr);
 			break;
 		case X86_OP_REG:{
 			const char* regname = cs_reg_name (handle, x86.operands[i].reg);
@@ -137,7 +241,7 @@ void holox86::X86FunctionAnalyzer::setOperands (Instruction* instruction, cs_det
 						arch->getRegister (cs_reg_name (handle, x86.operands[i].mem.segment)),//segment
 						arch->getRegister ((HId)0),
 						arch->getRegister (cs_reg_name (handle, x86.operands[i].mem.index)),
-						x86.operands[i].mem.scale, x86.operands[i].mem.disp + instruction->addr,
+						x86.operands[i].mem.scale, x86.operands[i].mem.disp + instruction->addr + instruction->size,//relative to the next instruction
 						x86.operands[i].size * 8
 					);
 			} else {
@@ -155,7 +259,7 @@ void holox86::X86FunctionAnalyzer::setOperands (Instruction* instruction, cs_det
 			arg = IRArgument::createVal ( (double) x86.operands[i].fp, x86.operands[i].size * 8);
 			break;
 		default:
-			printf ("Invalid ...\n");
+			H_LOG_WARN (eLogAnalysis, "Unknown Operand Type at 0x%" PRIx64 "\n", instruction->addr);
 		}
 		instruction->operands.push_back (arg);
 	}
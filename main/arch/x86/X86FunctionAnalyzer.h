@@ -6,16 +6,21 @@
 
 #include <capstone.h>
 #include "Architecture.h"
+#include "X86PreDecoder.h"
 
 namespace holox86 {
 
 	using namespace holodec;
 
 	extern Architecture x86architecture;
+	//generated into X86IRTables.cpp with --gen-ir-tables
+	extern const IRTables x86irtables;
 
 	class X86FunctionAnalyzer : public FunctionAnalyzer {
 	private:
 		csh handle;
+		//block starts found by the pre-decoder before lifting
+		HSet<uint64_t> leaders;
 
 		void setJumpDest (Instruction* instruction);
 		void analyzeInstruction (Instruction* instr, size_t addr, cs_insn *insn);
@@ -29,8 +34,14 @@ namespace holox86 {
 		virtual bool init (Binary* binary);
 		virtual bool terminate();
 
+		virtual void scanFunctionStarts (HSet<uint64_t>* addresses);
+
+		virtual void preAnalysis();
 		virtual bool analyzeInsts (size_t addr);
 
+		//compares lengths and branch targets of the pre-decoder against capstone over all executable sections
+		bool verifyPreDecoder();
+
 	};
 	
 	#define CUSOM_X86_INSTR_EXTR_REP 	(0x1000000)
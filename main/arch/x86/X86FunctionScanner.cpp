@@ -0,0 +1,241 @@
+#include "X86FunctionScanner.h"
+#include "X86PreDecoder.h"
+
+#include <algorithm>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define H_X86_SCAN_LOCAL_JUMP (0x1000)
+//instructions a candidate may take to reach the end of its first block
+#define H_X86_SCAN_MAX_BLOCK (32)
+
+namespace holox86 {
+
+	struct X86PaddingPattern {
+		size_t length;
+		uint8_t bytes[10];
+	};
+	//the nops emitted by gcc/clang for alignment, longest first
+	static const X86PaddingPattern paddingPatterns[] = {
+		{10, {0x66, 0x2E, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00}},
+		{9, {0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00}},
+		{8, {0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00}},
+		{7, {0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00}},
+		{6, {0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00}},
+		{5, {0x0F, 0x1F, 0x44, 0x00, 0x00}},
+		{4, {0x0F, 0x1F, 0x40, 0x00}},
+		{3, {0x0F, 0x1F, 0x00}},
+		{2, {0x66, 0x90}},
+		{1, {0x90}},
+		{1, {0xCC}},
+	};
+
+	//length of the padding instruction ending at offset or 0
+	static size_t paddingEndingAt (const uint8_t* data, size_t offset) {
+		uint8_t last = offset ? data[offset - 1] : 0xFF;
+		if (last != 0x90 && last != 0xCC && last != 0x00)
+			return 0;
+		for (const X86PaddingPattern& pattern : paddingPatterns) {
+			if (pattern.length > offset || pattern.bytes[pattern.length - 1] != last)
+				continue;
+			size_t i = 0;
+			while (i < pattern.length && data[offset - pattern.length + i] == pattern.bytes[i])
+				i++;
+			if (i != pattern.length)
+				continue;
+			size_t length = pattern.length;
+			//long nops get additional data16 prefixes
+			if (length >= 9) {
+				while (length < 15 && length < offset && data[offset - length - 1] == 0x66)
+					length++;
+			}
+			return length;
+		}
+		return 0;
+	}
+	//checks if the bytes before offset end in an instruction that leaves the function
+	//short jumps stay inside of the function, e.g. into a loop or back from a cold block
+	static bool endsWithTerminator (const uint8_t* data, size_t offset, size_t candidate) {
+		if (offset >= 1 && (data[offset - 1] == 0xC3 || data[offset - 1] == 0xCC || data[offset - 1] == 0xF4))
+			return true;//ret, int3, hlt
+		if (offset >= 2 && ( (data[offset - 2] == 0x0F && data[offset - 1] == 0x0B) || (data[offset - 2] == 0xFF && (data[offset - 1] & 0xF8) == 0xE0)))
+			return true;//ud2, jmp reg
+		if (offset >= 3 && data[offset - 3] == 0xC2)
+			return true;//ret imm16
+		if (offset >= 5 && data[offset - 5] == 0xE9) {
+			int32_t rel = (int32_t) ( (uint32_t) data[offset - 4] | ( (uint32_t) data[offset - 3] << 8) | ( (uint32_t) data[offset - 2] << 16) | ( (uint32_t) data[offset - 1] << 24));
+			return rel < -H_X86_SCAN_LOCAL_JUMP || rel > (int64_t) (candidate - offset) + H_X86_SCAN_LOCAL_JUMP;
+		}
+		return false;
+	}
+	//a candidate has to decode cleanly up to an instruction that ends its first block
+	static bool validateCandidate (const uint8_t* data, size_t size, size_t offset, uint64_t vaddr) {
+		if (offset + 2 <= size && data[offset] == 0x00 && data[offset + 1] == 0x00)
+			return false;
+		for (int i = 0; i < H_X86_SCAN_MAX_BLOCK && offset < size; i++) {
+			X86PreDecoded predecoded;
+			if (!x86PreDecode (data + offset, size - offset, vaddr + offset, &predecoded) || predecoded.flow == X86Flow::eInvalid)
+				return false;
+			offset += predecoded.length;
+			if (x86FlowEndsBlock (predecoded.flow))
+				return true;
+		}
+		return false;
+	}
+
+	//returns the offset where the function of the prologue at offset starts or size if it is none
+	static size_t prologueStart (const uint8_t* data, size_t size, size_t offset) {
+		if (data[offset] == 0xF3) {
+			//landing pads start with endbr64 and take the exception object out of rax
+			const uint8_t* next = data + offset + 4;
+			if (offset + 7 <= size && (next[0] & 0xFA) == 0x48 && next[1] == 0x89 && (next[2] & 0xF8) == 0xC0)
+				return size;
+			return offset;
+		}
+		if (data[offset] != 0x48)
+			return offset;
+		//sub rsp, imm: the function starts at the pushes of the callee saved registers in front of it
+		while (true) {
+			if (offset >= 1 && (data[offset - 1] & 0xF8) == 0x50)
+				offset -= 1;
+			else if (offset >= 2 && data[offset - 2] == 0x41 && (data[offset - 1] & 0xF8) == 0x50)
+				offset -= 2;
+			else
+				break;
+		}
+		size_t paddingstart = offset;
+		while (size_t length = paddingEndingAt (data, paddingstart))
+			paddingstart -= length;
+		return endsWithTerminator (data, paddingstart, offset) ? offset : size;
+	}
+
+	struct X86ScanState {
+		const uint8_t* data;
+		size_t size;
+		HList<size_t> found;
+		//targets of near conditional jumps, these are blocks inside of a function
+		HList<uint64_t> branchtargets;
+
+		void markBranch (size_t offset) {
+			if (offset + 6 > size)
+				return;
+			const uint8_t* p = data + offset;
+			int64_t target = offset + 6 + (int32_t) ( (uint32_t) p[2] | ( (uint32_t) p[3] << 8) | ( (uint32_t) p[4] << 16) | ( (uint32_t) p[5] << 24));
+			if (target >= 0 && (size_t) target < size)
+				branchtargets[target >> 6] |= (uint64_t) 1 << (target & 0x3F);
+		}
+		bool isBranchTarget (size_t offset) {
+			if (branchtargets[offset >> 6] & ( (uint64_t) 1 << (offset & 0x3F)))
+				return true;
+			//short jccs are too common as a byte pattern to mark them all, look at the 256 bytes around instead
+			size_t begin = offset > 129 ? offset - 129 : 0;
+			size_t end = std::min (offset + 126, size - 1);
+			for (size_t i = begin; i < end; i++) {
+				if ( (data[i] & 0xF0) == 0x70 && i + 2 + (int8_t) data[i + 1] == offset)
+					return true;
+			}
+			return false;
+		}
+		void addPrologue (size_t offset) {
+			size_t start = prologueStart (data, size, offset);
+			if (start < size)
+				found.push_back (start);
+		}
+		void check (size_t offset) {
+			const uint8_t* p = data + offset;
+			if (p[0] == 0x0F && (p[1] & 0xF0) == 0x80)
+				markBranch (offset);
+			if ( (p[0] == 0x55 && p[1] == 0x48 && p[2] == 0x89 && p[3] == 0xE5) ||
+			        (p[0] == 0xF3 && p[1] == 0x0F && p[2] == 0x1E && p[3] == 0xFA) ||
+			        (p[0] == 0x48 && (p[1] == 0x83 || p[1] == 0x81) && p[2] == 0xEC))
+				addPrologue (offset);
+		}
+	};
+
+	void x86ScanBuffer (const uint8_t* data, size_t size, uint64_t vaddr, HSet<uint64_t>* candidates) {
+		X86ScanState state = {data, size, {}, HList<uint64_t> ( (size + 63) / 64, 0)};
+		size_t i = 0;
+#ifdef __SSE2__
+		const __m128i push = _mm_set1_epi8 (0x55), rexw = _mm_set1_epi8 (0x48), movrm = _mm_set1_epi8 ( (char) 0x89), rbprsp = _mm_set1_epi8 ( (char) 0xE5);
+		const __m128i rep = _mm_set1_epi8 ( (char) 0xF3), esc = _mm_set1_epi8 (0x0F), hint = _mm_set1_epi8 (0x1E), endbr = _mm_set1_epi8 ( (char) 0xFA);
+		const __m128i grp1imm8 = _mm_set1_epi8 ( (char) 0x83), grp1imm32 = _mm_set1_epi8 ( (char) 0x81), subrsp = _mm_set1_epi8 ( (char) 0xEC);
+		const __m128i highnibble = _mm_set1_epi8 ( (char) 0xF0), jcc32 = _mm_set1_epi8 ( (char) 0x80);
+		//compare 16 positions at once against push rbp; mov rbp,rsp / endbr64 / sub rsp,imm and the jcc opcodes
+		for (; i + 16 + 3 <= size; i += 16) {
+			__m128i b0 = _mm_loadu_si128 ( (const __m128i*) (data + i));
+			__m128i b1 = _mm_loadu_si128 ( (const __m128i*) (data + i + 1));
+			__m128i b2 = _mm_loadu_si128 ( (const __m128i*) (data + i + 2));
+			__m128i b3 = _mm_loadu_si128 ( (const __m128i*) (data + i + 3));
+			__m128i m1 = _mm_and_si128 (_mm_and_si128 (_mm_cmpeq_epi8 (b0, push), _mm_cmpeq_epi8 (b1, rexw)), _mm_and_si128 (_mm_cmpeq_epi8 (b2, movrm), _mm_cmpeq_epi8 (b3, rbprsp)));
+			__m128i m2 = _mm_and_si128 (_mm_and_si128 (_mm_cmpeq_epi8 (b0, rep), _mm_cmpeq_epi8 (b1, esc)), _mm_and_si128 (_mm_cmpeq_epi8 (b2, hint), _mm_cmpeq_epi8 (b3, endbr)));
+			__m128i m3 = _mm_and_si128 (_mm_and_si128 (_mm_cmpeq_epi8 (b0, rexw), _mm_or_si128 (_mm_cmpeq_epi8 (b1, grp1imm8), _mm_cmpeq_epi8 (b1, grp1imm32))), _mm_cmpeq_epi8 (b2, subrsp));
+			__m128i m4 = _mm_and_si128 (_mm_cmpeq_epi8 (b0, esc), _mm_cmpeq_epi8 (_mm_and_si128 (b1, highnibble), jcc32));
+			unsigned int jccmask = _mm_movemask_epi8 (m4);
+			while (jccmask) {
+				state.markBranch (i + __builtin_ctz (jccmask));
+				jccmask &= jccmask - 1;
+			}
+			unsigned int prologuemask = _mm_movemask_epi8 (_mm_or_si128 (_mm_or_si128 (m1, m2), m3));
+			while (prologuemask) {
+				state.addPrologue (i + __builtin_ctz (prologuemask));
+				prologuemask &= prologuemask - 1;
+			}
+		}
+#endif
+		for (; i + 4 <= size; i++)
+			state.check (i);
+
+		//functions are 16 byte aligned, code after padding that follows a terminator starts a new function
+		for (size_t offset = (16 - (vaddr & 0xF)) & 0xF; offset < size; offset += 16) {
+			if (!offset || data[offset] == 0x90 || data[offset] == 0xCC || data[offset] == 0x00)
+				continue;
+			uint8_t last = data[offset - 1];
+			if (last != 0x90 && last != 0xCC && last != 0x00)
+				continue;
+			size_t paddingstart = offset;
+			while (size_t length = paddingEndingAt (data, paddingstart))
+				paddingstart -= length;
+			if (paddingstart != offset && endsWithTerminator (data, paddingstart, offset))
+				state.found.push_back (offset);
+		}
+
+		std::sort (state.found.begin(), state.found.end());
+		for (size_t offset : state.found) {
+			if (state.isBranchTarget (offset))
+				continue;
+			if (validateCandidate (data, size, offset, vaddr))
+				candidates->insert (candidates->end(), vaddr + offset);
+		}
+	}
+
+	static void scanSection (Binary* binary, Section* section, HSet<uint64_t>* candidates) {
+		for (Section* subsection : section->subsections)
+			scanSection (binary, subsection, candidates);
+		if (!section->subsections.empty() || ! (section->srwx & 0x4) || section->offset + section->size > binary->data->size)
+			return;
+		x86ScanBuffer (section->getPtr<uint8_t> (binary->data, 0), section->size, section->vaddr, candidates);
+	}
+
+	void x86ScanFunctionStarts (Binary* binary, HSet<uint64_t>* candidates) {
+		HSet<uint64_t> found;
+		for (Section* section : binary->sections)
+			scanSection (binary, section, &found);
+
+		//start -> end of the functions we already know about
+		HMap<uint64_t, uint64_t> knownFunctions;
+		for (Symbol* symbol : binary->symbols) {
+			if (symbol->symboltype == &SymbolType::symfunc)
+				knownFunctions[symbol->vaddr] = symbol->vaddr + symbol->size;
+		}
+		for (uint64_t addr : found) {
+			auto it = knownFunctions.upper_bound (addr);
+			if (it != knownFunctions.begin()) {
+				--it;
+				if (it->first == addr || addr < it->second)
+					continue;
+			}
+			candidates->insert (addr);
+		}
+	}
+}
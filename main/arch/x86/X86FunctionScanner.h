@@ -0,0 +1,19 @@
+#ifndef H_X86FUNCTIONSCANNER_H
+#define H_X86FUNCTIONSCANNER_H
+
+#include "General.h"
+#include "Binary.h"
+
+namespace holox86 {
+
+	using namespace holodec;
+
+	//sweeps all executable sections for function prologues and for code following the padding between functions
+	//candidates are validated with the pre-decoder and must not lie inside of a function symbol with known size
+	void x86ScanFunctionStarts (Binary* binary, HSet<uint64_t>* candidates);
+
+	//scans a single buffer, exposed for measuring the raw throughput
+	void x86ScanBuffer (const uint8_t* data, size_t size, uint64_t vaddr, HSet<uint64_t>* candidates);
+}
+
+#endif // H_X86FUNCTIONSCANNER_H
@@ -0,0 +1,2439 @@
+//generated with "holodec --gen-ir-tables" from the ir-strings of the architecture x86, do not edit
+#include "IRTables.h"
+
+namespace holox86 {
+
+	static const holodec::IRTableArgument arguments[] = {
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x50, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x54, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x9, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xd, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x10, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x11, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x13, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x14, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x16, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x17, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x15, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x18, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x19, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x21, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x22, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x60, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x60, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x24, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x25, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x23, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x26, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x27, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x15, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x29, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x2a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x2c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x2d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x13, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x14, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x2f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x18, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x30, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x21, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x22, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x32, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x33, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x26, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x34, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x54, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x36, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x37, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x39, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x54, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x3a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x3b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x3c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x3f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 0, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x42, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x43, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x45, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 0, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x46, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x45, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x47, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x49, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x4a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x4b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x44, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x48, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x18, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x10, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x50, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x51, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x52, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x53, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x55, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x55, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x55, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x57, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x56, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x58, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x55, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x56, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x5a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x55, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x56, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x5c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 8, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 11, 0, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x5e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x5f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 8, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x10, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x61, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x11, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x63, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x65, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x53, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x52, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x69, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x6b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x69, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x70, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x50, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x54, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x73, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x74, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x75, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x74, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x50, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x54, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x78, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x78, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x7a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x73, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x54, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x7d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x50, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x80, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x54, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x50, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x85, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x86, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x84, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x87, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x53, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x8a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x8b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x89, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x53, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x8f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x90, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x91, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x89, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x92, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x53, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x94, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x95, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x96, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x89, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x97, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x53, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x99, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x9a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x9b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x89, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x9c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x85, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 8, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x9f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 8, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x85, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x10, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x85, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xa9, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xab, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xaa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xac, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x10, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xae, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xaf, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0xb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xb1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x13, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x10, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x16, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xb3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xb4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xb2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xb5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xb0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xb6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x11, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xb8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xb9, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xbb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x11, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xbd, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xbe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xbc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xbf, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xba, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x10, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xc2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xc4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xc6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xc5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xc7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xc8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x22, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x25, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xc4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xc6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xca, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xcb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xcc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xce, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xcf, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xd0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xd1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x14, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x17, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xd3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xd4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xd5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x22, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x25, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xce, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xcf, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xd7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xd8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xd9, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xdb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xdc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xdd, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x14, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xdf, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x2c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xe0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xd3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x2c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xe2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xe4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x29, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xe5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xc4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x2c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xe7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xdb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x29, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xe9, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xce, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x2c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xeb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x14, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xed, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x17, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xef, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xee, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xf0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xd0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xf1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x10, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x12, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xf3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xf5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xf7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xf8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xfb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x11, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0xfd, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x54, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x50, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xfa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xfc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xfe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xff, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x12, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x101, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x102, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xfc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xfe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xff, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x11, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x104, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x105, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xfc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xfe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xff, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x36, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x36, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x42, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x42, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x107, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x108, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x109, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 80, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0xffffffffffffffff, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 80, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x10b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x50, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 80, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x10d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 80, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x10e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x110, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 80, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x112, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x112, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 80, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x113, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x111, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x112, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 8, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x116, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 8, {0x5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x118, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xfa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x117, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x119, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xff, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x116, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x12, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x118, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x102, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x11b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x11c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xff, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x116, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x11, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x118, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x105, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x11e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x11f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xff, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 8, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x121, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x122, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x123, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x125, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x10, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x12, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x127, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x10, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x10, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x129, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x126, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x128, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x12a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x123, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x12c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x11, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x12e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x130, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x12d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x12f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x131, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x123, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x86, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x133, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x134, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x123, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x136, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x137, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x138, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x139, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x123, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x13b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x13c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 8, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x140, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 8, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x142, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x141, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x70, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x144, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x69, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x70, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0xd, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x148, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x14b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x75, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x74, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x78, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x7a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x73, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x7d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x154, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x80, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x54, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0xb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x159, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x50, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 8, {0x5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x4a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x15d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x42, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x36, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x15f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x107, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x43, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x8b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x8a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x53, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x162, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x163, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x161, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x164, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x90, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x8f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x53, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x166, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x167, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x161, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x168, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x95, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x94, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x53, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x16a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x16b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x161, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x16c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x9a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x3d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x99, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x53, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x16e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x16f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x161, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x170, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x172, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x173, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x14c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x175, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x176, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x173, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x177, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x73, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x179, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x17a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x173, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x17b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x17d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x17e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x17f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x18, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x10, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x181, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x182, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x17d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x17e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x183, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x85, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x40, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x38, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x30, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x28, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x20, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x186, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x187, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x188, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x189, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x181, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x182, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x17d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x17e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x18a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x85, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x80, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x18d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x14, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x14, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x18f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x17, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x16, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x192, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x13, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x14, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x194, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x14, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x3f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x7f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x197, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x198, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x199, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x5f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x19b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x197, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x19c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x198, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x19d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x25, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x25, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x19f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x22, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x22, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1a1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x86, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x85, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1a4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x50, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x122, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1a6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x126, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x128, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x12a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1a6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x12d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x12f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x131, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1a6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1aa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1ac, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1ab, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1ad, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x3f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1b1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1b2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x3b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x3c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x41, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x3b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x3c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 8, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x45, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1b5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x37, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x42, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x42, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1ba, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x12, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0xd, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1b7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1b8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1b9, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1bb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1bc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1bd, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1be, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1bf, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x3e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x3a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x42, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x42, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1c3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x11, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x107, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x4b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x4a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0x49, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 8, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 16, {0x43, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1ce, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1bf, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1be, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1bd, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1bd, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1bc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1cf, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1b9, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1b8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1b7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x42, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1cf, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x107, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1c1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1d3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1d5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1d6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x85, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d9, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1da, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1d5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1dc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1dd, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1da, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1d5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1df, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1e0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1da, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1d5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1e2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1e3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1da, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1e5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1e7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1e9, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1eb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 32, {0x4a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 8, {0x5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1ee, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1ef, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1da, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1f1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1f2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1da, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1f4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1f5, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1da, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1f7, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1f8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1da, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x1fa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1fb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x89, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x164, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x89, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x168, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x89, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x16c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x89, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x170, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x144, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x69, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x70, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x75, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x74, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x78, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x7a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x73, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x7d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x154, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x80, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x54, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x50, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x211, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x212, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1da, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x214, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x215, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1da, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x217, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 8, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x218, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x214, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x21a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x21c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x21d, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1da, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x21f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x220, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1da, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x217, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 8, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x222, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x21f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x3, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x224, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x53, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x52, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 2, 0, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x229, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x164, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x229, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x168, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x229, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x16c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x229, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x170, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x22e, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x22f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xa, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xc, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0xe, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x39, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x231, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x3c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x3b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x89, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x89, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 9, 0, {0x2, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 10, 0, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x84, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x234, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x1d4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x3b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x3c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x8, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x4, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x6, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0xb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0xb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x1, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0xb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x239, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x89, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x23a, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x238, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x23b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x237, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x23c, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0xb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x23b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 1, {0x4f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 5, 64, {0x0, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 1, 64, {0xb, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x73, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 1, {0x240, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x23b, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x23f, 0x0, 0x0, 0x0, 0x0}},
+		{(holodec::IRArgTypes) 7, 0, {0x241, 0x0, 0x0, 0x0, 0x0}},
+	};
+
+	static const holodec::IRTableExpression expressions[] = {
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x1, nullptr, 0, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 3, 2},
+		{(holodec::IRExprType) 28, 1, (holodec::SSAType) 2, 0x6, nullptr, 5, 0},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 5, 2},
+		{(holodec::IRExprType) 28, 1, (holodec::SSAType) 2, 0x3, nullptr, 7, 0},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 7, 2},
+		{(holodec::IRExprType) 28, 1, (holodec::SSAType) 2, 0x7, nullptr, 9, 0},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 9, 2},
+		{(holodec::IRExprType) 28, 1, (holodec::SSAType) 2, 0x4, nullptr, 11, 0},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 11, 2},
+		{(holodec::IRExprType) 28, 1, (holodec::SSAType) 2, 0x1, nullptr, 13, 0},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 13, 2},
+		{(holodec::IRExprType) 28, 1, (holodec::SSAType) 2, 0x2, nullptr, 15, 0},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 15, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 17, 7},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x1, nullptr, 24, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 26, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 28, 7},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 35, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 38, 3},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x1, nullptr, 41, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 43, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 46, 3},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x1, nullptr, 49, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 51, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 53, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 55, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 58, 3},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x1, nullptr, 61, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 63, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 66, 3},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x1, nullptr, 69, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 71, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 74, 3},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x1, nullptr, 77, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 79, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 82, 3},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x1, nullptr, 85, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 87, 4},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 91, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 93, 3},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 96, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 98, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 100, 3},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 103, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 105, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x2, nullptr, 107, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 109, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 111, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x2, nullptr, 113, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x2, nullptr, 115, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 117, 4},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 121, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x1, nullptr, 123, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 126, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 128, 7},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x10, nullptr, 135, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 137, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 139, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 141, 2},
+		{(holodec::IRExprType) 1, 0, (holodec::SSAType) 0, 0x0, nullptr, 143, 1},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 144, 7},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x13, nullptr, 151, 1},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x10, nullptr, 152, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 154, 2},
+		{(holodec::IRExprType) 25, 1, (holodec::SSAType) 2, 0xf, nullptr, 156, 1},
+		{(holodec::IRExprType) 19, 1, (holodec::SSAType) 2, 0xf, nullptr, 157, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 160, 2},
+		{(holodec::IRExprType) 25, 1, (holodec::SSAType) 2, 0xf, nullptr, 162, 1},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x1, nullptr, 163, 2},
+		{(holodec::IRExprType) 19, 1, (holodec::SSAType) 2, 0xf, nullptr, 165, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 168, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xc, nullptr, 170, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xe, nullptr, 172, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x7, nullptr, 174, 2},
+		{(holodec::IRExprType) 11, 0, (holodec::SSAType) 0, 0x0, nullptr, 176, 0},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 176, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 178, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 181, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 184, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 187, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 190, 3},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 193, 4},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 197, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 199, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 202, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x9, nullptr, 204, 1},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 205, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 207, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 209, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 211, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 213, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 215, 2},
+		{(holodec::IRExprType) 20, 1, (holodec::SSAType) 2, 0xf, nullptr, 217, 2},
+		{(holodec::IRExprType) 8, 0, (holodec::SSAType) 0, 0x0, nullptr, 219, 1},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 220, 2},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 1, 0x5, nullptr, 222, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 224, 2},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 1, 0x5, nullptr, 226, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 228, 2},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 1, 0x5, nullptr, 230, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 232, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 234, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 236, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x9, nullptr, 238, 1},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 239, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x6, nullptr, 241, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 243, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 245, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 247, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 249, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x7, nullptr, 251, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 253, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 255, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x9, nullptr, 257, 1},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xa, nullptr, 258, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x6, nullptr, 260, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 262, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 264, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xb, nullptr, 266, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 268, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x7, nullptr, 270, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 272, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 274, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x9, nullptr, 276, 1},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 277, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 279, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x9, nullptr, 281, 1},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 282, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 284, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 286, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 288, 2},
+		{(holodec::IRExprType) 26, 1, (holodec::SSAType) 2, 0xf, nullptr, 290, 1},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 1, 0x5, nullptr, 291, 2},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "sub", 293, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 295, 2},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "cmp", 297, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x1, nullptr, 299, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x2, nullptr, 301, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 303, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 306, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 308, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x1, nullptr, 310, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x2, nullptr, 312, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 314, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 317, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 319, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x1, nullptr, 321, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x2, nullptr, 323, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 325, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 328, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 330, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x1, nullptr, 332, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x2, nullptr, 334, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 336, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 339, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 341, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xa, nullptr, 343, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xa, nullptr, 345, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 347, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 349, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 351, 3},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 354, 7},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xa, nullptr, 361, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 363, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 365, 3},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 368, 7},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xa, nullptr, 375, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xa, nullptr, 377, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 379, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 381, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 383, 3},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 386, 7},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 393, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xa, nullptr, 395, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 397, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 399, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 401, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 403, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 405, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 407, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 409, 3},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 412, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 414, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xa, nullptr, 416, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 418, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 420, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 422, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 424, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 426, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 428, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 430, 3},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 433, 2},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 1, 0x5, nullptr, 435, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 437, 2},
+		{(holodec::IRExprType) 16, 1, (holodec::SSAType) 3, 0x5, nullptr, 439, 1},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 3, 0x5, nullptr, 440, 2},
+		{(holodec::IRExprType) 16, 1, (holodec::SSAType) 3, 0x5, nullptr, 442, 1},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 3, 0x5, nullptr, 443, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 445, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 447, 2},
+		{(holodec::IRExprType) 16, 1, (holodec::SSAType) 3, 0x5, nullptr, 449, 1},
+		{(holodec::IRExprType) 16, 1, (holodec::SSAType) 3, 0x5, nullptr, 450, 1},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 451, 4},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 455, 2},
+		{(holodec::IRExprType) 16, 1, (holodec::SSAType) 2, 0xf, nullptr, 457, 1},
+		{(holodec::IRExprType) 16, 1, (holodec::SSAType) 2, 0xf, nullptr, 458, 1},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 2, 0xf, nullptr, 459, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 461, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 464, 2},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 3, 0x5, nullptr, 466, 2},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 3, 0x5, nullptr, 468, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 470, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 472, 2},
+		{(holodec::IRExprType) 16, 1, (holodec::SSAType) 2, 0xf, nullptr, 474, 1},
+		{(holodec::IRExprType) 16, 1, (holodec::SSAType) 2, 0xf, nullptr, 475, 1},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 476, 4},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 480, 2},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 3, 0x5, nullptr, 482, 2},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 3, 0x5, nullptr, 484, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 486, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 488, 2},
+		{(holodec::IRExprType) 16, 1, (holodec::SSAType) 2, 0xf, nullptr, 490, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 492, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 494, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 496, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 498, 2},
+		{(holodec::IRExprType) 16, 1, (holodec::SSAType) 3, 0x5, nullptr, 500, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 502, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 504, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 506, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 508, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 510, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 512, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 514, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 516, 2},
+		{(holodec::IRExprType) 16, 1, (holodec::SSAType) 2, 0xf, nullptr, 518, 1},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 2, 0xf, nullptr, 519, 2},
+		{(holodec::IRExprType) 16, 1, (holodec::SSAType) 2, 0xf, nullptr, 521, 1},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 2, 0xf, nullptr, 522, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 524, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 527, 2},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 1, 0x5, nullptr, 529, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 531, 2},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 2, 0xf, nullptr, 533, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 535, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x2, nullptr, 537, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 539, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 541, 6},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 547, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x4, nullptr, 549, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 551, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x5, nullptr, 553, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 555, 2},
+		{(holodec::IRExprType) 1, 0, (holodec::SSAType) 0, 0x0, nullptr, 557, 6},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 563, 4},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 567, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 569, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 571, 4},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 575, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 577, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 579, 4},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "push", 583, 1},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "mov", 584, 2},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "sub", 586, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 588, 3},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x3, nullptr, 591, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 593, 2},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 3, 0x5, nullptr, 595, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x1, nullptr, 597, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 599, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x1, nullptr, 601, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 603, 2},
+		{(holodec::IRExprType) 21, 1, (holodec::SSAType) 2, 0xf, nullptr, 605, 1},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 3, 0x1, nullptr, 606, 2},
+		{(holodec::IRExprType) 20, 1, (holodec::SSAType) 2, 0xf, nullptr, 608, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 610, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 1, 0x4, nullptr, 612, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 614, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 1, 0x5, nullptr, 616, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 618, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 620, 4},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 624, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 626, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 628, 4},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 632, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 634, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 636, 4},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x3, nullptr, 640, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 642, 2},
+		{(holodec::IRExprType) 1, 0, (holodec::SSAType) 0, 0x0, nullptr, 644, 3},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 647, 4},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x3, nullptr, 651, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 653, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 655, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 658, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 660, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 663, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 665, 6},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x3, nullptr, 671, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 673, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 675, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 678, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 680, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 683, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 685, 6},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 1, 0x3, nullptr, 691, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 693, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 695, 4},
+		{(holodec::IRExprType) 26, 1, (holodec::SSAType) 2, 0xf, nullptr, 699, 1},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 1, 0x5, nullptr, 700, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 1, 0x3, nullptr, 702, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 704, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 706, 4},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x1, nullptr, 710, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 712, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 714, 6},
+		{(holodec::IRExprType) 10, 0, (holodec::SSAType) 0, 0x0, nullptr, 720, 1},
+		{(holodec::IRExprType) 10, 0, (holodec::SSAType) 0, 0x0, nullptr, 721, 0},
+		{(holodec::IRExprType) 21, 1, (holodec::SSAType) 2, 0xf, nullptr, 721, 2},
+		{(holodec::IRExprType) 9, 0, (holodec::SSAType) 0, 0x0, nullptr, 723, 1},
+		{(holodec::IRExprType) 21, 1, (holodec::SSAType) 2, 0xf, nullptr, 724, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 726, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x9, nullptr, 728, 1},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 729, 2},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 731, 2},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 733, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x9, nullptr, 735, 1},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 736, 2},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 738, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x9, nullptr, 740, 1},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 741, 2},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 743, 2},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 745, 2},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 747, 2},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 749, 2},
+		{(holodec::IRExprType) 5, 0, (holodec::SSAType) 0, 0x0, nullptr, 751, 1},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 752, 2},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 754, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x9, nullptr, 756, 1},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 757, 2},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 759, 2},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 761, 2},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 763, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x9, nullptr, 765, 1},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 766, 2},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 768, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 770, 2},
+		{(holodec::IRExprType) 22, 1, (holodec::SSAType) 2, 0xf, nullptr, 772, 1},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 773, 2},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "mov", 775, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 777, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 779, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 781, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 783, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 785, 3},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 788, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 790, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 792, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 794, 3},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 797, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 799, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 801, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 803, 3},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 806, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 808, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 810, 2},
+		{(holodec::IRExprType) 4, 0, (holodec::SSAType) 0, 0x0, nullptr, 812, 3},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 815, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x2, nullptr, 817, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 819, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 821, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x6, nullptr, 823, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x9, nullptr, 825, 1},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 826, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 828, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x6, nullptr, 830, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x9, nullptr, 832, 1},
+		{(holodec::IRExprType) 6, 0, (holodec::SSAType) 0, 0x0, nullptr, 833, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 835, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 837, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 840, 3},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 843, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 845, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 847, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 850, 3},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 853, 4},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 857, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xa, nullptr, 859, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 861, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 864, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 867, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 870, 3},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 873, 8},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 881, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xa, nullptr, 883, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 885, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 887, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 889, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 891, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 893, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 895, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 897, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 899, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 901, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 903, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 905, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 908, 3},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 911, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 913, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 915, 3},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 918, 3},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 921, 4},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 925, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 927, 4},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 931, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 933, 4},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 937, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 939, 2},
+		{(holodec::IRExprType) 13, 1, (holodec::SSAType) 2, 0xf, nullptr, 941, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 943, 2},
+		{(holodec::IRExprType) 1, 0, (holodec::SSAType) 0, 0x0, nullptr, 945, 4},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 949, 4},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 953, 6},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 959, 6},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0xb, nullptr, 965, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 967, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x2, nullptr, 969, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 971, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 973, 7},
+		{(holodec::IRExprType) 2, 0, (holodec::SSAType) 0, 0x0, nullptr, 980, 0},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 980, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x11, nullptr, 982, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 984, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 986, 6},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 992, 5},
+		{(holodec::IRExprType) 21, 1, (holodec::SSAType) 2, 0xf, nullptr, 997, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 999, 2},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1001, 1},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1002, 1},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1003, 1},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x1, nullptr, 1004, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1006, 2},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1008, 1},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1009, 1},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1010, 1},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1011, 1},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1012, 8},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1020, 1},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1021, 1},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x1, nullptr, 1022, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1024, 2},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1026, 1},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1027, 1},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1028, 1},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1029, 1},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1030, 8},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1038, 1},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1039, 1},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "pop", 1040, 1},
+		{(holodec::IRExprType) 20, 1, (holodec::SSAType) 2, 0xf, nullptr, 1041, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1043, 2},
+		{(holodec::IRExprType) 23, 0, (holodec::SSAType) 0, 0x0, "push", 1045, 1},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1046, 10},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1056, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1058, 10},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x12, nullptr, 1068, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1070, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 1072, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x19, nullptr, 1074, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1076, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1078, 2},
+		{(holodec::IRExprType) 14, 0, (holodec::SSAType) 0, 0x0, nullptr, 1080, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1083, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1085, 3},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x19, nullptr, 1088, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1090, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1092, 3},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x18, nullptr, 1095, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1097, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1099, 3},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x18, nullptr, 1102, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1104, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1106, 3},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x19, nullptr, 1109, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1111, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x19, nullptr, 1113, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1115, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x18, nullptr, 1117, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1119, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x18, nullptr, 1121, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1123, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1125, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x17, nullptr, 1127, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1129, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1131, 8},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x17, nullptr, 1139, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1141, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1143, 8},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x16, nullptr, 1151, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1153, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1155, 8},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x16, nullptr, 1163, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1165, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1167, 8},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x2, nullptr, 1175, 3},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1178, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1180, 7},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1187, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1189, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1191, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1193, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1195, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1197, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1199, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1201, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1203, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1205, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1207, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1209, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1211, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1213, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1215, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1217, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1219, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1221, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1223, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1225, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x15, nullptr, 1227, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1229, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1231, 8},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x15, nullptr, 1239, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1241, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1243, 8},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 1251, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x15, nullptr, 1253, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1255, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 1257, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1259, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x14, nullptr, 1261, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1263, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1265, 8},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x14, nullptr, 1273, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1275, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1277, 8},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x14, nullptr, 1285, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1287, 2},
+		{(holodec::IRExprType) 15, 1, (holodec::SSAType) 2, 0x2, nullptr, 1289, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1291, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1293, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1295, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1297, 2},
+		{(holodec::IRExprType) 18, 1, (holodec::SSAType) 2, 0xf, nullptr, 1299, 3},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1302, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1304, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1306, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1308, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x2, nullptr, 1310, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1312, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1314, 7},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1321, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1323, 6},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1329, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1331, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1333, 3},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1336, 6},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1342, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x6, nullptr, 1344, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x2, nullptr, 1346, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1348, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1350, 2},
+		{(holodec::IRExprType) 24, 0, (holodec::SSAType) 0, 0x0, nullptr, 1352, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1354, 2},
+		{(holodec::IRExprType) 24, 0, (holodec::SSAType) 0, 0x0, nullptr, 1356, 2},
+		{(holodec::IRExprType) 3, 0, (holodec::SSAType) 0, 0x0, nullptr, 1358, 2},
+		{(holodec::IRExprType) 7, 1, (holodec::SSAType) 2, 0x6, nullptr, 1360, 2},
+		{(holodec::IRExprType) 24, 0, (holodec::SSAType) 0, 0x0, nullptr, 1362, 2},
+		{(holodec::IRExprType) 27, 0, (holodec::SSAType) 0, 0x0, nullptr, 1364, 2},
+	};
+
+	static const holodec::IRTableEntry entries[] = {
+		{0xfe4ba67008042, nullptr, "#syscall",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x13f, 0x0, 0x0, 0x0, 0x0}}},
+		{0xfe77978f3751c, nullptr, "=($df,0)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x67, 0x0, 0x0, 0x0, 0x0}}},
+		{0xfe77978f3753d, nullptr, "=($df,1)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x227, 0x0, 0x0, 0x0, 0x0}}},
+		{0xfe779794fac9b, nullptr, "=($cf,0)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x3c, 0x0, 0x0, 0x0, 0x0}}},
+		{0xfe779794facfa, nullptr, "=($cf,1)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x226, 0x0, 0x0, 0x0, 0x0}}},
+		{0xfe7797a037b91, nullptr, "=($if,0)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x68, 0x0, 0x0, 0x0, 0x0}}},
+		{0xfe7797a037bf0, nullptr, "=($if,1)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x228, 0x0, 0x0, 0x0, 0x0}}},
+		{0x1505017c682328, nullptr, "#nop",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1af, 0x0, 0x0, 0x0, 0x0}}},
+		{0x15053105e28f8e, nullptr, "#trap",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x4c, 0x0, 0x0, 0x0, 0x0}}},
+		{0x14ba8a2ab601925, nullptr, "=(#arg[1],#app(#i2f(#arg[2][0,32]),#arg[1][32]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xe8, 0x0, 0x0, 0x0, 0x0}}},
+		{0x20ff3c378e9c4e1, nullptr, "#seq(#rec[push]($ebp),#rec[mov]($ebp,$esp),#rec[sub]($esp,#arg[1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x10a, 0x0, 0x0, 0x0, 0x0}}},
+		{0x2b82cf1b49fd1b0, nullptr, "#rep($rcx,#seq(#rec[stosb](#arg[1],#arg[2]),=($rcx,-($rcx,1))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x36db246797e391a, nullptr, "=(#arg[1],#app(#fext(#arg[2][0,32],64),#arg[1][64]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xea, 0x0, 0x0, 0x0, 0x0}}},
+		{0x40057db274f5ac7, nullptr, "#seq(=($zf,0),#rep(#and($rcx,#not($zf)),#seq(#rec[scasw](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x242, 0x0, 0x0, 0x0, 0x0}}},
+		{0x426a65fce68c5de, nullptr, "#rec[pop]($flags)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1ca, 0x0, 0x0, 0x0, 0x0}}},
+		{0x5fd52f7d7bf497a, nullptr, "=(#arg[1],#app(#arg[2][31],#arg[2][63],#arg[2][95],#arg[2][127]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x19e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7c478d9590b1a33, "==(#bsize(#arg[1]),64)", "=(#arg[1],#arg[2][0,64])",
+			{(holodec::IRArgTypes) 7, 1, {0x185, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x196, 0x0, 0x0, 0x0, 0x0}}},
+		{0xa677206d1d01a12, nullptr, "#seq(=(#arg[1],#band(#bnot(#arg[1]),#arg[2])),=($of,0),=($cf,0),=($sf,#s),=($zf,#z))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1b4, 0x0, 0x0, 0x0, 0x0}}},
+		{0xae7399c6963921d, nullptr, "#seq(=($zf,0),#rep(#and($rcx,#not($zf)),#seq(#rec[cmpsb](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x242, 0x0, 0x0, 0x0, 0x0}}},
+		{0xcbbf7d74281a276, nullptr, "#cjmp(#not($cf),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x146, 0x0, 0x0, 0x0, 0x0}}},
+		{0xd3126329ae15de8, nullptr, "#cjmp(#not($cx),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x149, 0x0, 0x0, 0x0, 0x0}}},
+		{0xdf6d590f3167122, nullptr, "#seq(=($zf,1),#rep(#and($rcx,$zf),#seq(#rec[scasd](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23d, 0x0, 0x0, 0x0, 0x0}}},
+		{0xf886b0c836499e8, nullptr, "#seq(=($zf,0),#rep(#and($rcx,#not($zf)),#seq(#rec[cmpsw](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x242, 0x0, 0x0, 0x0, 0x0}}},
+		{0x1066a12116e19aac, nullptr, "#seq(#rec[cmp](#arg[1],#arg[2]),?($df,=($rdi,-($rdi,2)),=($rdi,+($rdi,2))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x200, 0x0, 0x0, 0x0, 0x0}}},
+		{0x14fea6cc0daf7dfa, nullptr, "#cjmp(#not($of),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x153, 0x0, 0x0, 0x0, 0x0}}},
+		{0x158ac548d347c24b, nullptr, "#seq(=($zf,1),#rep(#and($rcx,$zf),#seq(#rec[cmpsb](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23d, 0x0, 0x0, 0x0, 0x0}}},
+		{0x15e590a0ab2bacac, nullptr, "#seq(#rec[cmp](#arg[1],#arg[2]),?($df,=($rdi,-($rdi,8)),=($rdi,+($rdi,8))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1ff, 0x0, 0x0, 0x0, 0x0}}},
+		{0x17f2ea4a07606866, nullptr, "#cjmp(#not($sf),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x156, 0x0, 0x0, 0x0, 0x0}}},
+		{0x188d5f8df93f55b2, nullptr, "#seq(=($zf,0),#rep(#and($rcx,#not($zf)),#seq(#rec[scasb](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x242, 0x0, 0x0, 0x0, 0x0}}},
+		{0x19e2ba41734ca905, nullptr, "#cjmp(#not($pf),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x155, 0x0, 0x0, 0x0, 0x0}}},
+		{0x1a5c6dc63de394da, nullptr, "?($cf,=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x6f, 0x0, 0x0, 0x0, 0x0}}},
+		{0x1a745673ae657df0, nullptr, "#seq(=(#t[1],#rol(#app(#arg[1],$cf),1)),=(#arg[1],#t[1]),=($cf,#t[1][#bsize(#arg[1]),1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1db, 0x0, 0x0, 0x0, 0x0}}},
+		{0x1bf2f0033b91b80e, nullptr, "=(#arg[1],#app(#ext(#f2i(#arg[2][0,64]),32),#ext(#f2i(#arg[2][64,64]),32),#ext(0,64)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xf2, 0x0, 0x0, 0x0, 0x0}}},
+		{0x1c7f448e29133f9f, nullptr, "#rep($rcx,#seq(#rec[lodsb](#arg[1],#arg[2]),=($rcx,-($rcx,1))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x1e0e035dbef5a39b, nullptr, "#cjmp(#and(#not($zf),==($sf,$of)),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x14d, 0x0, 0x0, 0x0, 0x0}}},
+		{0x1e3f8a04d43cfd4f, nullptr, "#cjmp(#not($zf),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x152, 0x0, 0x0, 0x0, 0x0}}},
+		{0x1ee98785c8471e20, nullptr, "=(#arg[1],#app(#fsub(#arg[1][0,64],#arg[2][0,64]),#fadd(#arg[1][64,64],#arg[2][64,64])))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x31, 0x0, 0x0, 0x0, 0x0}}},
+		{0x20083de441b0dbaa, nullptr, "#seq(=(#arg[1],+(#arg[1],#arg[2])),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($cf,#c),=($af,#a))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x12, 0x0, 0x0, 0x0, 0x0}}},
+		{0x210a7ed27f595119, nullptr, "#rep($rcx,#seq(#rec[lodsd](#arg[1],#arg[2]),=($rcx,-($rcx,1))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x2163f0596e8fe96a, nullptr, "#cjmp(#or($cf,$zf),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x147, 0x0, 0x0, 0x0, 0x0}}},
+		{0x27b0defbcf380783, nullptr, "?(#or($zf,<>($sf,$of)),=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x7b, 0x0, 0x0, 0x0, 0x0}}},
+		{0x282d8629737ef6da, nullptr, "#cjmp(#not($rcx),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x15a, 0x0, 0x0, 0x0, 0x0}}},
+		{0x2b54f255e5fb48a5, nullptr, "=(#arg[1],#app(#f2i(#arg[2][0,32]),#arg[1][32]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xec, 0x0, 0x0, 0x0, 0x0}}},
+		{0x2ce2f2ebb8fa2e8d, nullptr, "#cjmp(#not($ecx),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x14c, 0x0, 0x0, 0x0, 0x0}}},
+		{0x2dd649b2d8ccce77, nullptr, "#seq(=(#t[1],$sp),#rec[push]($ax),#rec[push]($cx),#rec[push]($dx),#rec[push]($dx),#rec[push]($bx),#rec[push](#t[1]),#rec[push]($bp),#rec[push]($si),#rec[push]($di))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1d0, 0x0, 0x0, 0x0, 0x0}}},
+		{0x2f7d01cfd9d8531d, "==(#bsize(#arg[1]),16)", "#seq(=(#t[1],*($ax,#arg[1])),=($cf,#c),=($of,#o),=($dx,#t[1][0,16]),=($ax,#t[1][16,16]),#undef($zf,$af,$pf))",
+			{(holodec::IRArgTypes) 7, 1, {0xa4, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x12b, 0x0, 0x0, 0x0, 0x0}}},
+		{0x3192d2a1130e946c, nullptr, "=(#arg[1],#app(#arg[1][24,8],#arg[1][16,8],#arg[1][8,8],#arg[1][0,8]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x54, 0x0, 0x0, 0x0, 0x0}}},
+		{0x32ef76152e5f6944, "==(#bsize(#arg[1]),64)", "=(#arg[1],#app(#arg[2][56,8],#arg[2][48,8],#arg[2][40,8],#arg[2][32,8],#arg[2][24,8],#arg[2][16,8],#arg[2][8,8],#arg[2][0,8]))",
+			{(holodec::IRArgTypes) 7, 1, {0x185, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x18b, 0x0, 0x0, 0x0, 0x0}}},
+		{0x35408fc2413e1e41, nullptr, "?(#not($of),=(#arg[1],#arg[2])) ",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x7e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x356c9f354c1c866c, nullptr, "#seq(#rec[cmp](#arg[1],#arg[2]),?($df,=($rdi,-($rdi,1)),=($rdi,+($rdi,1))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1fd, 0x0, 0x0, 0x0, 0x0}}},
+		{0x37952ae7c9e85ea9, nullptr, "#seq(=(#t[1],#shr(#arg[1],#arg[2])),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($af,#a),=(#arg[1],#t[1]),=($cf,#t[1][#bsize(#arg[1]),1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x221, 0x0, 0x0, 0x0, 0x0}}},
+		{0x38c93a7ffde8ff83, nullptr, "#seq(=(#arg[1],-(#arg[1],1)),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($af,#a))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xf9, 0x0, 0x0, 0x0, 0x0}}},
+		{0x3922596761af2900, nullptr, "#push($st,#fadd(#pop($st),#pop($st)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 1, {0x114, 0x0, 0x0, 0x0, 0x0}}},
+		{0x3b49118b30b17797, nullptr, "=(#arg[1],#not(#or($cf,$zf)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x201, 0x0, 0x0, 0x0, 0x0}}},
+		{0x3b57aa29e4cfe0c5, nullptr, "#seq(=(#arg[1],+(#arg[1],1)),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($af,#a))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x13d, 0x0, 0x0, 0x0, 0x0}}},
+		{0x3bc4aeafa002fd0c, "==(#bsize(#arg[1]),16)", "=(#arg[1],#app(#arg[2][8,8],#arg[2][0,8]))",
+			{(holodec::IRArgTypes) 7, 1, {0xa4, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x180, 0x0, 0x0, 0x0, 0x0}}},
+		{0x3c5f8cf1244854ca, nullptr, "=($st[0],#fmul($st[0],-1))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x10c, 0x0, 0x0, 0x0, 0x0}}},
+		{0x3d1202be9b665596, "==(#bsize(#arg[1]),16)", "#seq(=(#t[1],#app($dx,$ax)),=($ax,#sdiv(#t[1],#arg[1])),=($dx,#smod(#t[1],#arg[1])),#undef($cf,$of,$sf,$zf,$af,$pf))",
+			{(holodec::IRArgTypes) 7, 1, {0xa4, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x11d, 0x0, 0x0, 0x0, 0x0}}},
+		{0x41f89c2653219690, nullptr, "=(#arg[1],#val(#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x15e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x4628cbdaf5cc6558, nullptr, "#seq(=($ecx,-($ecx,1)),#cjmp(#not(#and($ecx,$zf)),#arg[1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x178, 0x0, 0x0, 0x0, 0x0}}},
+		{0x4699a45484a279b6, "==(#bsize(#arg[1]),16)", "#seq(=(#t[1],#app($dx,$ax)),=($eax,#div(#t[1],#arg[1])),=($edx,#mod(#t[1],#arg[1])),#undef($cf,$of,$sf,$zf,$af,$pf))",
+			{(holodec::IRArgTypes) 7, 1, {0xa4, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x103, 0x0, 0x0, 0x0, 0x0}}},
+		{0x4cd352479fd07be5, nullptr, "#seq(=(#t[1],#shl(#arg[1],1)),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($af,#a),=(#arg[1],#t[1]),=($cf,#t[1][#bsize(#arg[1]),1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x213, 0x0, 0x0, 0x0, 0x0}}},
+		{0x4e82480e7f97eca7, nullptr, "#seq(=(#arg[1],+(#arg[1],#arg[2],$cf)),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($cf,#c),=($af,#a))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xf, 0x0, 0x0, 0x0, 0x0}}},
+		{0x52c1a67ed58ccb5b, nullptr, "#seq(=($zf,0),#rep(#and($rcx,#not($zf)),#seq(#rec[cmpsd](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x242, 0x0, 0x0, 0x0, 0x0}}},
+		{0x54a1f366d434b909, nullptr, "#seq(=(#t[1],#arg[1]),#rec[sub](#t[1],#sext(#arg[2],#bsize(#arg[1]))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x88, 0x0, 0x0, 0x0, 0x0}}},
+		{0x560a952c79073578, "==(#bsize(#arg[1]),128)", "=(#arg[1],#app(#arg[2],#arg[2]))",
+			{(holodec::IRArgTypes) 7, 1, {0x18c, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x18e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x57d8eb94ac700c45, nullptr, "#seq(=($ecx,-($ecx,1)),#cjmp(#not($ecx),#arg[1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x174, 0x0, 0x0, 0x0, 0x0}}},
+		{0x58437f9a3c09cc38, nullptr, "=(#arg[1],#sext(#arg[2],#bsize(#arg[1])))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1a3, 0x0, 0x0, 0x0, 0x0}}},
+		{0x589cd359d0912139, "==(#bsize(#arg[1]),32)", "#seq(=(#t[1],*($eax,#arg[1])),=($cf,#c),=($of,#o),=($edx,#t[1][0,32]),=($eax,#t[1][32,32]),#undef($sf,$zf,$af,$pf))",
+			{(holodec::IRArgTypes) 7, 1, {0xa8, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1a9, 0x0, 0x0, 0x0, 0x0}}},
+		{0x58e0ca319cebf80c, nullptr, "#rep($rcx,#seq(#rec[lodsq](#arg[1],#arg[2]),=($rcx,-($rcx,1))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x5921e292651b95c0, nullptr, "#seq(=($cf,<>(#arg[1],0)),=(#arg[1],-(0,#arg[1])),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($af,#a))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1ae, 0x0, 0x0, 0x0, 0x0}}},
+		{0x59a1eabdeefbf88d, nullptr, "=(#arg[1],#app(#f2i(#arg[2][0,32]),#f2i(#arg[2][32,32]),#ext(0,64)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xd2, 0x0, 0x0, 0x0, 0x0}}},
+		{0x5a4c5d0e0383c723, nullptr, "#rep($rcx,#seq(#rec[stosq](#arg[1],#arg[2]),=($rcx,-($rcx,1))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x5a67e828f5053b19, nullptr, "=(#arg[1],#app(#f2i(#arg[2][0,32]),#f2i(#arg[2][32,32]),#f2i(#arg[2][64,32]),#f2i(#arg[2][96,32])))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xda, 0x0, 0x0, 0x0, 0x0}}},
+		{0x5cf225d02374e1b7, nullptr, "=(#arg[1],#app(#fext(#arg[2][0,64],32),#fext(#arg[2][64,64],32)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xd6, 0x0, 0x0, 0x0, 0x0}}},
+		{0x5d9686be90da9253, nullptr, "#cjmp(<>($sf,$of),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x14f, 0x0, 0x0, 0x0, 0x0}}},
+		{0x5db28851baf191d5, "==(#bsize(#arg[1]),32)", "#seq(=($zf,==($eax,#arg[1])),=($cf,#c),=($pf,#p),=($af,#a),=($sf,#s),=($of,#o),?($zf,=(#arg[1],#arg[2]),=($eax,#arg[1])))",
+			{(holodec::IRArgTypes) 7, 1, {0xa8, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xad, 0x0, 0x0, 0x0, 0x0}}},
+		{0x5eaa1fc47c9cd634, nullptr, "=(#arg[1],#app(#arg[2][63],#arg[2][127]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x19a, 0x0, 0x0, 0x0, 0x0}}},
+		{0x5fb27de52a25a3b4, nullptr, "?(#not($zf),=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x7c, 0x0, 0x0, 0x0, 0x0}}},
+		{0x6354e1ae78f4a8b4, nullptr, "=(#arg[1],#shl(#app(#arg[1],#arg[2]),$cl))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x219, 0x0, 0x0, 0x0, 0x0}}},
+		{0x6373092739a883b7, nullptr, "#seq(=(#t[1],#shl(#arg[1],#arg[2])),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($af,#a),=(#arg[1],#t[1]),=($cf,#t[1][#bsize(#arg[1]),1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x216, 0x0, 0x0, 0x0, 0x0}}},
+		{0x63de215cb012bd31, nullptr, "#seq(=(#arg[1],#ld($mem,#arg[2],#size(#arg[2]))),?($df,=($rdi,-($rdi,8)),=($rdi,+($rdi,8))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x16d, 0x0, 0x0, 0x0, 0x0}}},
+		{0x64ecf0a3e70f2fdb, nullptr, "=(#arg[1],#band(#bnot(#arg[1]),#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x41, 0x0, 0x0, 0x0, 0x0}}},
+		{0x67074c2faa3caacb, nullptr, "=(#arg[1],#app(#fadd(#arg[1][0,64],#arg[2][0,64]),#arg[1][64]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x2b, 0x0, 0x0, 0x0, 0x0}}},
+		{0x696434b13915a9a6, nullptr, "=(#arg[1],#pop($stack,#size(#arg[1])))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1b6, 0x0, 0x0, 0x0, 0x0}}},
+		{0x6a8ee73fa025930a, nullptr, "#rec[push]($eflags)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1cb, 0x0, 0x0, 0x0, 0x0}}},
+		{0x6a8ee7441e52789d, nullptr, "#rec[push]($rflags)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1cc, 0x0, 0x0, 0x0, 0x0}}},
+		{0x6af1dd79c82aa300, nullptr, "=(#arg[1],#fadd(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x111, 0x0, 0x0, 0x0, 0x0}}},
+		{0x6b703a83921026ef, nullptr, "#seq(=(#arg[1],#smul(#arg[1],#sext(#arg[2],#bsize(#arg[1])))),=($cf,#c),=($of,#o),#undef($zf,$af,$pf))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x135, 0x0, 0x0, 0x0, 0x0}}},
+		{0x71205393c45a284b, nullptr, "=(#arg[1],#ext(#arg[2],#bsize(#arg[1])))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1a5, 0x0, 0x0, 0x0, 0x0}}},
+		{0x71dbbe58bb5b86e4, nullptr, "=(#arg[1],#rol(#arg[1],1))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1e6, 0x0, 0x0, 0x0, 0x0}}},
+		{0x73a6568f82db7e31, nullptr, "?(#or($cf,$zf),=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x71, 0x0, 0x0, 0x0, 0x0}}},
+		{0x74429d78430a7356, nullptr, "?($of,=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x82, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7455ee3d6392972e, nullptr, "#seq(=($zf,0),#rep(#and($rcx,#not($zf)),#seq(#rec[cmpsq](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x242, 0x0, 0x0, 0x0, 0x0}}},
+		{0x75d1a459dd8c1c0f, nullptr, "#seq(=($ecx,-($ecx,1)),#cjmp(#not(#and($ecx,#not($zf))),#arg[1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x17c, 0x0, 0x0, 0x0, 0x0}}},
+		{0x784871ddcc065da7, nullptr, "#seq(#rec[cmp](#arg[1],#arg[2]),=($rdi,?($df,+($rdi,8),-($rdi,8))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x98, 0x0, 0x0, 0x0, 0x0}}},
+		{0x79fa479d59c82427, nullptr, "#seq(#rec[cmp](#arg[1],#arg[2]),=($rdi,?($df,+($rdi,1),-($rdi,1))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x8e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7a3e3228f545628a, nullptr, "#rep($rcx,#seq(#rec[lodsw](#arg[1],#arg[2]),=($rcx,-($rcx,1))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7a4a3840747821cd, nullptr, "#seq(#rec[pop]($di),#rec[pop]($si),#rec[pop]($bp),=($esp,+($esp,2)),#rec[pop]($bx),#rec[pop]($dx),#rec[pop]($cx),#rec[pop]($ax))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1c0, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7abfaa10276df087, nullptr, "?(#and($cf,$zf),=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x6d, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7c6246e71adda8ec, nullptr, "#seq(=(#arg[1],-(#arg[1],#arg[2])),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($cf,#c),=($af,#a))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x230, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7cf1867d43a16622, nullptr, "#seq(=($cf,#arg[1][#arg[2]]),=(#arg[1][#arg[2]],0))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x5b, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7cf1867d43a17263, nullptr, "#seq(=($cf,#arg[1][#arg[2]]),=(#arg[1][#arg[2]],1))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x5d, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7d115e247977bc46, nullptr, "=($dx,#sext($ax,#bsize($dx)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xf4, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7dd220877680a119, nullptr, "=(#arg[1],#app(#fext(#arg[2][0,64],32),#arg[1][32]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xe3, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7ec8a7b8ee3858e4, nullptr, "#seq(=($zf,1),#rep(#and($rcx,$zf),#seq(#rec[scasb](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23d, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7f2d0c8bceccb00e, nullptr, "#seq(#rec[pop]($edi),#rec[pop]($esi),#rec[pop]($ebp),=($esp,+($esp,4)),#rec[pop]($ebx),#rec[pop]($edx),#rec[pop]($ecx),#rec[pop]($eax))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1c9, 0x0, 0x0, 0x0, 0x0}}},
+		{0x7f70c9ce5a39582d, nullptr, "?(#not($cf),=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x6e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x80a10f6a21ec0163, nullptr, "#syscall(#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x13e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x82a03b63ff4beaa5, nullptr, "=(#arg[1],#app(#arg[2][32,32],#arg[2][32,32],#arg[2][96,32],#arg[2][96,32]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1a0, 0x0, 0x0, 0x0, 0x0}}},
+		{0x8502956d9a3d21ef, nullptr, "#seq(=(#t[1],#arg[1]),=(#arg[1],#arg[2]),=(#arg[2],#t[1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x235, 0x0, 0x0, 0x0, 0x0}}},
+		{0x855ed4cd0886617c, nullptr, "=(#arg[1],#not($cf))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x202, 0x0, 0x0, 0x0, 0x0}}},
+		{0x855ed4cd088b90f0, nullptr, "=(#arg[1],#not($of))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x20b, 0x0, 0x0, 0x0, 0x0}}},
+		{0x855ed4cd088cf705, nullptr, "=(#arg[1],#not($zf))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x20a, 0x0, 0x0, 0x0, 0x0}}},
+		{0x855ed4cd088d2b6c, nullptr, "=(#arg[1],#not($sf))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x20d, 0x0, 0x0, 0x0, 0x0}}},
+		{0x855ed4cd088db0cf, nullptr, "=(#arg[1],#not($pf))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x20c, 0x0, 0x0, 0x0, 0x0}}},
+		{0x870efa1928f8b0af, nullptr, "#rec[push]($flags)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1ca, 0x0, 0x0, 0x0, 0x0}}},
+		{0x898729b5f420bb74, nullptr, "#seq(=($zf,0),#rep(#and($rcx,#not($zf)),#seq(#rec[scasd](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x242, 0x0, 0x0, 0x0, 0x0}}},
+		{0x899b56968c3e29f9, nullptr, "#seq(=($zf,==(#app($eax,$edx),#arg[1])),?($zf,=(#arg[1],#app($ebx,$ecx)),#seq(=($eax,#arg[1][0,32]),=($edx,#arg[1][32,32]))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xc1, 0x0, 0x0, 0x0, 0x0}}},
+		{0x8a173dd59426347b, nullptr, "#seq(=(#t[1],#shr(#arg[1],1)),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($af,#a),=(#arg[1],#t[1]),=($cf,#t[1][#bsize(#arg[1]),1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x21e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x8ab95e324eaea9b8, nullptr, "#cjmp($zf,#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x14a, 0x0, 0x0, 0x0, 0x0}}},
+		{0x8abd0a55d382fd0c, nullptr, "#rec[pop]($rflags)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1cc, 0x0, 0x0, 0x0, 0x0}}},
+		{0x8abd0a592f8f939b, nullptr, "#rec[pop]($eflags)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1cb, 0x0, 0x0, 0x0, 0x0}}},
+		{0x8ae227af03f0f232, nullptr, "#cjmp($pf,#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x158, 0x0, 0x0, 0x0, 0x0}}},
+		{0x8ae9ef2ab1916df1, nullptr, "#cjmp($sf,#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x15b, 0x0, 0x0, 0x0, 0x0}}},
+		{0x8b010cf0417204ed, nullptr, "#cjmp($of,#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x157, 0x0, 0x0, 0x0, 0x0}}},
+		{0x8d07b2a364cb1fb6, nullptr, "=(#arg[1],#rol(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1e8, 0x0, 0x0, 0x0, 0x0}}},
+		{0x8d36f526d4c9a3fd, nullptr, "=(#arg[1],#app(#shl(#arg[1],#arg[2]),#arg[3]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x21b, 0x0, 0x0, 0x0, 0x0}}},
+		{0x8e02279a35390cbc, nullptr, "#seq(=(#t[1],#ror(#app(#arg[1],$cf),#arg[2])),=(#arg[1],#t[1]),=($cf,#t[1][#bsize(#arg[1]),1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1e4, 0x0, 0x0, 0x0, 0x0}}},
+		{0x91934dc34392a3bf, nullptr, "=(#arg[1],#bnot(#arg[1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1b0, 0x0, 0x0, 0x0, 0x0}}},
+		{0x91cd381c3cd47b26, nullptr, "#seq(#rec[xchg](#arg[1],#arg[2]),#rec[add](#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x233, 0x0, 0x0, 0x0, 0x0}}},
+		{0x94f10206f55af151, "==(#bsize(#arg[1]),128)", "=(#arg[1],#app(#arg[2],#arg[1][64,64]))",
+			{(holodec::IRArgTypes) 7, 1, {0x18c, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x193, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9525437f3affaba0, nullptr, "=(#arg[1],#bxor(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1d4, 0x0, 0x0, 0x0, 0x0}}},
+		{0x95539c13febca640, nullptr, "#push($stack,#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 1, {0x1cd, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9730d2091ca79b3b, nullptr, "=(#arg[1],$sf)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x210, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9730d2091ca7a0b8, nullptr, "=(#arg[1],$pf)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x20f, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9730d2091ca7b932, nullptr, "=(#arg[1],$zf)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x205, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9730d2091ca7c72b, nullptr, "=(#arg[1],$cf)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x203, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9730d2091ca7e927, nullptr, "=(#arg[1],$of)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x20e, 0x0, 0x0, 0x0, 0x0}}},
+		{0x985ca50a70a0b04c, nullptr, "#seq(=(#t[1],#sal(#arg[1],1)),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($af,#a),=(#arg[1],#t[1]),=($cf,#t[1][#bsize(#arg[1]),1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1f0, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9a38a74e27d343a8, nullptr, "?(<>($sf,$of),=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x79, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9a98462ba1729eca, nullptr, "?($sf,=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x83, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9b099f239fd924f8, nullptr, "#seq(=($zf,1),#rep(#and($rcx,$zf),#seq(#rec[cmpsq](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23d, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9b23c337ec9d2bab, nullptr, "#seq(=(#arg[1],+(#arg[1],#arg[2],$of)),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($cf,#c),=($af,#a))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x38, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9beefda1a2e56599, nullptr, "=($eflags,$ah)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1ed, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9c07491528849619, nullptr, "=($ah,$eflags)",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x15c, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9d5c1e71dc9ea831, nullptr, "#seq(=(#arg[1],#ld($mem,#arg[2],#size(#arg[2]))),?($df,=($rdi,-($rdi,4)),=($rdi,+($rdi,4))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x169, 0x0, 0x0, 0x0, 0x0}}},
+		{0x9f95abd272badc2a, nullptr, "#seq(#st($mem,#arg[2],#arg[1]),?($df,=($rdi,-($rdi,1)),=($rdi,+($rdi,1))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x22a, 0x0, 0x0, 0x0, 0x0}}},
+		{0xa48024eff8e77c11, nullptr, "#seq(=($zf,1),#rep(#and($rcx,$zf),#seq(#rec[scasw](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23d, 0x0, 0x0, 0x0, 0x0}}},
+		{0xa6de0ec1687876cf, nullptr, "#jmp(#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x151, 0x0, 0x0, 0x0, 0x0}}},
+		{0xa86f63dd06347f85, nullptr, "=(#arg[1],#app(#fadd(#arg[1][0,64],#arg[2][0,64]),#fadd(#arg[1][64,64],#arg[2][64,64])))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1a, 0x0, 0x0, 0x0, 0x0}}},
+		{0xab68707a6894617a, nullptr, "=(#arg[1],#ror(#arg[1],1))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1ea, 0x0, 0x0, 0x0, 0x0}}},
+		{0xafa27099b43adf31, nullptr, "#seq(=(#arg[1],#ld($mem,#arg[2],#size(#arg[2]))),?($df,=($rdi,-($rdi,2)),=($rdi,+($rdi,2))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x171, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb008af03138173b8, nullptr, "=(#arg[1],#bor(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1b2, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb026c59b6b22bbe1, nullptr, "#seq(=(#arg[1],-(#arg[1],#arg[2],$cf)),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($cf,#c),=($af,#a))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1fc, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb0b1efbbfacb8aa7, nullptr, "#seq(#rec[cmp](#arg[1],#arg[2]),=($rdi,?($df,+($rdi,4),-($rdi,4))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x93, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb0fd8a671628bbd1, nullptr, "=(#arg[1],#and(#not($zf),==($sf,$of)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x206, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb1266c5f42e65f55, nullptr, "=($eax,#ext($ax,#bsize($eax)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xf6, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb19121565ef3f3ba, nullptr, "#seq(=($zf,==(#app($rax,$rdx),#arg[1])),?($zf,=(#arg[1],#app($rbx,$rcx)),#seq(=($rax,#arg[1][0,64]),=($rdx,#arg[1][64,64]))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xb7, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb460d6db7e225447, nullptr, "#seq(=(#arg[1],#fadd(#arg[1],#arg[2])),#pop($st))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x115, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb51d1303cc8bff9d, nullptr, "=($cf,#not($cf))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x6a, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb67b5af16088d28c, "==(#bsize(#arg[1]),32)", "#seq(=(#t[1],#app($edx,$eax)),=($eax,#div(#t[1],#arg[1])),=($edx,#mod(#t[1],#arg[1])),#undef($cf,$of,$sf,$zf,$af,$pf))",
+			{(holodec::IRArgTypes) 7, 1, {0xa8, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x106, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb6ccc10c72abee74, nullptr, "#seq(=(#arg[1],#bxor(#arg[1],#arg[2])),=($of,0),=($cf,0),=($sf,#s),=($zf,#z),=($pf,#p))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x236, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb75f9f54dc11718a, "==(#bsize(#arg[1]),8)", "#seq(=($ax,*($al,#arg[1])),=($cf,#c),=($of,#o),#undef($sf,$zf,$af,$pf))",
+			{(holodec::IRArgTypes) 7, 1, {0x9e, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1a7, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb7903ee88fb14865, nullptr, "=(#arg[1],#app(#fsub(#arg[1][0,32],#arg[2][0,32]),#fadd(#arg[1][32,32],#arg[2][32,32]),#fsub(#arg[1][64,32],#arg[2][64,32]),#fadd(#arg[1][96,32],#arg[2][96,32])))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x35, 0x0, 0x0, 0x0, 0x0}}},
+		{0xb9cd8e829afcf894, nullptr, "=($rdx,#sext($rax,#bsize($rdx)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xc3, 0x0, 0x0, 0x0, 0x0}}},
+		{0xbb6104c3c90cef6a, nullptr, "#seq(#st($mem,#arg[2],#arg[1]),?($df,=($rdi,-($rdi,2)),=($rdi,+($rdi,2))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x22d, 0x0, 0x0, 0x0, 0x0}}},
+		{0xbc04b17a41de7fa5, nullptr, "#rep($rcx,#seq(#rec[stosw](#arg[1],#arg[2]),=($rcx,-($rcx,1))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23e, 0x0, 0x0, 0x0, 0x0}}},
+		{0xbc21aa4e4f3c9c3d, nullptr, "?(#not($sf),=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x81, 0x0, 0x0, 0x0, 0x0}}},
+		{0xbc4acd2f323ae522, nullptr, "#seq(=(#t[1],#rol(#app(#arg[1],$cf),#arg[2])),=(#arg[1],#t[1]),=($cf,#t[1][#bsize(#arg[1]),1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1de, 0x0, 0x0, 0x0, 0x0}}},
+		{0xbd9b27fe1b3974c8, nullptr, "=(#arg[1],#app(#i2f(#arg[2][0,32],64),#arg[1][64]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xe6, 0x0, 0x0, 0x0, 0x0}}},
+		{0xbdb162b49523976a, nullptr, "#seq(#st($mem,#arg[2],#arg[1]),?($df,=($rdi,-($rdi,4)),=($rdi,+($rdi,4))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x22b, 0x0, 0x0, 0x0, 0x0}}},
+		{0xbdd9c215d4a36568, nullptr, "#ret(#pop($stack,8))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x141, 0x0, 0x0, 0x0, 0x0}}},
+		{0xbded44dcbd3cb004, "==(#bsize(#arg[1]),32)", "#seq(=(#t[1],*($eax,#arg[1])),=($cf,#c),=($of,#o),=($edx,#t[1][0,32]),=($eax,#t[1][32,32]),#undef($zf,$af,$pf))",
+			{(holodec::IRArgTypes) 7, 1, {0xa8, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x132, 0x0, 0x0, 0x0, 0x0}}},
+		{0xc1aa280a910b7ba8, nullptr, "=(#arg[1],#ror(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1ec, 0x0, 0x0, 0x0, 0x0}}},
+		{0xc201dd2b40a78a57, nullptr, "#seq(=($zf,1),#rep(#and($rcx,$zf),#seq(#rec[scasq](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23d, 0x0, 0x0, 0x0, 0x0}}},
+		{0xc2c1180c2dd9d9f1, nullptr, "#cjmp(==($sf,$of),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x14e, 0x0, 0x0, 0x0, 0x0}}},
+		{0xc2d06d55dcc225ee, nullptr, "#seq(=(#t[1],#ror(#app(#arg[1],$cf),1)),=(#arg[1],#t[1]),=($cf,#t[1][#bsize(#arg[1]),1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1e1, 0x0, 0x0, 0x0, 0x0}}},
+		{0xc78f036d6dbe2669, nullptr, "?($pf,=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x7f, 0x0, 0x0, 0x0, 0x0}}},
+		{0xc7ea4ceef158d43b, "==(#bsize(#arg[1]),16)", "#seq(=($zf,==($al,#arg[1])),=($cf,#c),=($pf,#p),=($af,#a),=($sf,#s),=($of,#o),?($zf,=(#arg[1],#arg[2]),=($ax,#arg[1])))",
+			{(holodec::IRArgTypes) 7, 1, {0xa4, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xa7, 0x0, 0x0, 0x0, 0x0}}},
+		{0xc81c5ebc27c00bce, nullptr, "=(#arg[1],#band(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x3a, 0x0, 0x0, 0x0, 0x0}}},
+		{0xca2398866b554414, nullptr, "=(#arg[1],#app(#fext(#i2f(#arg[2][0,32]),64),#fext(#i2f(#arg[2][32,32]),64)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xc9, 0x0, 0x0, 0x0, 0x0}}},
+		{0xca413de4642828c8, nullptr, "=(#arg[1],#app(#fadd(#arg[1][0,32],#arg[2][0,32]),#arg[1][32]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x2e, 0x0, 0x0, 0x0, 0x0}}},
+		{0xcaab97b5e4b99ab7, "==(#bsize(#arg[1]),8)", "#seq(=($ax,*($al,#arg[1])),=($cf,#c),=($of,#o),#undef($zf,$af,$pf))",
+			{(holodec::IRArgTypes) 7, 1, {0x9e, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x124, 0x0, 0x0, 0x0, 0x0}}},
+		{0xcacf6befeff9f1e0, "==(#bsize(#arg[1]),16)", "#seq(=(#t[1],*($ax,#arg[1])),=($cf,#c),=($of,#o),=($dx,#t[1][0,16]),=($ax,#t[1][16,16]),#undef($sf,$zf,$af,$pf))",
+			{(holodec::IRArgTypes) 7, 1, {0xa4, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1a8, 0x0, 0x0, 0x0, 0x0}}},
+		{0xcbbfcd8b0a8ce271, nullptr, "#seq(=(#arg[1],#ld($mem,#arg[2],#size(#arg[2]))),?($df,=($rdi,-($rdi,1)),=($rdi,+($rdi,1))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x165, 0x0, 0x0, 0x0, 0x0}}},
+		{0xcc7081eab2b3cdf1, "==(#bsize(#arg[1]),8)", "#seq(=(#t[1],$ax),=($al,#sdiv(#t[1],#arg[1])),=($ah,#smod(#t[1],#arg[1])),#undef($cf,$of,$sf,$zf,$af,$pf))",
+			{(holodec::IRArgTypes) 7, 1, {0x9e, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x11a, 0x0, 0x0, 0x0, 0x0}}},
+		{0xccb1a8f9e1304aea, nullptr, "#seq(#pop($stack,#arg[1]),#ret(#pop($stack,8)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x143, 0x0, 0x0, 0x0, 0x0}}},
+		{0xcda85c6666d6a90d, nullptr, "#seq(=($zf,1),#rep(#and($rcx,$zf),#seq(#rec[cmpsd](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23d, 0x0, 0x0, 0x0, 0x0}}},
+		{0xcfa1e1777a4b31a5, nullptr, "=(#arg[1],#app(#fadd(#arg[1][0,32],#arg[2][0,32]),#fadd(#arg[1][32,32],#arg[2][32,32]),#fadd(#arg[1][64,32],#arg[2][64,32]),#fadd(#arg[1][96,32],#arg[2][96,32])))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x28, 0x0, 0x0, 0x0, 0x0}}},
+		{0xd0fa94a2a78e48d2, nullptr, "#seq(=(#t[1],#sar(#arg[1],1)),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($af,#a),=(#arg[1],#t[1]),=($cf,#t[1][#bsize(#arg[1]),1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1f6, 0x0, 0x0, 0x0, 0x0}}},
+		{0xd20747368b9914aa, nullptr, "=(#arg[1],#shr(#app(#arg[1],#arg[2]),$cl))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x223, 0x0, 0x0, 0x0, 0x0}}},
+		{0xd4cb32eb018cf889, nullptr, "=(#arg[1],#arg[2])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x6c, 0x0, 0x0, 0x0, 0x0}}},
+		{0xd59ab65c0081e06a, nullptr, "#seq(#st($mem,#arg[2],#arg[1]),?($df,=($rdi,-($rdi,8)),=($rdi,+($rdi,8))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x22c, 0x0, 0x0, 0x0, 0x0}}},
+		{0xd7c5e796cb0efe03, nullptr, "=($rax,#sext($eax,#bsize($rax)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x66, 0x0, 0x0, 0x0, 0x0}}},
+		{0xd8fd5d806725a6da, nullptr, "#seq(=(#t[1],#band(#arg[1],#arg[2])),=($cf,0),=($of,0),=($pf,#p),=($zf,#z),=($sf,#s))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x232, 0x0, 0x0, 0x0, 0x0}}},
+		{0xd90186ca4bab7633, nullptr, "#seq(#push($stack,#ip),#call(#arg[1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x60, 0x0, 0x0, 0x0, 0x0}}},
+		{0xda2f4113e3e78bcb, nullptr, "=(#arg[1],#app(#f2i(#arg[2][0,64],32),#arg[1][32]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xe1, 0x0, 0x0, 0x0, 0x0}}},
+		{0xdb7c88613c1edd60, nullptr, "?(#and(#not($zf),==($sf,$of)),=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x76, 0x0, 0x0, 0x0, 0x0}}},
+		{0xdb7da31c44f65394, nullptr, "=(#arg[1],#app(#fext(#arg[2][0,32],64),#fext(#arg[2][32,32],64)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xde, 0x0, 0x0, 0x0, 0x0}}},
+		{0xdb8760ad6b852843, nullptr, "=($edx,#sext($eax,#bsize($edx)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x64, 0x0, 0x0, 0x0, 0x0}}},
+		{0xdc679b8b7e5fb1ac, nullptr, "#seq(#rec[cmp](#arg[1],#arg[2]),?($df,=($rdi,-($rdi,4)),=($rdi,+($rdi,4))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1fe, 0x0, 0x0, 0x0, 0x0}}},
+		{0xdd3a9d06340398f2, nullptr, "=($ax,#sext($al,#bsize($ax)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x62, 0x0, 0x0, 0x0, 0x0}}},
+		{0xde8e8e6517f4fd10, "==(#bsize(#arg[1]),8)", "#seq(=(#t[1],$ax),=($eax,#div(#t[1],#arg[1])),=($edx,#mod(#t[1],#arg[1])),#undef($cf,$of,$sf,$zf,$af,$pf))",
+			{(holodec::IRArgTypes) 7, 1, {0x9e, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x100, 0x0, 0x0, 0x0, 0x0}}},
+		{0xde982f1f61c93240, nullptr, "#seq(=($cf,#arg[1][#arg[2]]),=(#arg[1][#arg[2]],#not(#arg[1][#arg[2]])))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x59, 0x0, 0x0, 0x0, 0x0}}},
+		{0xdf01a61ba76966a3, nullptr, "?($zf,=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x72, 0x0, 0x0, 0x0, 0x0}}},
+		{0xe0ea8584ef26885d, nullptr, "#cjmp(#not(#or($cf,$zf)),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x145, 0x0, 0x0, 0x0, 0x0}}},
+		{0xe0fcfb491a8be36c, nullptr, "#seq(=(#arg[1],#bor(#arg[1],#arg[2])),=($of,0),=($cf,0),=($sf,#s),=($zf,#z),=($pf,#p))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1b3, 0x0, 0x0, 0x0, 0x0}}},
+		{0xe4115b69cb066432, nullptr, "#seq(=(#t[1],$esp),#rec[push]($eax),#rec[push]($ecx),#rec[push]($edx),#rec[push]($edx),#rec[push]($ebx),#rec[push](#t[1]),#rec[push]($ebp),#rec[push]($esi),#rec[push]($edi))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1d2, 0x0, 0x0, 0x0, 0x0}}},
+		{0xe4a7692c46518da7, "==(#bsize(#arg[1]),64)", "=(#arg[1],#app(#arg[2][0,64],#arg[2][0,64]))",
+			{(holodec::IRArgTypes) 7, 1, {0x185, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x190, 0x0, 0x0, 0x0, 0x0}}},
+		{0xe64ba7e579a12aac, "==(#bsize(#arg[1]),32)", "#seq(=(#t[1],#app($edx,$eax)),=($eax,#sdiv(#t[1],#arg[1])),=($edx,#smod(#t[1],#arg[1])),#undef($cf,$of,$sf,$zf,$af,$pf))",
+			{(holodec::IRArgTypes) 7, 1, {0xa8, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x120, 0x0, 0x0, 0x0, 0x0}}},
+		{0xe680999fdf8ecc81, nullptr, "#seq(=($zf,0),#rep(#and($rcx,#not($zf)),#seq(#rec[scasq](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x242, 0x0, 0x0, 0x0, 0x0}}},
+		{0xe7d87ec33f522ea5, nullptr, "=(#arg[1],#app(#arg[2][0,32],#arg[2][0,32],#arg[2][64,32],#arg[2][64,32]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1a2, 0x0, 0x0, 0x0, 0x0}}},
+		{0xe89843d27f418e58, nullptr, "#cjmp(#or($zf,<>($sf,$of)),#arg[1])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x150, 0x0, 0x0, 0x0, 0x0}}},
+		{0xe9050fa9338402ca, nullptr, "?(==($sf,$of),=(#arg[1],#arg[2]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x77, 0x0, 0x0, 0x0, 0x0}}},
+		{0xea7da1cf2e75a2a7, nullptr, "#seq(#rec[cmp](#arg[1],#arg[2]),=($rdi,?($df,+($rdi,2),-($rdi,2))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x9d, 0x0, 0x0, 0x0, 0x0}}},
+		{0xed2a6651da381d36, nullptr, "#rep($rcx,#seq(#rec[stosd](#arg[1],#arg[2]),=($rcx,-($rcx,1))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23e, 0x0, 0x0, 0x0, 0x0}}},
+		{0xeed2baf8750b5700, nullptr, "#seq(=(#t[1],#sar(#arg[1],#arg[2])),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($af,#a),=(#arg[1],#t[1]),=($cf,#t[1][#bsize(#arg[1]),1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1f9, 0x0, 0x0, 0x0, 0x0}}},
+		{0xeed338e104ee4b4d, nullptr, "#seq(=(#arg[1],#smul(#arg[1],#sext(#arg[3],#bsize(#arg[2])))),=($cf,#c),=($of,#o),#undef($zf,$af,$pf))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x13a, 0x0, 0x0, 0x0, 0x0}}},
+		{0xef6939d3737b5b1e, "==(#bsize(#arg[1]),8)", "#seq(=($zf,==($al,#arg[1])),=($cf,#c),=($pf,#p),=($af,#a),=($sf,#s),=($of,#o),?($zf,=(#arg[1],#arg[2]),=($al,#arg[1])))",
+			{(holodec::IRArgTypes) 7, 1, {0x9e, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xa3, 0x0, 0x0, 0x0, 0x0}}},
+		{0xefe4be059860fe99, nullptr, "=(#arg[1],<>($sf,$of))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x208, 0x0, 0x0, 0x0, 0x0}}},
+		{0xf03cabbb7803a76e, nullptr, "=($cf,#arg[1][#arg[2]])",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x56, 0x0, 0x0, 0x0, 0x0}}},
+		{0xf03e8ed986f19a1e, nullptr, "#seq(=(#t[1],#sal(#arg[1],#arg[2])),=($zf,#z),=($pf,#p),=($sf,#s),=($of,#o),=($af,#a),=(#arg[1],#t[1]),=($cf,#t[1][#bsize(#arg[1]),1]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x1f3, 0x0, 0x0, 0x0, 0x0}}},
+		{0xf1f3f27e40d218bb, nullptr, "=(#arg[1],==($sf,$of))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x207, 0x0, 0x0, 0x0, 0x0}}},
+		{0xf2660cca03ff9ac1, "==(#bsize(#arg[1]),64)", "=(#arg[1],#arg[2][64,64])",
+			{(holodec::IRArgTypes) 7, 1, {0x185, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x191, 0x0, 0x0, 0x0, 0x0}}},
+		{0xf27d6f4d3100f552, nullptr, "=(#arg[1],#or($zf,<>($sf,$of)))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x209, 0x0, 0x0, 0x0, 0x0}}},
+		{0xf30ac2cb769b0d60, nullptr, "=(#arg[1],#or($cf,$zf))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x204, 0x0, 0x0, 0x0, 0x0}}},
+		{0xf5bab1b778d29417, "==(#bsize(#arg[1]),32)", "=(#arg[1],#app(#arg[2][24,8],#arg[2][16,8],#arg[2][8,8],#arg[2][0,8]))",
+			{(holodec::IRArgTypes) 7, 1, {0xa8, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x184, 0x0, 0x0, 0x0, 0x0}}},
+		{0xf5e8d1a5316739b2, nullptr, "=($st[0],#fadd($st[0],#fext(#arg[1],#bsize($st[0]))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x10f, 0x0, 0x0, 0x0, 0x0}}},
+		{0xf6241315d232ab26, nullptr, "#seq(#rec[mov]($esp,$ebp),#rec[pop]($ebp))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x160, 0x0, 0x0, 0x0, 0x0}}},
+		{0xf7a5ba1b60c2ac6a, nullptr, "#seq(=(#t[1],#ld($mem,#arg[2],#size(#arg[2]))),=(#t[2],#ld($mem,+(#arg[2],#size(#arg[1])),#size(#arg[1]))),?(#or(<(#arg[1],#t[1]),>(#arg[1],#t[2])),#trap))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x4e, 0x0, 0x0, 0x0, 0x0}}},
+		{0xf9702708c8ad6946, nullptr, "=(#arg[1],#app(#arg[1][0,64],#arg[2][0,64]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x195, 0x0, 0x0, 0x0, 0x0}}},
+		{0xfcc5de708e2315a3, nullptr, "=(#arg[1],#app(#shr(#arg[1],#arg[2]),#arg[3]))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x225, 0x0, 0x0, 0x0, 0x0}}},
+		{0xfec0b991070e6819, nullptr, "=(#arg[1],#app(#i2f(#arg[2][0,32]),#i2f(#arg[2][32,32]),#i2f(#arg[2][64,32]),#i2f(#arg[2][96,32])))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0xcd, 0x0, 0x0, 0x0, 0x0}}},
+		{0xffab8720a373ee8b, nullptr, "#seq(=(#arg[1],#band(#arg[1],#arg[2])),=($of,0),=($cf,0),=($sf,#s),=($zf,#z),=($pf,#p),#undef($af))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x3e, 0x0, 0x0, 0x0, 0x0}}},
+		{0xffd512548047323e, nullptr, "#seq(=($zf,1),#rep(#and($rcx,$zf),#seq(#rec[cmpsw](#arg[1],#arg[2]),=($rcx,-($rcx,1)))))",
+			{(holodec::IRArgTypes) 0, 0, {0x0, 0x0, 0x0, 0x0, 0x0}}, {(holodec::IRArgTypes) 7, 0, {0x23d, 0x0, 0x0, 0x0, 0x0}}},
+	};
+
+	extern const holodec::IRTables x86irtables;
+	const holodec::IRTables x86irtables = {
+		1,
+		0xbec336631d9df868,
+		expressions, 578,
+		arguments, 1366,
+		entries, 236
+	};
+}
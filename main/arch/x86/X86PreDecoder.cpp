@@ -0,0 +1,322 @@
+#include "X86PreDecoder.h"
+
+#include <initializer_list>
+
+namespace holox86 {
+
+	enum X86PreImm : uint8_t {
+		X86_PREIMM_NONE = 0,
+		X86_PREIMM_8,
+		X86_PREIMM_16,
+		X86_PREIMM_Z,		//16 or 32 bit depending on the operand size
+		X86_PREIMM_V,		//16, 32 or 64 bit depending on the operand size
+		X86_PREIMM_MOFFS,	//address sized
+		X86_PREIMM_16_8,	//enter
+		X86_PREIMM_REL8,
+		X86_PREIMM_REL32,
+		X86_PREIMM_GROUP3,	//f6/f7 only have an immediate for /0 and /1
+		X86_PREIMM_32,
+	};
+
+	struct X86PreOpcode {
+		bool valid;
+		bool modrm;
+		X86PreImm imm;
+		X86Flow flow;
+	};
+
+	struct X86PreTables {
+		X86PreOpcode onebyte[256];
+		X86PreOpcode twobyte[256];
+
+		X86PreTables() {
+			for (int i = 0; i < 256; i++) {
+				onebyte[i] = {true, false, X86_PREIMM_NONE, X86Flow::eNone};
+				twobyte[i] = {true, true, X86_PREIMM_NONE, X86Flow::eNone};
+			}
+			//alu block 00-3f
+			for (int i = 0; i < 0x40; i++) {
+				switch (i & 0x7) {
+				case 0: case 1: case 2: case 3:
+					onebyte[i].modrm = true;
+					break;
+				case 4:
+					onebyte[i].imm = X86_PREIMM_8;
+					break;
+				case 5:
+					onebyte[i].imm = X86_PREIMM_Z;
+					break;
+				default://push/pop segment, daa, das, aaa, aas
+					onebyte[i].valid = false;
+					break;
+				}
+			}
+			onebyte[0x0F].valid = true;//escape
+			for (uint8_t op : {0x60, 0x61, 0x82, 0x9A, 0xCE, 0xD4, 0xD5, 0xD6, 0xEA})
+				onebyte[op].valid = false;
+			onebyte[0x63].modrm = true;
+			onebyte[0x68].imm = X86_PREIMM_Z;
+			onebyte[0x69] = {true, true, X86_PREIMM_Z, X86Flow::eNone};
+			onebyte[0x6A].imm = X86_PREIMM_8;
+			onebyte[0x6B] = {true, true, X86_PREIMM_8, X86Flow::eNone};
+			for (int i = 0x70; i < 0x80; i++)
+				onebyte[i] = {true, false, X86_PREIMM_REL8, X86Flow::eCJmp};
+			onebyte[0x80] = {true, true, X86_PREIMM_8, X86Flow::eNone};
+			onebyte[0x81] = {true, true, X86_PREIMM_Z, X86Flow::eNone};
+			onebyte[0x83] = {true, true, X86_PREIMM_8, X86Flow::eNone};
+			for (int i = 0x84; i < 0x90; i++)
+				onebyte[i].modrm = true;
+			for (int i = 0xA0; i < 0xA4; i++)
+				onebyte[i].imm = X86_PREIMM_MOFFS;
+			onebyte[0xA8].imm = X86_PREIMM_8;
+			onebyte[0xA9].imm = X86_PREIMM_Z;
+			for (int i = 0xB0; i < 0xB8; i++)
+				onebyte[i].imm = X86_PREIMM_8;
+			for (int i = 0xB8; i < 0xC0; i++)
+				onebyte[i].imm = X86_PREIMM_V;
+			onebyte[0xC0] = {true, true, X86_PREIMM_8, X86Flow::eNone};
+			onebyte[0xC1] = {true, true, X86_PREIMM_8, X86Flow::eNone};
+			onebyte[0xC2] = {true, false, X86_PREIMM_16, X86Flow::eRet};
+			onebyte[0xC3] = {true, false, X86_PREIMM_NONE, X86Flow::eRet};
+			onebyte[0xC6] = {true, true, X86_PREIMM_8, X86Flow::eNone};
+			onebyte[0xC7] = {true, true, X86_PREIMM_Z, X86Flow::eNone};
+			onebyte[0xC8].imm = X86_PREIMM_16_8;
+			onebyte[0xCA] = {true, false, X86_PREIMM_16, X86Flow::eRet};
+			onebyte[0xCB] = {true, false, X86_PREIMM_NONE, X86Flow::eRet};
+			onebyte[0xCC].flow = X86Flow::eTrap;
+			onebyte[0xCD].imm = X86_PREIMM_8;
+			onebyte[0xCF].flow = X86Flow::eRet;
+			for (int i = 0xD0; i < 0xD4; i++)
+				onebyte[i].modrm = true;
+			for (int i = 0xD8; i < 0xE0; i++)
+				onebyte[i].modrm = true;
+			for (int i = 0xE0; i < 0xE4; i++)
+				onebyte[i] = {true, false, X86_PREIMM_REL8, X86Flow::eCJmp};
+			for (int i = 0xE4; i < 0xE8; i++)
+				onebyte[i].imm = X86_PREIMM_8;
+			onebyte[0xE8] = {true, false, X86_PREIMM_REL32, X86Flow::eCall};
+			onebyte[0xE9] = {true, false, X86_PREIMM_REL32, X86Flow::eJmp};
+			onebyte[0xEB] = {true, false, X86_PREIMM_REL8, X86Flow::eJmp};
+			onebyte[0xF1].flow = X86Flow::eTrap;
+			onebyte[0xF4].flow = X86Flow::eTrap;
+			onebyte[0xF6] = {true, true, X86_PREIMM_GROUP3, X86Flow::eNone};
+			onebyte[0xF7] = {true, true, X86_PREIMM_GROUP3, X86Flow::eNone};
+			onebyte[0xFE].modrm = true;
+			onebyte[0xFF].modrm = true;
+
+			//0f xx
+			for (uint8_t op : {0x05, 0x06, 0x07, 0x08, 0x09, 0x0B, 0x0E, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x37, 0x77, 0xA0, 0xA1, 0xA2, 0xA8, 0xA9, 0xAA})
+				twobyte[op].modrm = false;
+			for (int i = 0xC8; i < 0xD0; i++)
+				twobyte[i].modrm = false;
+			for (uint8_t op : {0x04, 0x0A, 0x0C, 0x24, 0x25, 0x26, 0x27, 0x36, 0x39, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x7A, 0x7B, 0xA6, 0xA7})
+				twobyte[op].valid = false;
+			for (uint8_t op : {0x0F, 0x70, 0x71, 0x72, 0x73, 0xA4, 0xAC, 0xBA, 0xC2, 0xC4, 0xC5, 0xC6})
+				twobyte[op].imm = X86_PREIMM_8;
+			for (int i = 0x80; i < 0x90; i++)
+				twobyte[i] = {true, false, X86_PREIMM_REL32, X86Flow::eCJmp};
+			twobyte[0x07].flow = X86Flow::eRet;//sysret
+			twobyte[0x0B].flow = X86Flow::eTrap;//ud2
+			twobyte[0xB9].flow = X86Flow::eTrap;//ud1
+			twobyte[0xFF].flow = X86Flow::eTrap;//ud0
+		}
+	};
+
+	static const X86PreTables& getPreTables() {
+		static const X86PreTables tables;
+		return tables;
+	}
+
+	static inline bool isLegacyPrefix (uint8_t b) {
+		switch (b) {
+		case 0x26: case 0x2E: case 0x36: case 0x3E: case 0x64: case 0x65:
+		case 0x66: case 0x67: case 0xF0: case 0xF2: case 0xF3:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool x86PreDecode (const uint8_t* data, size_t size, uint64_t addr, X86PreDecoded* result) {
+		const X86PreTables& tables = getPreTables();
+
+		result->length = 0;
+		result->flow = X86Flow::eInvalid;
+		result->target = 0;
+
+		size_t max = size < 15 ? size : 15;
+		size_t i = 0;
+		bool opsize = false, adrsize = false, rexw = false;
+
+		for (; i < max; i++) {
+			uint8_t b = data[i];
+			if ( (b & 0xF0) == 0x40) {
+				rexw = (b & 0x8) != 0;
+				continue;
+			}
+			if (!isLegacyPrefix (b))
+				break;
+			//a rex prefix is ignored if it is not directly in front of the opcode
+			rexw = false;
+			if (b == 0x66)
+				opsize = true;
+			else if (b == 0x67)
+				adrsize = true;
+		}
+		if (i >= max)
+			return false;
+
+		X86PreOpcode opcode;
+		uint8_t op = data[i++];
+		uint8_t map = 0;
+		if (op == 0x0F) {
+			if (i >= max)
+				return false;
+			op = data[i++];
+			if (op == 0x38 || op == 0x3A) {
+				if (i >= max)
+					return false;
+				map = op == 0x38 ? 2 : 3;
+				op = data[i++];
+				opcode = {true, true, map == 3 ? X86_PREIMM_8 : X86_PREIMM_NONE, X86Flow::eNone};
+			} else {
+				map = 1;
+				opcode = tables.twobyte[op];
+			}
+		} else if (op == 0xC4 || op == 0xC5 || op == 0x62 || (op == 0x8F && i < max && (data[i] & 0x1F) >= 8)) {
+			//vex, evex and xop encode the map in the payload and are always followed by opcode and modrm
+			size_t payload = op == 0xC5 ? 1 : (op == 0x62 ? 3 : 2);
+			if (i + payload >= max)
+				return false;
+			if (op == 0xC5)
+				map = 1;
+			else if (op == 0x62)
+				map = data[i] & 0x7;
+			else
+				map = data[i] & 0x1F;
+			if (op != 0x62 && op != 0xC5)
+				rexw = (data[i + 1] & 0x80) != 0;
+			bool xop = op == 0x8F;
+			i += payload;
+			op = data[i++];
+			opcode = {true, true, X86_PREIMM_NONE, X86Flow::eNone};
+			if (xop) {
+				if (map == 8)
+					opcode.imm = X86_PREIMM_8;
+				else if (map == 0xA)
+					opcode.imm = X86_PREIMM_32;
+				else if (map != 9)
+					return false;
+			} else {
+				switch (map) {
+				case 1:
+					opcode.imm = tables.twobyte[op].imm == X86_PREIMM_8 ? X86_PREIMM_8 : X86_PREIMM_NONE;
+					//vzeroupper/vzeroall
+					opcode.modrm = op != 0x77;
+					break;
+				case 2:
+				case 5:
+				case 6:
+					break;
+				case 3:
+					opcode.imm = X86_PREIMM_8;
+					break;
+				default:
+					return false;
+				}
+			}
+		} else {
+			opcode = tables.onebyte[op];
+		}
+		if (!opcode.valid)
+			return false;
+
+		uint8_t reg = 0;
+		if (opcode.modrm) {
+			if (i >= max)
+				return false;
+			uint8_t modrm = data[i++];
+			uint8_t mod = modrm >> 6;
+			uint8_t rm = modrm & 0x7;
+			reg = (modrm >> 3) & 0x7;
+			if (mod != 3) {
+				if (rm == 4) {
+					if (i >= max)
+						return false;
+					uint8_t sib = data[i++];
+					if (mod == 0 && (sib & 0x7) == 5)
+						i += 4;
+				} else if (mod == 0 && rm == 5) {
+					i += 4;//rip relative
+				}
+				if (mod == 1)
+					i += 1;
+				else if (mod == 2)
+					i += 4;
+			}
+		}
+
+		size_t immsize = 0;
+		switch (opcode.imm) {
+		case X86_PREIMM_NONE:
+			break;
+		case X86_PREIMM_8:
+		case X86_PREIMM_REL8:
+			immsize = 1;
+			break;
+		case X86_PREIMM_16:
+			immsize = 2;
+			break;
+		case X86_PREIMM_Z:
+			immsize = opsize ? 2 : 4;
+			break;
+		case X86_PREIMM_V:
+			immsize = rexw ? 8 : (opsize ? 2 : 4);
+			break;
+		case X86_PREIMM_MOFFS:
+			immsize = adrsize ? 4 : 8;
+			break;
+		case X86_PREIMM_16_8:
+			immsize = 3;
+			break;
+		case X86_PREIMM_REL32:
+		case X86_PREIMM_32:
+			immsize = 4;
+			break;
+		case X86_PREIMM_GROUP3:
+			if (reg == 0 || reg == 1)
+				immsize = op == 0xF6 ? 1 : (opsize ? 2 : 4);
+			break;
+		}
+		if (i + immsize > max)
+			return false;
+
+		X86Flow flow = opcode.flow;
+		if (map == 0) {
+			if (op == 0xFF) {
+				switch (reg) {
+				case 2: case 3:
+					flow = X86Flow::eIndCall;
+					break;
+				case 4: case 5:
+					flow = X86Flow::eIndJmp;
+					break;
+				case 7:
+					return false;
+				}
+			} else if (op == 0xFE && reg > 1) {
+				return false;
+			}
+		}
+
+		result->length = i + immsize;
+		result->flow = flow;
+		if (opcode.imm == X86_PREIMM_REL8) {
+			result->target = addr + result->length + (int8_t) data[i];
+		} else if (opcode.imm == X86_PREIMM_REL32) {
+			int32_t rel = (int32_t) ( (uint32_t) data[i] | ( (uint32_t) data[i + 1] << 8) | ( (uint32_t) data[i + 2] << 16) | ( (uint32_t) data[i + 3] << 24));
+			result->target = addr + result->length + rel;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,48 @@
+#ifndef H_X86PREDECODER_H
+#define H_X86PREDECODER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace holox86 {
+
+	//control flow classification of a pre-decoded instruction
+	enum class X86Flow : uint8_t {
+		eNone = 0,
+		eJmp,		//direct jump
+		eCJmp,		//direct conditional jump
+		eCall,		//direct call
+		eRet,
+		eIndJmp,	//jump through register/memory
+		eIndCall,	//call through register/memory
+		eTrap,		//hlt, ud2, int3, ...
+		eInvalid
+	};
+
+	struct X86PreDecoded {
+		uint8_t length;
+		X86Flow flow;
+		uint64_t target;//destination of eJmp, eCJmp and eCall
+	};
+
+	//decodes only the length and the control flow of the instruction at data
+	//this is meant to run far ahead of capstone when discovering the cfg of a function
+	//returns false if the bytes do not form a valid x86-64 instruction
+	bool x86PreDecode (const uint8_t* data, size_t size, uint64_t addr, X86PreDecoded* result);
+
+	inline bool x86FlowEndsBlock (X86Flow flow) {
+		switch (flow) {
+		case X86Flow::eJmp:
+		case X86Flow::eCJmp:
+		case X86Flow::eRet:
+		case X86Flow::eIndJmp:
+		case X86Flow::eTrap:
+		case X86Flow::eInvalid:
+			return true;
+		default:
+			return false;
+		}
+	}
+}
+
+#endif // H_X86PREDECODER_H
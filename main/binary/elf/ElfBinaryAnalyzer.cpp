@@ -1,15 +1,18 @@
 #include "ElfBinaryAnalyzer.h"
 
+#include "Logger.h"
+
 #include <stdio.h>
+#include <inttypes.h>
 
 using namespace holodec;
 
 
 bool holoelf::ElfBinaryAnalyzer::canAnalyze (holodec::Data* pdata) {
-	holodec::Data data = *pdata;
+	holodec::Data& data = *pdata;
 	//Magic number
-	if (data[0] != 0x7F || data[1] != 'E' || data[2] != 'L' || data[3] != 'F') {
-		printf ("Wrong Header %s\n", data.data);
+	if (data.size < 4 || data[0] != 0x7F || data[1] != 'E' || data[2] != 'L' || data[3] != 'F') {
+		H_LOG_DEBUG (eLogBinary, "Wrong Header %s\n", data.filename.cstr());
 		return false;
 	}
 	return true;
@@ -87,7 +90,7 @@ bool holoelf::ElfBinaryAnalyzer::init (holodec::Data* file) {
 
 			for (size_t entryoffset = 0; entryoffset < dynsym->size; entryoffset += structlength) {
 				char* name = dynstr->getPtr<char> (binary->data, dynsym->getValue<uint32_t> (binary->data, entryoffset));
-				printf("Dynamic Symbol: %s\n", name);
+				H_LOG_DEBUG (eLogBinary, "Dynamic Symbol: %s\n", name);
 				uint64_t value;
 				uint64_t size;
 				if (binary->bitbase == 32) {
@@ -112,6 +115,7 @@ bool holoelf::ElfBinaryAnalyzer::init (holodec::Data* file) {
 			}
 		}
 	}
+	parseEhFrame();
 
 	return true;
 }
@@ -144,7 +148,7 @@ bool holoelf::ElfBinaryAnalyzer::parseFileHeader() {
 
 	//Magic number
 	if (data[0] != 0x7F || data[1] != 'E' || data[2] != 'L' || data[3] != 'F') {
-		printf ("Wrong Header %s\n", data.data);
+		H_LOG_ERROR (eLogBinary, "Wrong Header %s\n", data.filename.cstr());
 		return false;
 	}
 	//Architecture flag
@@ -158,7 +162,7 @@ bool holoelf::ElfBinaryAnalyzer::parseFileHeader() {
 		binary->bitbase = 64;
 		break;
 	default:
-		printf ("Not supported Architecture\n");
+		H_LOG_ERROR (eLogBinary, "Not supported Architecture\n");
 		return false;
 	}
 	//Endianess flag
@@ -170,7 +174,7 @@ bool holoelf::ElfBinaryAnalyzer::parseFileHeader() {
 		binary->stringDB.insert (std::pair<HString, HString> (holokey::endianess, "big"));
 		break;
 	default:
-		printf ("Not supported Endianess\n");
+		H_LOG_ERROR (eLogBinary, "Not supported Endianess\n");
 		return false;
 	}
 	//ELF Version
@@ -178,7 +182,7 @@ bool holoelf::ElfBinaryAnalyzer::parseFileHeader() {
 	case 0x01:
 		break;
 	default:
-		printf ("Not supported Elf version\n");
+		H_LOG_ERROR (eLogBinary, "Not supported Elf version\n");
 		return false;
 	}
 	//OS-ABI
@@ -210,14 +214,14 @@ bool holoelf::ElfBinaryAnalyzer::parseFileHeader() {
 		//0xfeff	Operating system-specific
 		//0xff00	Processor-specific
 		//0xffff	Processor-specific
-		printf ("Not supported Type 0x%02x\n", data.get<uint16_t> (0x10));
+		H_LOG_ERROR (eLogBinary, "Not supported Type 0x%02x\n", data.get<uint16_t> (0x10));
 		return false;
 	}
 	//Instruction Set
 	elf_is = (Elf_Instructionset) data.get<uint16_t> (0x12);
 	if (instructionsets[elf_is]) {
 		binary->stringDB.insert (std::pair<HString, HString> (holokey::architecture, instructionsets[elf_is]));
-		printf ("InstructionSet: %s\n", instructionsets[elf_is]);
+		H_LOG_DEBUG (eLogBinary, "InstructionSet: %s\n", instructionsets[elf_is]);
 	}
 	switch (elf_is) {
 	case ELF_IS_X86:
@@ -227,9 +231,9 @@ bool holoelf::ElfBinaryAnalyzer::parseFileHeader() {
 	}
 	//ELF Version
 	if (data.get<uint32_t> (0x14) == 1)
-		printf ("Original Version\n");
+		H_LOG_DEBUG (eLogBinary, "Original Version\n");
 	else
-		printf ("Not supported Version\n");
+		H_LOG_WARN (eLogBinary, "Not supported Version\n");
 
 	size_t offset64bit;
 	if (binary->bitbase == 32) {
@@ -247,8 +251,8 @@ bool holoelf::ElfBinaryAnalyzer::parseFileHeader() {
 		sectionHeaderTable.offset = data.get<uint64_t> (0x28);
 		offset64bit = 0xC;
 	}
-	printf ("Processor specific Flags: %d\n", data.get<uint32_t> (0x24 + offset64bit));
-	printf ("Header Size: 0x%X\n", data.get<uint16_t> (0x28  + offset64bit));
+	H_LOG_DEBUG (eLogBinary, "Processor specific Flags: %d\n", data.get<uint32_t> (0x24 + offset64bit));
+	H_LOG_DEBUG (eLogBinary, "Header Size: 0x%X\n", data.get<uint16_t> (0x28  + offset64bit));
 	programHeaderTable.size = data.get<uint16_t> (0x2A + offset64bit);
 	programHeaderTable.entries = data.get<uint16_t> (0x2C + offset64bit);
 
@@ -360,12 +364,277 @@ bool holoelf::ElfBinaryAnalyzer::parseSectionHeaderTable () {
 	for (unsigned int i = 0; i < sectionHeaderTable.entries; i++) {
 		Section* section = sections[i];
 		section->name = (char*) (nameentryptr) + nameoffset[i];
-		printf ("Name: %s\n", section->name.cstr());
-		printf ("Addr: 0x%X\n", section->offset);
-		printf ("Size: 0x%X\n", section->size);
-		if (!section->vaddr)
+		H_LOG_DEBUG (eLogBinary, "Section %s at Offset 0x%zx Size 0x%zx\n", section->name.cstr(), section->offset, section->size);
+		//not loaded into memory
+		if (!section->vaddr) {
+			delete section;
 			continue;
+		}
 		binary->addSection (section);
 	}
 	return true;
 }
+
+static bool readULEB128 (const uint8_t*& ptr, const uint8_t* end, uint64_t* value) {
+	uint64_t result = 0;
+	for (int shift = 0; ptr < end && shift < 64; shift += 7) {
+		uint8_t byte = *ptr++;
+		result |= (uint64_t) (byte & 0x7F) << shift;
+		if (! (byte & 0x80)) {
+			*value = result;
+			return true;
+		}
+	}
+	return false;
+}
+static bool readSLEB128 (const uint8_t*& ptr, const uint8_t* end, int64_t* value) {
+	int64_t result = 0;
+	int shift = 0;
+	while (ptr < end && shift < 64) {
+		uint8_t byte = *ptr++;
+		result |= (int64_t) (byte & 0x7F) << shift;
+		shift += 7;
+		if (! (byte & 0x80)) {
+			if (shift < 64 && (byte & 0x40))
+				result |= - ( (int64_t) 1 << shift);
+			*value = result;
+			return true;
+		}
+	}
+	return false;
+}
+//reads a pointer in DW_EH_PE encoding, vaddr is the address ptr is mapped to
+static bool readEhPointer (const uint8_t*& ptr, const uint8_t* end, uint8_t encoding, uint64_t vaddr, uint64_t datarel, size_t bitbase, uint64_t* value) {
+	uint64_t result;
+	switch (encoding & 0x0F) {
+	case 0x00://absptr
+		if (bitbase == 32) {
+			if (end - ptr < 4)
+				return false;
+			result = * (uint32_t*) ptr;
+			ptr += 4;
+		} else {
+			if (end - ptr < 8)
+				return false;
+			result = * (uint64_t*) ptr;
+			ptr += 8;
+		}
+		break;
+	case 0x01:
+		if (!readULEB128 (ptr, end, &result))
+			return false;
+		break;
+	case 0x09: {
+		int64_t sresult;
+		if (!readSLEB128 (ptr, end, &sresult))
+			return false;
+		result = sresult;
+	}
+	break;
+	case 0x02:
+	case 0x0A:
+		if (end - ptr < 2)
+			return false;
+		result = (encoding & 0x08) ? (uint64_t) (int64_t) * (int16_t*) ptr : * (uint16_t*) ptr;
+		ptr += 2;
+		break;
+	case 0x03:
+	case 0x0B:
+		if (end - ptr < 4)
+			return false;
+		result = (encoding & 0x08) ? (uint64_t) (int64_t) * (int32_t*) ptr : * (uint32_t*) ptr;
+		ptr += 4;
+		break;
+	case 0x04:
+	case 0x0C:
+		if (end - ptr < 8)
+			return false;
+		result = * (uint64_t*) ptr;
+		ptr += 8;
+		break;
+	default:
+		return false;
+	}
+	switch (encoding & 0x70) {
+	case 0x00:
+		break;
+	case 0x10://pcrel
+		result += vaddr;
+		break;
+	case 0x30://datarel
+		result += datarel;
+		break;
+	default://textrel and funcrel are not used for fdes
+		return false;
+	}
+	*value = result;
+	return true;
+}
+
+bool holoelf::ElfBinaryAnalyzer::parseEhFrame() {
+	Section* ehframe = binary->getSection (".eh_frame");
+	if (!ehframe || !ehframe->size || ehframe->offset + ehframe->size > binary->data->size)
+		return false;
+
+	//everything is read in place from the mapped file
+	const uint8_t* base = ehframe->getPtr<uint8_t> (binary->data, 0);
+	const uint8_t* end = base + ehframe->size;
+
+	HMap<size_t, uint8_t> cieEncodings;
+	HMap<uint64_t, Symbol*> functionsymbols;
+	for (Symbol* symbol : binary->symbols) {
+		if (symbol->symboltype == &SymbolType::symfunc)
+			functionsymbols[symbol->vaddr] = symbol;
+	}
+	size_t fdecount = 0, newcount = 0;
+
+	//returns the pointer encoding of the fdes belonging to the cie or 0xFF
+	auto getCieEncoding = [&] (size_t cieoffset) -> uint8_t {
+		auto it = cieEncodings.find (cieoffset);
+		if (it != cieEncodings.end())
+			return it->second;
+		uint8_t encoding = 0xFF;
+		const uint8_t* ptr = base + cieoffset;
+		if (cieoffset + 8 < ehframe->size) {
+			uint64_t length = * (uint32_t*) ptr;
+			ptr += 4;
+			if (length == 0xFFFFFFFF) {
+				if (cieoffset + 12 >= ehframe->size) {
+					cieEncodings[cieoffset] = encoding;
+					return encoding;
+				}
+				length = * (uint64_t*) ptr;
+				ptr += 8;
+			}
+			const uint8_t* cieend = length <= (uint64_t) (end - ptr) ? ptr + length : end;
+			//unlike in .debug_frame the cie id has 4 bytes in the 64 bit format as well
+			if (cieend - ptr <= 4) {
+				cieEncodings[cieoffset] = encoding;
+				return encoding;
+			}
+			ptr += 4;
+			uint8_t version = *ptr++;
+			const char* augmentation = (const char*) ptr;
+			while (ptr < cieend && *ptr)
+				ptr++;
+			ptr++;
+			uint64_t tmp;
+			int64_t stmp;
+			if (augmentation[0] == 'e' && augmentation[1] == 'h')
+				ptr += binary->bitbase / 8;
+			bool valid = readULEB128 (ptr, cieend, &tmp) && readSLEB128 (ptr, cieend, &stmp);
+			if (version == 1)
+				ptr++;
+			else
+				valid = valid && readULEB128 (ptr, cieend, &tmp);
+			encoding = 0x00;
+			if (valid && augmentation[0] == 'z' && readULEB128 (ptr, cieend, &tmp)) {
+				for (const char* c = augmentation + 1; *c && ptr < cieend; c++) {
+					if (*c == 'R') {
+						encoding = *ptr;
+						break;
+					} else if (*c == 'L') {
+						ptr++;
+					} else if (*c == 'P') {
+						uint8_t personalityencoding = *ptr++;
+						//the position of the encoding of the fdes is not known after it
+						if (!readEhPointer (ptr, cieend, personalityencoding, 0, 0, binary->bitbase, &tmp)) {
+							encoding = 0xFF;
+							break;
+						}
+					} else if (*c != 'S' && *c != 'B') {
+						encoding = 0xFF;
+						break;
+					}
+				}
+			} else if (!valid) {
+				encoding = 0xFF;
+			}
+		}
+		cieEncodings[cieoffset] = encoding;
+		return encoding;
+	};
+	auto isExecutable = [&] (uint64_t addr) {
+		for (Section* section : binary->sections) {
+			if (section->pointsToSection (addr))
+				return (section->srwx & 0x4) != 0;
+		}
+		return false;
+	};
+	//parses the fde at fdeoffset and returns the offset of the next entry
+	auto parseFde = [&] (size_t fdeoffset) -> size_t {
+		if (fdeoffset + 8 > ehframe->size)
+			return ehframe->size;
+		const uint8_t* ptr = base + fdeoffset;
+		uint64_t length = * (uint32_t*) ptr;
+		ptr += 4;
+		if (!length)
+			return ehframe->size;
+		if (length == 0xFFFFFFFF) {
+			if (fdeoffset + 12 > ehframe->size)
+				return ehframe->size;
+			length = * (uint64_t*) ptr;
+			ptr += 8;
+		}
+		//the cie pointer has 4 bytes in the 64 bit format as well
+		if (length > (uint64_t) (end - ptr) || length < 4)
+			return ehframe->size;
+		const uint8_t* fdeend = ptr + length;
+		size_t nextoffset = fdeend - base;
+		uint32_t cieptr = * (uint32_t*) ptr;
+		if (!cieptr || cieptr > (size_t) (ptr - base))//this is a cie
+			return nextoffset;
+		uint8_t encoding = getCieEncoding ( (ptr - base) - cieptr);
+		ptr += 4;
+		if (encoding == 0xFF)
+			return nextoffset;
+
+		uint64_t pcbegin, pcrange;
+		if (!readEhPointer (ptr, fdeend, encoding, ehframe->vaddr + (ptr - base), 0, binary->bitbase, &pcbegin))
+			return nextoffset;
+		if (!readEhPointer (ptr, fdeend, encoding & 0x0F, 0, 0, binary->bitbase, &pcrange))
+			return nextoffset;
+		fdecount++;
+		if (!pcbegin || !isExecutable (pcbegin))
+			return nextoffset;
+
+		auto it = functionsymbols.find (pcbegin);
+		if (it != functionsymbols.end()) {
+			if (!it->second->size)
+				it->second->size = pcrange;
+		} else {
+			char buffer[30];
+			snprintf (buffer, 30, "func_0x%" PRIx64, pcbegin);
+			Symbol* symbol = new Symbol ({0, buffer, &SymbolType::symfunc, 0, pcbegin, pcrange});
+			binary->addSymbol (symbol);
+			functionsymbols[pcbegin] = symbol;
+			newcount++;
+		}
+		return nextoffset;
+	};
+
+	Section* ehframehdr = binary->getSection (".eh_frame_hdr");
+	const uint8_t* hdr = ehframehdr && ehframehdr->offset + ehframehdr->size <= binary->data->size ? ehframehdr->getPtr<uint8_t> (binary->data, 0) : nullptr;
+	if (hdr && ehframehdr->size >= 4 && hdr[0] == 1 && hdr[3] != 0xFF) {
+		//the binary search table already lists every fde
+		const uint8_t* hdrend = hdr + ehframehdr->size;
+		const uint8_t* ptr = hdr + 4;
+		uint64_t ehframeptr, tablesize;
+		if (readEhPointer (ptr, hdrend, hdr[1], ehframehdr->vaddr + 4, ehframehdr->vaddr, binary->bitbase, &ehframeptr) &&
+		        readEhPointer (ptr, hdrend, hdr[2], ehframehdr->vaddr + (ptr - hdr), ehframehdr->vaddr, binary->bitbase, &tablesize)) {
+			for (uint64_t i = 0; i < tablesize; i++) {
+				uint64_t location, fdeaddr;
+				if (!readEhPointer (ptr, hdrend, hdr[3], ehframehdr->vaddr + (ptr - hdr), ehframehdr->vaddr, binary->bitbase, &location) ||
+				        !readEhPointer (ptr, hdrend, hdr[3], ehframehdr->vaddr + (ptr - hdr), ehframehdr->vaddr, binary->bitbase, &fdeaddr))
+					break;
+				if (ehframe->pointsToSection (fdeaddr))
+					parseFde (fdeaddr - ehframe->vaddr);
+			}
+		}
+	} else {
+		for (size_t offset = 0; offset < ehframe->size;)
+			offset = parseFde (offset);
+	}
+	H_LOG_INFO (eLogBinary, "Found %zu FDEs, %zu new Functions\n", fdecount, newcount);
+	return true;
+}
@@ -54,6 +54,8 @@ namespace holoelf {
 		bool parseFileHeader();
 		bool parseProgramHeaderTable();
 		bool parseSectionHeaderTable();
+		//seeds a function symbol for every fde in .eh_frame
+		bool parseEhFrame();
 
 	};
 
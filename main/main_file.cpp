@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <inttypes.h>
 #include <Binary.h>
 #include <binary/elf/ElfBinaryAnalyzer.h>
 #include <arch/x86/X86FunctionAnalyzer.h>
@@ -7,22 +8,43 @@
 #include "FileFormat.h"
 #include "Architecture.h"
 #include "IRGen.h"
+#include "IRTables.h"
 #include "SSAGen.h"
 #include "SSAPhiNodeGenerator.h"
 #include "SSAAddressToBlockTransformer.h"
 #include "SSACallingConvApplier.h"
+#include "SSACallingConvInference.h"
 #include "SSAAssignmentSimplifier.h"
 #include "SSADCETransformer.h"
+#include "SSAMemorySSA.h"
+#include "SSAStackFrameTransformer.h"
+#include "SSASCCPTransformer.h"
+#include "SSAGVNTransformer.h"
 #include "HIdList.h"
 #include "SSAPeepholeOptimizer.h"
 #include "SSATransformToC.h"
 #include "PeepholeOptimizer.h"
+#include "PhRules.h"
 #include "ScriptingInterface.h"
 
 #include "CHolodec.h"
 #include "JobController.h"
+#include "CallGraph.h"
+#include "DependencyTracker.h"
+#include "ProjectDB.h"
+#include "FunctionCache.h"
+#include "Logger.h"
+#include "Profiler.h"
 
 #include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <string>
+#include <string.h>
+#include <math.h>
+#include <dirent.h>
+#include <sys/stat.h>
 
 using namespace holodec;
 
@@ -30,16 +52,11 @@ HString filename = "../../workingdir/leo";
 
 FileFormat elffileformat = {"elf", "elf", {
 		[] (Data * data, HString name) {
-			static holoelf::ElfBinaryAnalyzer* analyzer = nullptr;
-			if (analyzer == nullptr) {
-				printf ("Create New Object\n");
-				analyzer = new holoelf::ElfBinaryAnalyzer();
-			}
-			if (analyzer->canAnalyze (data)) {
-				holoelf::ElfBinaryAnalyzer* temp = analyzer;
-				analyzer = nullptr;
-				return (BinaryAnalyzer*) temp;
-			}
+			//every binary gets its own analyzer, it is deleted by the caller
+			holoelf::ElfBinaryAnalyzer* analyzer = new holoelf::ElfBinaryAnalyzer();
+			if (analyzer->canAnalyze (data))
+				return (BinaryAnalyzer*) analyzer;
+			delete analyzer;
 			return (BinaryAnalyzer*) nullptr;
 		}
 	}
@@ -50,10 +67,435 @@ extern Architecture holox86::x86architecture;
 holodec::JobController jc;
 
 void job_thread (int id) {
-	printf ("Job-Thread %d Starting\n", id);
+	H_LOG_DEBUG (eLogJobs, "Job-Thread %d Starting\n", id);
 	jc.start_job_loop ({id});
-	printf ("Job-Thread %d Exiting\n", id);
+	H_LOG_DEBUG (eLogJobs, "Job-Thread %d Exiting\n", id);
+}
+
+//every job-thread gets its own transformers, they keep state while transforming a function
+struct ThreadTransformers {
+	std::vector<SSATransformer*> transformers;
+	//the interprocedural transformers read the summaries of the callees in the binary that is transformed
+	SSAStackFrameTransformer* stackFrame;
+	SSACallingConvInference* ccInference;
+	SSAMemorySSA* memorySSA;
+
+	void setCallGraph (CallGraph* callgraph) {
+		stackFrame->callgraph = callgraph;
+		ccInference->callgraph = callgraph;
+		memorySSA->callgraph = callgraph;
+	}
+	//the AnalysisInputs of every transformer for the DependencyTracker
+	HList<uint32_t> getPassInputs() {
+		HList<uint32_t> inputs;
+		for (SSATransformer* transform : transformers) {
+			if (transform == stackFrame || transform == ccInference)
+				inputs.push_back (eInputCalleeSummaries | eInputCallingConvention);
+			else if (transform == memorySSA)
+				inputs.push_back (eInputCalleeSummaries);
+			else
+				inputs.push_back (inputs.empty() ? eInputGenerated : 0);
+		}
+		return inputs;
+	}
+};
+std::vector<ThreadTransformers> threadTransformers;
+
+ThreadTransformers createTransformers () {
+	ThreadTransformers threadTransformer;
+	threadTransformer.stackFrame = new SSAStackFrameTransformer();
+	threadTransformer.ccInference = new SSACallingConvInference();
+	threadTransformer.memorySSA = new SSAMemorySSA();
+	threadTransformer.transformers = {
+		new SSAAddressToBlockTransformer(),
+		//new SSACallingConvApplier(),
+		new SSAPhiNodeGenerator(),
+		new SSAAssignmentSimplifier(),
+		threadTransformer.stackFrame,
+		threadTransformer.ccInference,
+		threadTransformer.memorySSA,
+		new SSASCCPTransformer(),
+		new SSAGVNTransformer(),
+		new SSADCETransformer(),
+		//new SSAPeepholeOptimizer(),
+	};
+	for (SSATransformer* transform : threadTransformer.transformers) {
+		transform->arch = &holox86::x86architecture;
+	}
+	return threadTransformer;
+}
+
+struct AnalysisOptions {
+	const char* projectfile = nullptr;
+	const char* cachedir = nullptr;
+	uint64_t cachesize = 1024;
+	//opened once for the process, in batch mode all workers share it
+	FunctionCacheStore* cache = nullptr;
+	const char* phrulefile = nullptr;
+	bool verifypredecoder = false;
+	//adds the function starts found by the scanner, these are guessed from byte patterns so it has to be asked for
+	bool scanfunctions = false;
+	//prints the binary, the architecture and every function
+	bool print = true;
+	//writes and releases every function as soon as it is transformed
+	bool stream = false;
+};
+struct AnalysisResult {
+	bool fromProject = false;
+	size_t functions = 0;
+	size_t instructions = 0;
+	//memory of the instruction arrays of the output functions
+	size_t instructionBytes = 0;
+	size_t expressions = 0;
+};
+
+//analyzes one binary with the shared architecture and job-threads, everything created for the binary is freed again
+bool analyzeBinary (Data* data, AnalysisOptions* options, AnalysisResult* result) {
+	//an up to date project replaces the analysis of the binary
+	ProjectDB project (&holox86::x86architecture);
+	bool fromProject = false;
+	Binary* binary = nullptr;
+	if (options->projectfile && !options->verifypredecoder && project.open (options->projectfile, data)) {
+		binary = new Binary (data);
+		fromProject = project.loadBinary (binary);
+		if (!fromProject) {
+			project.close();
+			delete binary;
+			binary = nullptr;
+		}
+	}
+	BinaryAnalyzer* analyzer = nullptr;
+	FunctionAnalyzer* func_analyzer = nullptr;
+	auto release = [&binary, &analyzer, &func_analyzer] () {
+		if (func_analyzer) {
+			func_analyzer->terminate();
+			delete func_analyzer;
+		}
+		if (analyzer) {
+			analyzer->terminate();
+			delete analyzer;
+		}
+		delete binary;
+	};
+	if (!fromProject) {
+		for (FileFormat * fileformat : Main::g_main->fileformats) {
+			analyzer = fileformat->createBinaryAnalyzer (data, "binary");
+			if (analyzer)
+				break;
+		}
+		if (!analyzer || !analyzer->init (data)) {
+			printf ("Could not parse File %s\n", data->filename.cstr());
+			binary = analyzer ? analyzer->getBinary() : nullptr;
+			release();
+			return false;
+		}
+		binary = analyzer->getBinary();
+
+		for (Architecture * architecture : Main::g_main->architectures) {
+			func_analyzer = architecture->createFunctionAnalyzer (binary);
+			if (func_analyzer)
+				break;
+		}
+		if (!func_analyzer || !func_analyzer->init (binary)) {
+			printf ("No Architecture for File %s\n", data->filename.cstr());
+			release();
+			return false;
+		}
+	}
+
+	if (options->verifypredecoder) {
+		holox86::X86FunctionAnalyzer* x86analyzer = dynamic_cast<holox86::X86FunctionAnalyzer*> (func_analyzer);
+		bool verified = x86analyzer && x86analyzer->verifyPreDecoder();
+		release();
+		return verified;
+	}
+
+	if (options->print) {
+		printf ("Binary File: %s\n", binary->data->filename.cstr());
+		printf ("Size: %d Bytes\n", binary->data->size);
+
+		binary->print();
+
+		holox86::x86architecture.print();
+	}
+
+	CallGraph callgraph;
+	callgraph.binary = binary;
+
+	SSATransformToC toC;
+	toC.arch = &holox86::x86architecture;
+
+
+	DependencyTracker tracker (binary, &callgraph);
+	tracker.verbose = options->print;
+	tracker.streaming = options->stream;
+	//functions analyzed in other binaries are taken from the cache
+	FunctionCache cache (binary, &holox86::x86architecture, &callgraph, fromProject ? nullptr : options->cache);
+
+	auto addFunction = [binary, &tracker] (Symbol * symbol) {
+		Function* newfunction = new Function();
+		newfunction->symbolref = symbol->id;
+		newfunction->baseaddr = symbol->vaddr;
+		newfunction->addrToAnalyze.push_back (symbol->vaddr);
+		binary->functions.push_back (newfunction);
+		tracker.functionAdded (newfunction);
+	};
+
+	if (fromProject) {
+		//the functions are already analyzed, only their output is missing
+		callgraph.build (binary);
+		for (Function* function : binary->functions)
+			tracker.markDirty (function->id, AnalysisLevel::eOutput);
+	} else {
+		HSet<uint64_t> scannedStarts;
+		if (options->scanfunctions) {
+			auto scanStart = std::chrono::steady_clock::now();
+			func_analyzer->scanFunctionStarts (&scannedStarts);
+			double ms = std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now() - scanStart).count();
+			if (options->print)
+				printf ("Found %zu additional Function Candidates in %.3f ms, %.3f MB/s\n", scannedStarts.size(), ms, ms > 0 ? data->size / (ms / 1000) / (1024 * 1024) : 0.0);
+		}
+		for (uint64_t addr : scannedStarts) {
+			char buffer[100];
+			snprintf (buffer, 100, "func_0x%" PRIx64, addr);
+			binary->addSymbol (new Symbol ({0, buffer, &SymbolType::symfunc, 0, addr, 0}));
+		}
+
+		for (Symbol* sym : binary->symbols) {
+			if (sym->symboltype == &SymbolType::symfunc && !callgraph.getFunction (sym->vaddr))
+				addFunction (sym);
+		}
+	}
+
+	//in batch mode the same addresses are in different binaries
+	uint32_t profileBinary = g_profiler.isEnabled() ? g_profiler.registerBinary (data->filename.cstr()) : 0;
+	AnalysisPipeline pipeline;
+	pipeline.disassemble = [binary, func_analyzer, &callgraph, &cache, &addFunction, profileBinary] (Function * func) {
+		H_PROFILE_FUNCTION_SCOPE ("Disassemble", profileBinary, func->baseaddr);
+		if (!cache.lookup (func))
+			func_analyzer->analyzeFunction (func);
+		for (uint64_t addr : func->funcsCalled) {
+			if (!callgraph.getFunction (addr)) {
+				char buffer[100];
+				snprintf (buffer, 100, "func_0x%" PRIx64, addr);
+				Symbol* symbol = new Symbol ({0, buffer, &SymbolType::symfunc, 0, addr, 0});
+				binary->addSymbol (symbol);
+				addFunction (symbol);
+			}
+		}
+	};
+	pipeline.passInputs = threadTransformers[0].getPassInputs();
+	pipeline.transform = [&pipeline, &callgraph, &cache, profileBinary] (Function * func, JobContext context, size_t firstPass) {
+		H_PROFILE_FUNCTION_SCOPE ("Transform", profileBinary, func->baseaddr);
+		//the cache is keyed by the generated ssa, a transform that starts later has not got it
+		if (!firstPass && cache.restoreResult (func))
+			return;
+		//assumed for the stack analysis until the calling convention inference replaces it
+		if (!func->callingconvention)
+			func->callingconvention = holox86::x86architecture.getCallingConvention ("amd64")->id;
+
+		SSARepresentation generated;
+		if (cache.isOpen() && !firstPass)
+			generated = func->ssaRep;
+		//the job-thread may have transformed a function of another binary before
+		ThreadTransformers& threadTransformer = threadTransformers[context.threadId];
+		threadTransformer.setCallGraph (&callgraph);
+		for (size_t i = firstPass; i < threadTransformer.transformers.size(); i++) {
+			if (pipeline.beforePass)
+				pipeline.beforePass (func, i);
+			threadTransformer.transformers[i]->doTransformation (func);
+		}
+		if (!firstPass)
+			cache.store (func, &generated);
+	};
+	//the project is written function by function, a released function can not be written at the end
+	ProjectDBWriter writer (&holox86::x86architecture);
+	if (options->projectfile && !fromProject)
+		writer.open (options->projectfile);
+	std::mutex outputMutex;
+	pipeline.output = [binary, &toC, &project, &writer, &outputMutex, fromProject, options, result, profileBinary] (Function * func) {
+		if (fromProject && !options->print)
+			return;
+		H_PROFILE_FUNCTION_SCOPE ("Output", profileBinary, func->baseaddr);
+		//functions of a project are read on first use
+		if (!project.loadFunction (func))
+			return;
+		//the written and the counted functions have to be the same as the printed ones
+		parsePhOptimizer (&holox86::x86architecture, func, options->phrulefile);
+		if (writer.isOpen())
+			writer.addFunction (func);
+		size_t expressions = 0;
+		for (SSAExpression& expr : func->ssaRep.expressions) {
+			if (expr.id)
+				expressions++;
+		}
+		//functions are output by the job-threads while streaming
+		std::unique_lock<std::mutex> lock (outputMutex);
+		result->instructions += func->instructions.size();
+		result->instructionBytes += func->instructions.getByteSize();
+		result->expressions += expressions;
+		if (!options->print)
+			return;
+		toC.doTransformation (func);
+		printf ("Symbol %s\n", binary->getSymbol (func->symbolref)->name.cstr());
+		func->print (&holox86::x86architecture);
+	};
+
+	//callees are transformed before their callers, later changes only recompute what depends on them
+	tracker.update (&pipeline, &jc);
+	if (options->print) {
+		callgraph.print();
+		cache.printStats();
+		printf ("Instructions: %zu in %zu Bytes (%.1f Bytes per Instruction)\n", result->instructions, result->instructionBytes,
+		        result->instructions ? (double) result->instructionBytes / result->instructions : 0.0);
+	}
+	if (writer.isOpen())
+		writer.finish (binary);
+
+	result->fromProject = fromProject;
+	result->functions = binary->functions.size();
+	release();
+	return true;
+}
+
+//a list file has one path per line, a directory is searched recursively
+bool collectBatchFiles (const char* path, HList<std::string>* files) {
+	struct stat st;
+	if (stat (path, &st) != 0) {
+		printf ("Could not open %s\n", path);
+		return false;
+	}
+	if (S_ISDIR (st.st_mode)) {
+		DIR* dir = opendir (path);
+		if (!dir) {
+			printf ("Could not open Directory %s\n", path);
+			return false;
+		}
+		HList<std::string> entries;
+		while (struct dirent* entry = readdir (dir)) {
+			if (entry->d_name[0] != '.')
+				entries.push_back (std::string (path) + "/" + entry->d_name);
+		}
+		closedir (dir);
+		//the same order on every run
+		std::sort (entries.begin(), entries.end());
+		for (std::string& entry : entries) {
+			if (stat (entry.c_str(), &st) != 0)
+				continue;
+			if (S_ISDIR (st.st_mode))
+				collectBatchFiles (entry.c_str(), files);
+			else if (S_ISREG (st.st_mode))
+				files->push_back (entry);
+		}
+		return true;
+	}
+	FILE* file = fopen (path, "r");
+	if (!file) {
+		printf ("Could not open File %s\n", path);
+		return false;
+	}
+	char line[4096];
+	while (fgets (line, sizeof (line), file)) {
+		size_t len = strcspn (line, "\r\n");
+		line[len] = '\0';
+		if (len && line[0] != '#')
+			files->push_back (line);
+	}
+	fclose (file);
+	return true;
 }
+
+struct BatchOptions {
+	const char* outdir = nullptr;
+	uint32_t workers = 1;
+	//larger files are skipped, together with the number of workers this bounds the memory of a batch
+	uint64_t maxsize = 256;
+};
+
+//analyzes many binaries with the one architecture and the shared job-threads
+//every worker analyzes one binary at a time and frees it before taking the next one
+int runBatch (HList<std::string>* files, BatchOptions* batchOptions, AnalysisOptions* options) {
+	std::atomic<size_t> next (0);
+	std::atomic<size_t> ok (0), failed (0), skipped (0), fromProject (0);
+	std::atomic<uint64_t> bytes (0), functions (0), instructions (0);
+	HList<double> latencies;
+	std::mutex mutex;
+
+	auto start = std::chrono::steady_clock::now();
+	auto worker = [&] () {
+		for (size_t i = next++; i < files->size(); i = next++) {
+			const std::string& path = (*files) [i];
+			struct stat st;
+			if (stat (path.c_str(), &st) != 0 || (uint64_t) st.st_size > batchOptions->maxsize * 1024 * 1024) {
+				printf ("Binary %s: Skipped\n", path.c_str());
+				skipped++;
+				continue;
+			}
+			auto binaryStart = std::chrono::steady_clock::now();
+			Data* data = Main::loadDataFromFile (path.c_str());
+			if (!data) {
+				printf ("Binary %s: Could not Load File\n", path.c_str());
+				failed++;
+				continue;
+			}
+			AnalysisOptions binaryOptions = *options;
+			std::string projectfile;
+			if (batchOptions->outdir) {
+				//a project per binary, binaries that were analyzed by an earlier run are loaded from it
+				std::string name = path;
+				std::replace (name.begin(), name.end(), '/', '_');
+				projectfile = std::string (batchOptions->outdir) + "/" + name + ".hdb";
+				binaryOptions.projectfile = projectfile.c_str();
+			}
+			AnalysisResult result;
+			bool analyzed = analyzeBinary (data, &binaryOptions, &result);
+			uint64_t size = data->size;
+			delete data;
+			double ms = std::chrono::duration<double, std::milli> (std::chrono::steady_clock::now() - binaryStart).count();
+			if (!analyzed) {
+				printf ("Binary %s: Failed after %.3f ms\n", path.c_str(), ms);
+				failed++;
+				continue;
+			}
+			if (result.fromProject) {
+				printf ("Binary %s: %zu Functions from Project in %.3f ms\n", path.c_str(), result.functions, ms);
+				fromProject++;
+			} else {
+				printf ("Binary %s: %zu Functions, %zu Instructions, %zu Expressions in %.3f ms\n", path.c_str(), result.functions, result.instructions, result.expressions, ms);
+			}
+			ok++;
+			bytes += size;
+			functions += result.functions;
+			instructions += result.instructions;
+			std::unique_lock<std::mutex> lock (mutex);
+			latencies.push_back (ms);
+		}
+	};
+	std::vector<std::thread*> workers;
+	for (uint32_t i = 0; i < batchOptions->workers; i++)
+		workers.push_back (new std::thread (worker));
+	for (std::thread* thread : workers) {
+		thread->join();
+		delete thread;
+	}
+	double seconds = std::chrono::duration<double> (std::chrono::steady_clock::now() - start).count();
+
+	std::sort (latencies.begin(), latencies.end());
+	auto percentile = [&latencies] (double p) {
+		//nearest rank
+		size_t rank = (size_t) ceil (p * latencies.size());
+		return latencies.empty() ? 0.0 : latencies[std::max ((size_t) 1, rank) - 1];
+	};
+	printf ("Batch: %zu Binaries, %zu Analyzed, %zu from Project, %zu Failed, %zu Skipped with %u Workers in %.3f s\n",
+	        files->size(), ok.load(), fromProject.load(), failed.load(), skipped.load(), batchOptions->workers, seconds);
+	if (seconds > 0.0)
+		printf ("Throughput: %.3f Binaries/s, %.3f MB/s, %.1f Functions/s, %.1f Instructions/s\n", ok / seconds,
+		        bytes / seconds / (1024 * 1024), functions / seconds, instructions / seconds);
+	printf ("Latency: p50 %.3f ms, p90 %.3f ms, p99 %.3f ms, max %.3f ms\n", percentile (0.5), percentile (0.9),
+	        percentile (0.99), latencies.empty() ? 0.0 : latencies.back());
+	return failed ? 1 : 0;
+}
+
 int main (int argc, char** argv) {
 
 	/*
@@ -65,151 +507,207 @@ int main (int argc, char** argv) {
 	 * MemoryAccess aa = Store(yy, value)
 	 *
 	 */
-	printf ("Init X86\n");
-
-	std::vector<std::thread*> threads;
-	for (int i = 0; i < 10; i++) {
-		threads.push_back (new std::thread (job_thread, i));
+	AnalysisOptions options;
+	const char* irtablefile = nullptr;
+	const char* snapshotfile = nullptr;
+	const char* phgenfile = nullptr;
+	const char* batchfile = nullptr;
+	bool profile = false;
+	const char* profiletrace = nullptr;
+	size_t profilefunctions = 20;
+	BatchOptions batchOptions;
+	batchOptions.workers = std::max (1u, std::thread::hardware_concurrency() / 2);
+	for (int i = 1; i < argc; i++) {
+		if (strcmp (argv[i], "--verify-predecoder") == 0)
+			options.verifypredecoder = true;
+		else if (strcmp (argv[i], "--scan-functions") == 0)
+			options.scanfunctions = true;
+		else if (strcmp (argv[i], "--gen-ir-tables") == 0 && i + 1 < argc)
+			irtablefile = argv[++i];
+		else if (strcmp (argv[i], "--arch-snapshot") == 0 && i + 1 < argc)
+			snapshotfile = argv[++i];
+		else if (strcmp (argv[i], "--project") == 0 && i + 1 < argc)
+			options.projectfile = argv[++i];
+		else if (strcmp (argv[i], "--cache") == 0 && i + 1 < argc)
+			options.cachedir = argv[++i];
+		else if (strcmp (argv[i], "--cache-size") == 0 && i + 1 < argc)
+			options.cachesize = strtoull (argv[++i], nullptr, 10);
+		else if (strcmp (argv[i], "--ph-rules") == 0 && i + 1 < argc)
+			options.phrulefile = argv[++i];
+		else if (strcmp (argv[i], "--gen-ph-rules") == 0 && i + 2 < argc) {
+			options.phrulefile = argv[++i];
+			phgenfile = argv[++i];
+		}
+		else if (strcmp (argv[i], "--stream") == 0)
+			options.stream = true;
+		else if (strcmp (argv[i], "--batch") == 0 && i + 1 < argc)
+			batchfile = argv[++i];
+		else if (strcmp (argv[i], "--batch-workers") == 0 && i + 1 < argc)
+			batchOptions.workers = std::max (1ul, strtoul (argv[++i], nullptr, 10));
+		else if (strcmp (argv[i], "--batch-max-size") == 0 && i + 1 < argc)
+			batchOptions.maxsize = strtoull (argv[++i], nullptr, 10);
+		else if (strcmp (argv[i], "--batch-out") == 0 && i + 1 < argc)
+			batchOptions.outdir = argv[++i];
+		else if (strcmp (argv[i], "--log") == 0 && i + 1 < argc) {
+			if (!g_logger.configure (argv[++i]))
+				return -1;
+		}
+		else if (strcmp (argv[i], "--profile") == 0)
+			profile = true;
+		else if (strcmp (argv[i], "--profile-trace") == 0 && i + 1 < argc)
+			profiletrace = argv[++i];
+		else if (strcmp (argv[i], "--profile-functions") == 0 && i + 1 < argc)
+			profilefunctions = strtoull (argv[++i], nullptr, 10);
+		else if (strcmp (argv[i], "--log-file") == 0 && i + 1 < argc) {
+			if (!g_logger.open (argv[++i]))
+				return -1;
+		}
+		else
+			filename = argv[i];
 	}
+	if (argc < 2) {
+		printf ("Init X86\n");
+
+		std::vector<std::thread*> threads;
+		for (int i = 0; i < 10; i++) {
+			threads.push_back (new std::thread (job_thread, i));
+		}
 
 
 
-	for (int i = 0; i < 1000; i++) {
-		holodec::Job job = {[i, &jc] (holodec::JobContext context) {
-			if (i == 999) {
-				std::this_thread::sleep_for(std::chrono::seconds(2));
-				for (int j = 0; j < 500; j++) {
-					holodec::Job job = {[j, &jc] (holodec::JobContext context) {
-						printf ("Inner Job: %d from Thread: %d\n", j, context.threadId);
-					}};
-					jc.queue_job (job);
+		for (int i = 0; i < 1000; i++) {
+			holodec::Job job = {[i, &jc] (holodec::JobContext context) {
+				if (i == 999) {
+					std::this_thread::sleep_for(std::chrono::seconds(2));
+					for (int j = 0; j < 500; j++) {
+						holodec::Job job = {[j, &jc] (holodec::JobContext context) {
+							printf ("Inner Job: %d from Thread: %d\n", j, context.threadId);
+						}};
+						jc.queue_job (job);
+					}
 				}
+				printf ("Job: %d from Thread: %d\n", i, context.threadId);
 			}
-			printf ("Job: %d from Thread: %d\n", i, context.threadId);
+			                   };
+			jc.queue_job (job);
 		}
-		                   };
-		jc.queue_job (job);
-	}
 
-	jc.wait_for_finish();
+		jc.wait_for_finish();
 	
-	jc.wait_for_exit();
+		jc.wait_for_exit();
 	
-	printf("Jobs %d\n", jc.jobs.size());
+		printf("Jobs %d\n", jc.jobs.size());
 
-	for (auto it = threads.begin(); it != threads.end(); ++it) {
-		(*it)->join();
-		delete *it;
+		for (auto it = threads.begin(); it != threads.end(); ++it) {
+			(*it)->join();
+			delete *it;
+		}
+		return 0;
 	}
-	return 0;
 
 	Main::initMain();
-	Data* data = Main::loadDataFromFile (filename);
-	if (!data) {
-		printf ("Could not Load File %s\n", filename.cstr());
-		return -1;
+
+	if (irtablefile) {
+		//parse all ir-strings again and write them as tables that are compiled in
+		holox86::x86architecture.irTables = nullptr;
+		holox86::x86architecture.init();
+		FILE* file = fopen (irtablefile, "w");
+		if (!file) {
+			printf ("Could not open File %s\n", irtablefile);
+			return -1;
+		}
+		bool written = writeIRTables (&holox86::x86architecture, "holox86", "x86irtables", file);
+		fclose (file);
+		return written ? 0 : -1;
+	}
+	if (phgenfile) {
+		//turn the rules into matcher functions that are compiled in
+		PhRuleSet ruleSet;
+		if (!parsePhRules (options.phrulefile, &ruleSet))
+			return -1;
+		FILE* file = fopen (phgenfile, "w");
+		if (!file) {
+			printf ("Could not open File %s\n", phgenfile);
+			return -1;
+		}
+		bool written = writePhRules (&ruleSet, "holodec", "phstandardrules", file);
+		fclose (file);
+		return written ? 0 : -1;
+	}
+
+	HList<std::string> batchFiles;
+	Data* data = nullptr;
+	if (batchfile) {
+		if (!collectBatchFiles (batchfile, &batchFiles))
+			return -1;
+	} else {
+		data = Main::loadDataFromFile (filename);
+		if (!data) {
+			printf ("Could not Load File %s\n", filename.cstr());
+			return -1;
+		}
 	}
 
 	Main::g_main->registerFileFormat (&elffileformat);
 	Main::g_main->registerArchitecture (&holox86::x86architecture);
 
-	printf ("Init X86\n");
-	holox86::x86architecture.init();
+	//the architecture is initialized once and shared by all binaries
+	H_LOG_INFO (eLogGeneral, "Init X86\n");
+	if (snapshotfile)
+		holox86::x86architecture.initFromSnapshot (snapshotfile);
+	else
+		holox86::x86architecture.init();
 
 	//ScriptingInterface script;
 	//script.testModule(&holox86::x86architecture);
 
-
-	BinaryAnalyzer* analyzer = nullptr;
-	for (FileFormat * fileformat : Main::g_main->fileformats) {
-		analyzer = fileformat->createBinaryAnalyzer (data, "binary");
-		if (analyzer)
-			break;
+	if (options.verifypredecoder && data) {
+		AnalysisResult result;
+		return analyzeBinary (data, &options, &result) ? 0 : 1;
 	}
-	analyzer->init (data);
-	Binary* binary = analyzer->getBinary();
-
-	FunctionAnalyzer* func_analyzer;
-	for (Architecture * architecture : Main::g_main->architectures) {
-		func_analyzer = architecture->createFunctionAnalyzer (binary);
-		if (func_analyzer)
-			break;
-	}
-	func_analyzer->init (binary);
-
-	printf ("Binary File: %s\n", binary->data->filename.cstr());
-	printf ("Size: %d Bytes\n", binary->data->size);
 
+	//reading the store is only done here and not for every binary
+	FunctionCacheStore cacheStore (&holox86::x86architecture);
+	if (options.cachedir && cacheStore.open (options.cachedir, options.cachesize * 1024 * 1024))
+		options.cache = &cacheStore;
 
-	binary->print();
-
-	holox86::x86architecture.print();
-
-	//return 0;
-
-	std::vector<SSATransformer*> transformers = {
-		new SSAAddressToBlockTransformer(),
-		//new SSACallingConvApplier(),
-		new SSAPhiNodeGenerator(),
-		new SSAAssignmentSimplifier(),
-		new SSADCETransformer(),
-		//new SSAPeepholeOptimizer(),
-		new SSATransformToC()
-	};
-
-	for (SSATransformer* transform : transformers) {
-		transform->arch = &holox86::x86architecture;
+	if (profile || profiletrace) {
+		g_profiler.enable();
+		g_profiler.nameThread ("Main");
 	}
 
+	uint32_t threadCount = std::max (1u, std::thread::hardware_concurrency());
+	std::vector<std::thread*> threads;
+	for (uint32_t i = 0; i < threadCount; i++) {
+		threadTransformers.push_back (createTransformers());
+		threads.push_back (new std::thread (job_thread, i));
+	}
 
-	for (Symbol* sym : binary->symbols) {
-		if (sym->symboltype == &SymbolType::symfunc) {
-			Function* newfunction = new Function();
-			newfunction->symbolref = sym->id;
-			newfunction->baseaddr = sym->vaddr;
-			newfunction->addrToAnalyze.push_back (sym->vaddr);
-			binary->functions.push_back (newfunction);
-		}
-	}
-	bool funcAnalyzed;
-	do {
-		funcAnalyzed = false;
-		for (Function* func : binary->functions) {
-			if (!func->addrToAnalyze.empty()) {
-				func_analyzer->analyzeFunction (func);
-				funcAnalyzed = true;
-				if (!func->funcsCalled.empty()) {
-					for (uint64_t addr : func->funcsCalled) {
-						if (binary->findSymbol (addr, &SymbolType::symfunc) == nullptr) {
-							char buffer[100];
-							snprintf (buffer, 100, "func_0x%x", addr);
-							Symbol* symbol = new Symbol ({0, buffer, &SymbolType::symfunc, 0, addr, 0});
-							binary->addSymbol (symbol);
-							Function* newfunction = new Function();
-							newfunction->symbolref = symbol->id;
-							newfunction->baseaddr = symbol->vaddr;
-							newfunction->addrToAnalyze.push_back (symbol->vaddr);
-							binary->functions.push_back (newfunction);
-						}
-					}
-				}
-				break;
-			}
-		}
-	} while (funcAnalyzed);
-
-
-	for (Function* func : binary->functions) {
-
-		func->callingconvention = holox86::x86architecture.getCallingConvention ("amd64")->id;
+	int ret = 0;
+	if (batchfile) {
+		options.print = false;
+		options.stream = true;
+		ret = runBatch (&batchFiles, &batchOptions, &options);
+	} else {
+		AnalysisResult result;
+		ret = analyzeBinary (data, &options, &result) ? 0 : -1;
+		delete data;
+	}
 
-		for (SSATransformer* transform : transformers) {
-			transform->doTransformation (func);
-		}
-		PeepholeOptimizer* optimizer = parsePhOptimizer (&holox86::x86architecture, func);
-		transformers[4]->doTransformation (func);
-		printf ("Symbol %s\n", binary->getSymbol (func->symbolref)->name.cstr());
-		func->print (&holox86::x86architecture);
+	jc.wait_for_exit();
+	for (auto it = threads.begin(); it != threads.end(); ++it) {
+		(*it)->join();
+		delete *it;
+	}
+	for (ThreadTransformers& threadTransformer : threadTransformers) {
+		for (SSATransformer* transform : threadTransformer.transformers)
+			delete transform;
 	}
-	return 0;
+	//all job-threads are done, nothing records anymore
+	if (profile)
+		g_profiler.printSummary (profilefunctions);
+	if (profiletrace && !g_profiler.writeTrace (profiletrace))
+		ret = -1;
+	g_logger.stop();
+	return ret;
 }